@@ -0,0 +1,68 @@
+#include "Parallel.h"
+
+// Dependencies | std
+#include <algorithm>
+
+// Dependencies | core
+#include <core/ThreadPool.h>
+
+namespace it {
+	// Functions
+	int hardwareThreadCount() {
+		return ThreadPool::shared().getThreadCount();
+	}
+
+	void parallelFor(int begin, int end, const std::function<void(int, int)>& body, int grainSize, ExecutionPolicy policy) {
+		if (end <= begin)
+			return;
+
+		if (policy == ExecutionPolicy::SEQUENTIAL) {
+			body(begin, end);
+			return;
+		}
+		ThreadPool::shared().parallelFor(begin, end, body, grainSize);
+	}
+	void parallelForRows(const ui::Rect& area, const std::function<void(const ui::Rect&)>& body, int grainRows, ExecutionPolicy policy) {
+		// Error check
+		if (!area.isValid())
+			return;
+
+		parallelFor(area.top(), area.bottom(), [&](int rowBegin, int rowEnd) {
+			body({ { area.x(), rowBegin }, { area.width(), rowEnd - rowBegin } });
+		}, grainRows, policy);
+	}
+	void parallelForTiles(const ui::Rect& area, glm::ivec2 tileSize, const std::function<void(const ui::Rect&)>& body, ExecutionPolicy policy) {
+		// Error check
+		if (!area.isValid() || tileSize.x <= 0 || tileSize.y <= 0)
+			return;
+
+		const int tilesX = (area.width() + tileSize.x - 1) / tileSize.x;
+		const int tilesY = (area.height() + tileSize.y - 1) / tileSize.y;
+		parallelFor(0, tilesX * tilesY, [&](int tileBegin, int tileEnd) {
+			for (int tile = tileBegin; tile < tileEnd; tile++) {
+				const ui::Rect region{ { area.x() + (tile % tilesX) * tileSize.x, area.y() + (tile / tilesX) * tileSize.y }, tileSize };
+				body(region.intersected(area));
+			}
+		}, 1, policy);
+	}
+
+	void parallelForBands(int begin, int end, const std::function<void(int, int)>& body, int minimumBandSize) {
+		const int itemCount = end - begin;
+		if (itemCount <= 0)
+			return;
+
+		const int bandCount = std::clamp(itemCount / std::max(1, minimumBandSize), 1, hardwareThreadCount());
+		if (bandCount == 1) {
+			body(begin, end);
+			return;
+		}
+
+		parallelFor(0, bandCount, [&](int bandBegin, int bandEnd) {
+			for (int band = bandBegin; band < bandEnd; band++) {
+				const int first = begin + static_cast<int>(static_cast<long long>(itemCount) * band / bandCount);
+				const int last = begin + static_cast<int>(static_cast<long long>(itemCount) * (band + 1) / bandCount);
+				body(first, last);
+			}
+		});
+	}
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+// Dependencies | std
+#include <functional>
+
+// Dependencies | glm
+#include <glm/vec2.hpp>
+
+// Dependencies | core
+#include <core/Rect.h>
+
+namespace it {
+	// Enums
+	enum class ExecutionPolicy {
+		SEQUENTIAL,	// On the calling thread
+		PARALLEL	// Split over ThreadPool::shared()
+	};
+
+	// Functions
+	int hardwareThreadCount(); // Threads of the shared pool, the calling thread included
+
+	// Runs body(rangeBegin, rangeEnd) over [begin, end) in ranges of about grainSize items. Returns once every range has
+	// finished; safe to call from inside another loop body.
+	void parallelFor(int begin, int end, const std::function<void(int, int)>& body, int grainSize = 1, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	// Horizontal bands of area, about grainRows rows each
+	void parallelForRows(const ui::Rect& area, const std::function<void(const ui::Rect&)>& body, int grainRows = 16, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	// tileSize tiles of area in row-major order (tiles on the right and bottom edges are clipped)
+	void parallelForTiles(const ui::Rect& area, glm::ivec2 tileSize, const std::function<void(const ui::Rect&)>& body, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+
+	// Splits [begin, end) into contiguous bands of at least minimumBandSize items, at most one per pool thread, and runs
+	// body(bandBegin, bandEnd) for each band on the shared pool. Suits bodies with per-band setup (scratch buffers).
+	void parallelForBands(int begin, int end, const std::function<void(int, int)>& body, int minimumBandSize = 16);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+// Instruction set detection shared by the pixel kernels. Every kernel keeps a scalar path so that
+// the code base still builds on targets without any of these extensions.
+
+// x86 | SSE2 (baseline on x86-64)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define IT_SIMD_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+// x86 | SSSE3 (pshufb)
+#if defined(__SSSE3__) || defined(__AVX__)
+	#define IT_SIMD_SSSE3 1
+	#include <tmmintrin.h>
+#endif
+
+// x86 | SSE4.1
+#if defined(__SSE4_1__) || defined(__AVX__)
+	#define IT_SIMD_SSE41 1
+	#include <smmintrin.h>
+#endif
+
+// x86 | AVX2
+#if defined(__AVX2__)
+	#define IT_SIMD_AVX2 1
+	#include <immintrin.h>
+#endif
+
+// x86 | AVX-512 VBMI (vpermb / vpermi2b byte permutes)
+#if defined(__AVX512VBMI__) && defined(__AVX512BW__)
+	#define IT_SIMD_AVX512VBMI 1
+	#include <immintrin.h>
+#endif
+
+// ARM | NEON
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+	#define IT_SIMD_NEON 1
+	#include <arm_neon.h>
+#endif
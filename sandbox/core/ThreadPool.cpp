@@ -0,0 +1,230 @@
+#include "ThreadPool.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <deque>
+#include <exception>
+
+// Dependencies | platform
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#elif defined(__linux__)
+	#include <pthread.h>
+	#include <sched.h>
+#endif
+
+namespace it {
+	namespace {
+		// Pool and queue of the calling thread when it is a worker
+		thread_local const ThreadPool* currentPool{ nullptr };
+		thread_local int currentQueue{ -1 };
+
+		std::mutex sharedMutex{};
+		std::unique_ptr<ThreadPool> sharedPool{};
+
+		void pinToCore(std::thread& thread, int core) {
+#if defined(_WIN32)
+			SetThreadAffinityMask(thread.native_handle(), static_cast<DWORD_PTR>(1) << (core % (sizeof(DWORD_PTR) * 8)));
+#elif defined(__linux__)
+			cpu_set_t cores;
+			CPU_ZERO(&cores);
+			CPU_SET(core % CPU_SETSIZE, &cores);
+			pthread_setaffinity_np(thread.native_handle(), sizeof(cores), &cores);
+#else
+			(void)thread;
+			(void)core;
+#endif
+		}
+	}
+
+	// Structs
+	struct ThreadPool::Loop {
+		// Properties
+		const std::function<void(int, int)>* body{ nullptr };
+		int grainSize{ 1 };
+		std::atomic<long long> remaining{ 0 }; // Items not finished yet
+		std::atomic<bool> failed{ false }; // Set by the first range that throws, the others are skipped
+		std::exception_ptr exception{}; // Written only by the range that set failed
+	};
+
+	struct ThreadPool::Range {
+		// Properties
+		Loop* loop{ nullptr };
+		int begin{ 0 };
+		int end{ 0 };
+	};
+
+	struct ThreadPool::Queue {
+		// Properties
+		std::mutex mutex{};
+		std::deque<Range> ranges{};
+	};
+
+	// class ThreadPool
+
+	// Static | public
+
+	// Functions
+	ThreadPool& ThreadPool::shared() {
+		std::lock_guard<std::mutex> lock(sharedMutex);
+		if (!sharedPool)
+			sharedPool = std::make_unique<ThreadPool>();
+		return *sharedPool;
+	}
+	bool ThreadPool::configureShared(int threadCount, bool pinThreads) {
+		std::lock_guard<std::mutex> lock(sharedMutex);
+		if (sharedPool)
+			return false;
+
+		sharedPool = std::make_unique<ThreadPool>(threadCount, pinThreads);
+		return true;
+	}
+
+	// Object | public
+
+	// Constructor / Destructor
+	ThreadPool::ThreadPool(int threadCount, bool pinThreads) {
+		if (threadCount <= 0)
+			threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+		const int workerCount = threadCount - 1;
+		for (int queue = 0; queue <= workerCount; queue++)
+			queues.push_back(std::make_unique<Queue>());
+
+		workers.reserve(static_cast<size_t>(workerCount));
+		for (int worker = 0; worker < workerCount; worker++) {
+			workers.emplace_back(&ThreadPool::work, this, worker);
+			if (pinThreads)
+				pinToCore(workers.back(), worker + 1);
+		}
+	}
+	ThreadPool::~ThreadPool() {
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex);
+			stopping = true;
+		}
+		wake.notify_all();
+
+		for (std::thread& worker : workers)
+			worker.join();
+	}
+
+	// Getters
+	int ThreadPool::getThreadCount() const {
+		return static_cast<int>(workers.size()) + 1;
+	}
+
+	// Functions
+	void ThreadPool::parallelFor(int begin, int end, const std::function<void(int, int)>& body, int grainSize) {
+		if (end <= begin)
+			return;
+
+		grainSize = std::max(1, grainSize);
+		if (workers.empty() || end - begin <= grainSize) {
+			body(begin, end);
+			return;
+		}
+
+		Loop loop{};
+		loop.body = &body;
+		loop.grainSize = grainSize;
+		loop.remaining = static_cast<long long>(end) - static_cast<long long>(begin);
+
+		// The calling thread works too and helps with whatever is queued until its own loop is done
+		const int queue = queueOfThisThread();
+		run(queue, { &loop, begin, end });
+		while (loop.remaining.load(std::memory_order_acquire) > 0) {
+			if (!runQueued(queue))
+				std::this_thread::yield();
+		}
+
+		// No range refers to the loop anymore, so the exception can leave
+		if (loop.exception)
+			std::rethrow_exception(loop.exception);
+	}
+
+	// Object | private
+
+	// Functions
+	void ThreadPool::work(int worker) {
+		currentPool = this;
+		currentQueue = worker;
+
+		while (true) {
+			if (runQueued(worker))
+				continue;
+
+			std::unique_lock<std::mutex> lock(sleepMutex);
+			wake.wait(lock, [this] { return stopping || queuedRanges > 0; });
+			if (stopping && queuedRanges == 0)
+				return;
+		}
+	}
+	void ThreadPool::run(int queue, Range range) {
+		// Whatever happens, the items of the range count as done or the loop would wait forever
+		Loop* loop = range.loop;
+		try {
+			// Depth first: keep the lower half, offer the upper half to thieves
+			while (range.end - range.begin > loop->grainSize) {
+				const int middle = range.begin + (range.end - range.begin) / 2;
+				push(queue, { loop, middle, range.end });
+				range.end = middle;
+			}
+
+			if (!loop->failed.load(std::memory_order_relaxed))
+				(*loop->body)(range.begin, range.end);
+		}
+		catch (...) {
+			if (!loop->failed.exchange(true, std::memory_order_relaxed))
+				loop->exception = std::current_exception();
+		}
+		loop->remaining.fetch_sub(static_cast<long long>(range.end) - static_cast<long long>(range.begin), std::memory_order_acq_rel);
+	}
+	void ThreadPool::push(int queue, const Range& range) {
+		{
+			std::lock_guard<std::mutex> lock(queues[static_cast<size_t>(queue)]->mutex);
+			queues[static_cast<size_t>(queue)]->ranges.push_back(range);
+		}
+
+		// Taking the sleep mutex orders the count with a worker checking it before it waits
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex);
+			queuedRanges++;
+		}
+		wake.notify_one();
+	}
+	bool ThreadPool::runQueued(int queue) {
+		const int queueCount = static_cast<int>(queues.size());
+		Range range{};
+		bool found{ false };
+
+		// Newest range of the own queue first, then the oldest range of the others
+		for (int offset = 0; offset < queueCount && !found; offset++) {
+			Queue& candidate = *queues[static_cast<size_t>((queue + offset) % queueCount)];
+			std::lock_guard<std::mutex> lock(candidate.mutex);
+			if (candidate.ranges.empty())
+				continue;
+
+			if (offset == 0) {
+				range = candidate.ranges.back();
+				candidate.ranges.pop_back();
+			}
+			else {
+				range = candidate.ranges.front();
+				candidate.ranges.pop_front();
+			}
+			found = true;
+		}
+		if (!found)
+			return false;
+
+		queuedRanges--;
+		run(queue, range);
+		return true;
+	}
+	int ThreadPool::queueOfThisThread() const {
+		return currentPool == this ? currentQueue : static_cast<int>(queues.size()) - 1;
+	}
+}
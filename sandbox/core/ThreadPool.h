@@ -0,0 +1,69 @@
+#pragma once
+
+// Dependencies | std
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace it {
+	// class ThreadPool
+	// Work-stealing pool for data parallel loops. Every worker owns a deque of ranges: it splits the range it runs in
+	// halves down to the grain size, queues the upper halves on its own deque, works on its newest range and, once that
+	// is empty, steals the oldest (largest) range of another worker. The thread that starts a loop takes part in it
+	// and, while waiting for the rest, keeps running queued ranges, so loops nested inside loop bodies neither deadlock
+	// nor start extra threads.
+	class ThreadPool {
+		// Static
+		public:
+			// Functions
+			static ThreadPool& shared(); // Created on first use with one thread per hardware thread
+			static bool configureShared(int threadCount, bool pinThreads); // Only before the first use of shared()
+
+		// Object
+		private:
+			// Structs
+			struct Loop;
+			struct Range;
+			struct Queue;
+
+			// Properties
+			std::vector<std::thread> workers{};
+			std::vector<std::unique_ptr<Queue>> queues{}; // One per worker, the last one is shared by outside threads
+			std::atomic<int> queuedRanges{ 0 };
+			std::atomic<bool> stopping{ false };
+			std::mutex sleepMutex{};
+			std::condition_variable wake{};
+
+		public:
+			// Constructor / Destructor
+			// threadCount includes the thread calling parallelFor (0 = one per hardware thread); with pinThreads worker
+			// i runs on core i + 1 only
+			ThreadPool(int threadCount = 0, bool pinThreads = false);
+			ThreadPool(const ThreadPool& other) = delete;
+			~ThreadPool();
+
+			// Operators | assignment
+			ThreadPool& operator=(const ThreadPool& other) = delete;
+
+			// Getters
+			int getThreadCount() const;
+
+			// Functions
+			// Runs body over [begin, end) in ranges of at most grainSize items (more than half of it unless the loop is
+			// shorter) and returns once every item is done. If body throws, ranges not started yet are skipped and the first
+			// exception is rethrown once the ranges already running are done
+			void parallelFor(int begin, int end, const std::function<void(int, int)>& body, int grainSize = 1);
+
+		private:
+			// Functions
+			void work(int worker);
+			void run(int queue, Range range);
+			void push(int queue, const Range& range);
+			bool runQueued(int queue);
+			int queueOfThisThread() const;
+	};
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+// Pixel blending shared by the kernels that composite (the pipeline composite stage and ImageMask::blend).
+
+// Dependencies | std
+#include <cstring>
+
+namespace it {
+	// Functions
+	// Straight alpha "over" of count pixels with the alpha sample last: foreground over background into destination,
+	// which may be background itself. Opaque foreground pixels are copied, which gives the same result as the formula.
+	inline void blendOver(const unsigned char* background, const unsigned char* foreground, unsigned char* destination, int count, int channels) {
+		const int colors = channels - 1;
+		for (int x = 0; x < count; x++, background += channels, foreground += channels, destination += channels) {
+			const int foregroundAlpha = foreground[colors];
+			if (foregroundAlpha == 255) {
+				std::memcpy(destination, foreground, static_cast<size_t>(channels));
+				continue;
+			}
+			const int backgroundAlpha = background[colors] * (255 - foregroundAlpha);		// Scaled by 255
+			const int alpha = foregroundAlpha * 255 + backgroundAlpha;						// Scaled by 255
+			for (int channel = 0; channel < colors; channel++) {
+				destination[channel] = alpha == 0 ? 0 : static_cast<unsigned char>(
+					(foreground[channel] * foregroundAlpha * 255 + background[channel] * backgroundAlpha + alpha / 2) / alpha
+				);
+			}
+			destination[colors] = static_cast<unsigned char>((alpha + 127) / 255);
+		}
+	}
+}
@@ -0,0 +1,347 @@
+#include "Blur.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+// Dependencies | core
+#include <core/Parallel.h>
+#include <core/Simd.h>
+
+namespace it {
+	namespace {
+		// Gaussian weights carry 14 fractional bits so two taps fit one pmaddwd without overflow
+		constexpr int WEIGHT_BITS{ 14 };
+		constexpr int WEIGHT_ONE{ 1 << WEIGHT_BITS };
+		constexpr int WEIGHT_HALF{ 1 << (WEIGHT_BITS - 1) };
+
+		// Rows per parallel band
+		constexpr int BAND_ROWS{ 16 };
+
+		// Working copy of the blurred region: tightly packed RGBA, colors premultiplied as color * alpha and alpha scaled
+		// to alpha * 255. Both fit 16 bits exactly, so low alphas keep every color through all the passes.
+		struct Buffer {
+			int width{ 0 };
+			int height{ 0 };
+			std::vector<unsigned short> samples{};
+
+			unsigned short* row(int y) {
+				return samples.data() + static_cast<size_t>(y) * static_cast<size_t>(width) * 4ULL;
+			}
+		};
+
+		// Region extraction / write back
+		void extract(const ImageViewRGBA& image, const ui::Rect& region, Buffer& buffer) {
+			buffer.width = region.width();
+			buffer.height = region.height();
+			buffer.samples.resize(static_cast<size_t>(buffer.width) * static_cast<size_t>(buffer.height) * 4ULL);
+
+			parallelForBands(0, buffer.height, [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd; y++) {
+					const glm::u8vec4* source = image.row(region.top() + y) + region.left();
+					unsigned short* destination = buffer.row(y);
+					for (int x = 0; x < buffer.width; x++, destination += 4) {
+						const unsigned int alpha = source[x].a;
+						for (int channel = 0; channel < 3; channel++)
+							destination[channel] = static_cast<unsigned short>(source[x][channel] * alpha);
+						destination[3] = static_cast<unsigned short>(alpha * 255U);
+					}
+				}
+			}, BAND_ROWS);
+		}
+		void writeBack(Buffer& buffer, const ImageViewRGBA& image, const ui::Rect& region) {
+			parallelForBands(0, buffer.height, [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd; y++) {
+					const unsigned short* source = buffer.row(y);
+					glm::u8vec4* destination = image.row(region.top() + y) + region.left();
+					for (int x = 0; x < buffer.width; x++, source += 4) {
+						const unsigned int alpha = source[3];
+						for (int channel = 0; channel < 3; channel++)
+							destination[x][channel] = alpha == 0U ? 0U : static_cast<unsigned char>(std::min(255U, (source[channel] * 255U + alpha / 2U) / alpha));
+						destination[x].a = static_cast<unsigned char>((alpha + 127U) / 255U);
+					}
+				}
+			}, BAND_ROWS);
+		}
+
+		// out[i] = sum(weights[k] * taps[k][i]); used for both directions, horizontally the taps are the same row
+		// shifted by one pixel each. The samples use the whole unsigned 16-bit range, so pmaddwd reads them offset by
+		// -32768; the weights sum to WEIGHT_ONE, which makes the offset of the sums a constant the shift takes out again.
+		void convolveRow(const unsigned short* const* taps, const short* weights, int tapCount, unsigned short* destination, size_t sampleCount) {
+			size_t i = 0ULL;
+#if defined(IT_SIMD_SSE2)
+			const __m128i OFFSET = _mm_set1_epi16(static_cast<short>(0x8000));
+			const __m128i ROUNDING = _mm_set1_epi32(WEIGHT_HALF);
+			for (; i + 8ULL <= sampleCount; i += 8ULL) {
+				__m128i low = ROUNDING;
+				__m128i high = ROUNDING;
+				for (int k = 0; k < tapCount; k += 2) {
+					const bool hasSecond = k + 1 < tapCount;
+					__m128i first = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(taps[k] + i)), OFFSET);
+					__m128i second = hasSecond ? _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(taps[k + 1] + i)), OFFSET) : _mm_setzero_si128();
+					const unsigned int secondWeight = hasSecond ? static_cast<unsigned short>(weights[k + 1]) : 0U;
+					const __m128i packedWeights = _mm_set1_epi32(static_cast<int>(static_cast<unsigned short>(weights[k]) | (secondWeight << 16)));
+					low = _mm_add_epi32(low, _mm_madd_epi16(_mm_unpacklo_epi16(first, second), packedWeights));
+					high = _mm_add_epi32(high, _mm_madd_epi16(_mm_unpackhi_epi16(first, second), packedWeights));
+				}
+				__m128i packed = _mm_packs_epi32(_mm_srai_epi32(low, WEIGHT_BITS), _mm_srai_epi32(high, WEIGHT_BITS));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_xor_si128(packed, OFFSET));
+			}
+#endif
+			for (; i < sampleCount; i++) {
+				int accumulator{ WEIGHT_HALF };
+				for (int k = 0; k < tapCount; k++)
+					accumulator += weights[k] * static_cast<int>(taps[k][i]);
+				destination[i] = static_cast<unsigned short>(std::clamp(accumulator >> WEIGHT_BITS, 0, 65535));
+			}
+		}
+
+		// Gaussian
+		std::vector<short> gaussianWeights(float sigma, int radius) {
+			std::vector<double> exact(static_cast<size_t>(2 * radius + 1));
+			double total{ 0.0 };
+			for (int k = -radius; k <= radius; k++) {
+				exact[k + radius] = std::exp(-(k * k) / (2.0 * sigma * sigma));
+				total += exact[k + radius];
+			}
+
+			// Rounding the running sum keeps the quantized weights summing to exactly WEIGHT_ONE
+			std::vector<short> weights(exact.size());
+			double running{ 0.0 };
+			int quantized{ 0 };
+			for (size_t k = 0ULL; k < exact.size(); k++) {
+				running += exact[k] / total;
+				const int next = static_cast<int>(std::lround(running * WEIGHT_ONE));
+				weights[k] = static_cast<short>(next - quantized);
+				quantized = next;
+			}
+			return weights;
+		}
+		void gaussianHorizontal(Buffer& source, Buffer& destination, const std::vector<short>& weights) {
+			const int radius = static_cast<int>(weights.size() / 2ULL);
+			const int tapCount = static_cast<int>(weights.size());
+			parallelForBands(0, source.height, [&](int rowBegin, int rowEnd) {
+				std::vector<unsigned short> padded(static_cast<size_t>(source.width + 2 * radius) * 4ULL);
+				std::vector<const unsigned short*> taps(weights.size());
+				for (int k = 0; k < tapCount; k++)
+					taps[k] = padded.data() + static_cast<size_t>(k) * 4ULL;
+
+				for (int y = rowBegin; y < rowEnd; y++) {
+					const unsigned short* row = source.row(y);
+					for (int x = -radius; x < source.width + radius; x++)
+						std::memcpy(padded.data() + static_cast<size_t>(x + radius) * 4ULL, row + static_cast<size_t>(std::clamp(x, 0, source.width - 1)) * 4ULL, 4ULL * sizeof(unsigned short));
+					convolveRow(taps.data(), weights.data(), tapCount, destination.row(y), static_cast<size_t>(source.width) * 4ULL);
+				}
+			}, BAND_ROWS);
+		}
+		void gaussianVertical(Buffer& source, Buffer& destination, const std::vector<short>& weights) {
+			const int radius = static_cast<int>(weights.size() / 2ULL);
+			const int tapCount = static_cast<int>(weights.size());
+			parallelForBands(0, source.height, [&](int rowBegin, int rowEnd) {
+				std::vector<const unsigned short*> taps(weights.size());
+				for (int y = rowBegin; y < rowEnd; y++) {
+					for (int k = 0; k < tapCount; k++)
+						taps[k] = source.row(std::clamp(y - radius + k, 0, source.height - 1));
+					convolveRow(taps.data(), weights.data(), tapCount, destination.row(y), static_cast<size_t>(source.width) * 4ULL);
+				}
+			}, BAND_ROWS);
+		}
+
+		// Box: running sums, one add and one subtract per sample regardless of the radius. Means round to nearest even in
+		// both paths, like cvtps2dq.
+		void boxHorizontal(Buffer& source, Buffer& destination, int radius) {
+			const int width = source.width;
+			const float scale = 1.0f / static_cast<float>(2 * radius + 1);
+			parallelForBands(0, source.height, [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd; y++) {
+					const unsigned short* row = source.row(y);
+					unsigned short* output = destination.row(y);
+					auto pixel = [row, width](int x) { return row + static_cast<size_t>(std::clamp(x, 0, width - 1)) * 4ULL; };
+#if defined(IT_SIMD_SSE2)
+					const __m128i ZERO = _mm_setzero_si128();
+					const __m128i OFFSET = _mm_set1_epi32(32768);
+					const __m128 SCALE = _mm_set1_ps(scale);
+					auto widen = [&ZERO](const unsigned short* samples) {
+						return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(samples)), ZERO);
+					};
+					__m128i sum = ZERO;
+					for (int x = -radius; x <= radius; x++)
+						sum = _mm_add_epi32(sum, widen(pixel(x)));
+					for (int x = 0; x < width; x++) {
+						__m128i mean = _mm_sub_epi32(_mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(sum), SCALE)), OFFSET);
+						mean = _mm_xor_si128(_mm_packs_epi32(mean, mean), _mm_set1_epi16(static_cast<short>(0x8000)));
+						_mm_storel_epi64(reinterpret_cast<__m128i*>(output + static_cast<size_t>(x) * 4ULL), mean);
+						sum = _mm_add_epi32(sum, _mm_sub_epi32(widen(pixel(x + radius + 1)), widen(pixel(x - radius))));
+					}
+#else
+					int sum[4]{};
+					for (int x = -radius; x <= radius; x++) {
+						for (int channel = 0; channel < 4; channel++)
+							sum[channel] += pixel(x)[channel];
+					}
+					for (int x = 0; x < width; x++) {
+						const unsigned short* entering = pixel(x + radius + 1);
+						const unsigned short* leaving = pixel(x - radius);
+						for (int channel = 0; channel < 4; channel++) {
+							output[static_cast<size_t>(x) * 4ULL + channel] = static_cast<unsigned short>(std::lrint(static_cast<float>(sum[channel]) * scale));
+							sum[channel] += entering[channel] - leaving[channel];
+						}
+					}
+#endif
+				}
+			}, BAND_ROWS);
+		}
+		void boxVertical(Buffer& source, Buffer& destination, int radius) {
+			const int height = source.height;
+			const size_t sampleCount = static_cast<size_t>(source.width) * 4ULL;
+			const float scale = 1.0f / static_cast<float>(2 * radius + 1);
+			parallelForBands(0, height, [&](int rowBegin, int rowEnd) {
+				auto row = [&source, height](int y) { return source.row(std::clamp(y, 0, height - 1)); };
+
+				// Column sums for the first row of the band
+				std::vector<int> sums(sampleCount, 0);
+				for (int y = rowBegin - radius; y <= rowBegin + radius; y++) {
+					const unsigned short* samples = row(y);
+					for (size_t i = 0ULL; i < sampleCount; i++)
+						sums[i] += samples[i];
+				}
+
+				for (int y = rowBegin; y < rowEnd; y++) {
+					unsigned short* output = destination.row(y);
+					const unsigned short* entering = row(y + radius + 1);
+					const unsigned short* leaving = row(y - radius);
+					size_t i = 0ULL;
+#if defined(IT_SIMD_SSE2)
+					const __m128i ZERO = _mm_setzero_si128();
+					const __m128i OFFSET = _mm_set1_epi32(32768);
+					const __m128 SCALE = _mm_set1_ps(scale);
+					for (; i + 8ULL <= sampleCount; i += 8ULL) {
+						__m128i* sum = reinterpret_cast<__m128i*>(sums.data() + i);
+						__m128i low = _mm_loadu_si128(sum);
+						__m128i high = _mm_loadu_si128(sum + 1);
+
+						// Means offset by -32768 so the signed saturation keeps the whole unsigned range
+						__m128i mean = _mm_packs_epi32(
+							_mm_sub_epi32(_mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(low), SCALE)), OFFSET),
+							_mm_sub_epi32(_mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(high), SCALE)), OFFSET)
+						);
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_xor_si128(mean, _mm_set1_epi16(static_cast<short>(0x8000))));
+
+						const __m128i enteringSamples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(entering + i));
+						const __m128i leavingSamples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(leaving + i));
+						_mm_storeu_si128(sum, _mm_add_epi32(low, _mm_sub_epi32(_mm_unpacklo_epi16(enteringSamples, ZERO), _mm_unpacklo_epi16(leavingSamples, ZERO))));
+						_mm_storeu_si128(sum + 1, _mm_add_epi32(high, _mm_sub_epi32(_mm_unpackhi_epi16(enteringSamples, ZERO), _mm_unpackhi_epi16(leavingSamples, ZERO))));
+					}
+#endif
+					for (; i < sampleCount; i++) {
+						output[i] = static_cast<unsigned short>(std::lrint(static_cast<float>(sums[i]) * scale));
+						sums[i] += entering[i] - leaving[i];
+					}
+				}
+			}, BAND_ROWS);
+		}
+
+		// Box widths whose three-pass convolution best matches a Gaussian of the given sigma
+		std::array<int, 3> boxRadiiForGaussian(float sigma) {
+			constexpr int PASSES{ 3 };
+			const double variance = static_cast<double>(sigma) * static_cast<double>(sigma);
+			int lower = static_cast<int>(std::floor(std::sqrt(12.0 * variance / PASSES + 1.0)));
+			if (lower % 2 == 0)
+				lower--;
+			const int upper = lower + 2;
+			const int lowerCount = static_cast<int>(std::lround((12.0 * variance - PASSES * lower * lower - 4.0 * PASSES * lower - 3.0 * PASSES) / (-4.0 * lower - 4.0)));
+
+			std::array<int, 3> radii{};
+			for (int pass = 0; pass < PASSES; pass++)
+				radii[pass] = ((pass < lowerCount ? lower : upper) - 1) / 2;
+			return radii;
+		}
+
+		bool clipRegion(const ImageViewRGBA& image, const ui::Rect& region, ui::Rect& clipped) {
+			if (!image.hasData() || image.width <= 0 || image.height <= 0)
+				return false;
+			clipped = region.normalized().intersected({ { 0, 0 }, { image.width, image.height } });
+			return clipped.isValid();
+		}
+	}
+
+	// Functions | blurring
+	bool gaussianBlur(const ImageViewRGBA& image, float sigma) {
+		return gaussianBlur(image, ui::Rect{ { 0, 0 }, { image.width, image.height } }, sigma);
+	}
+	bool gaussianBlur(const ImageViewRGBA& image, const ui::Rect& region, float sigma) {
+		// Error check
+		ui::Rect clipped{};
+		if (!(sigma > 0.0f) || !clipRegion(image, region, clipped))
+			return false;
+
+		const std::vector<short> weights = gaussianWeights(sigma, static_cast<int>(std::ceil(3.0f * sigma)));
+		Buffer first{};
+		Buffer second{};
+		extract(image, clipped, first);
+		second.width = first.width;
+		second.height = first.height;
+		second.samples.resize(first.samples.size());
+
+		gaussianHorizontal(first, second, weights);
+		gaussianVertical(second, first, weights);
+		writeBack(first, image, clipped);
+
+		return true;
+	}
+
+	bool boxBlur(const ImageViewRGBA& image, int radius) {
+		return boxBlur(image, ui::Rect{ { 0, 0 }, { image.width, image.height } }, radius);
+	}
+	bool boxBlur(const ImageViewRGBA& image, const ui::Rect& region, int radius) {
+		// Error check
+		ui::Rect clipped{};
+		if (radius < 0 || !clipRegion(image, region, clipped))
+			return false;
+		if (radius == 0)
+			return true;
+
+		Buffer first{};
+		Buffer second{};
+		extract(image, clipped, first);
+		second.width = first.width;
+		second.height = first.height;
+		second.samples.resize(first.samples.size());
+
+		boxHorizontal(first, second, radius);
+		boxVertical(second, first, radius);
+		writeBack(first, image, clipped);
+
+		return true;
+	}
+
+	bool fastGaussianBlur(const ImageViewRGBA& image, float sigma) {
+		return fastGaussianBlur(image, ui::Rect{ { 0, 0 }, { image.width, image.height } }, sigma);
+	}
+	bool fastGaussianBlur(const ImageViewRGBA& image, const ui::Rect& region, float sigma) {
+		// Error check
+		ui::Rect clipped{};
+		if (!(sigma > 0.0f) || !clipRegion(image, region, clipped))
+			return false;
+
+		Buffer first{};
+		Buffer second{};
+		extract(image, clipped, first);
+		second.width = first.width;
+		second.height = first.height;
+		second.samples.resize(first.samples.size());
+
+		for (int radius : boxRadiiForGaussian(sigma)) {
+			if (radius <= 0)
+				continue;
+			boxHorizontal(first, second, radius);
+			boxVertical(second, first, radius);
+		}
+		writeBack(first, image, clipped);
+
+		return true;
+	}
+}
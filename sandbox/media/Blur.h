@@ -0,0 +1,25 @@
+#pragma once
+
+// Dependencies | core
+#include <core/Rect.h>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Functions | blurring
+	// All blurs run in place on the pixels of the view. When a region is given it is clipped to the view and the blur
+	// only reads and writes inside it (edges are clamped to the region). Colors are premultiplied by alpha while blurring.
+
+	// Separable Gaussian with a kernel radius of ceil(3 * sigma)
+	bool gaussianBlur(const ImageViewRGBA& image, float sigma);
+	bool gaussianBlur(const ImageViewRGBA& image, const ui::Rect& region, float sigma);
+
+	// Sliding window box blur of width 2 * radius + 1, constant cost per pixel regardless of the radius
+	bool boxBlur(const ImageViewRGBA& image, int radius);
+	bool boxBlur(const ImageViewRGBA& image, const ui::Rect& region, int radius);
+
+	// Gaussian approximation from three successive box blurs, constant cost per pixel regardless of sigma
+	bool fastGaussianBlur(const ImageViewRGBA& image, float sigma);
+	bool fastGaussianBlur(const ImageViewRGBA& image, const ui::Rect& region, float sigma);
+}
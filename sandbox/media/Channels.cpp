@@ -0,0 +1,405 @@
+#include "Channels.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+// Dependencies | core
+#include <core/Simd.h>
+
+namespace it {
+	namespace {
+		// Pixels per parallel range
+		constexpr int PARALLEL_GRAIN{ 65536 };
+		// Largest pixel in bytes (RGBA16) and largest number of gray planes
+		constexpr int MAXIMUM_PIXEL_BYTES{ 8 };
+		constexpr int MAXIMUM_PLANES{ 4 };
+		// Registers of 16 pixels: the interleaved source, then two per plane
+		constexpr int MAXIMUM_INPUTS{ MAXIMUM_PIXEL_BYTES + 2 * MAXIMUM_PLANES };
+
+		// Byte codes of a channel map: constants, a byte of the interleaved source, or byte b of plane p at
+		// PLANE_BYTE + 2 * p + b
+		constexpr int ZERO_BYTE{ -1 };
+		constexpr int FULL_BYTE{ -2 };
+		constexpr int PLANE_BYTE{ MAXIMUM_PIXEL_BYTES };
+
+		int rowGrain(int width) {
+			return std::max(1, PARALLEL_GRAIN / std::max(1, width));
+		}
+
+		// Structs
+		struct Rows {
+			// Properties
+			unsigned char* data{ nullptr };
+			size_t stride{ 0 };
+
+			// Functions
+			unsigned char* row(int y) const {
+				return data + static_cast<size_t>(y) * stride;
+			}
+		};
+
+		// Where every byte of a destination pixel comes from
+		struct ChannelMap {
+			// Properties
+			int width{ 0 };
+			int height{ 0 };
+			int sampleSize{ 1 };
+			Rows source{};			// Interleaved, may be the destination
+			int sourceBytes{ 0 };	// Per pixel, 0 without an interleaved source
+			std::array<Rows, MAXIMUM_PLANES> planes{};
+			int planeCount{ 0 };
+			Rows destination{};
+			int destinationBytes{ 0 };
+			std::array<int, MAXIMUM_PIXEL_BYTES> codes{};
+
+			// Functions
+			int inputCount() const {
+				return sourceBytes + planeCount * sampleSize;
+			}
+			// Register and lane of input byte code for pixel (of 16), or -1 for constants
+			int inputPosition(int code, int pixel, int& lane) const {
+				if (code < 0)
+					return -1;
+				if (code < PLANE_BYTE) {
+					const int byte = pixel * sourceBytes + code;
+					lane = byte % 16;
+					return byte / 16;
+				}
+				const int plane = (code - PLANE_BYTE) / 2;
+				const int byte = pixel * sampleSize + (code - PLANE_BYTE) % 2;
+				lane = byte % 16;
+				return sourceBytes + plane * sampleSize + byte / 16;
+			}
+			unsigned char byteAt(int code, const unsigned char* pixel, int x, const std::array<const unsigned char*, MAXIMUM_PLANES>& planeRows) const {
+				if (code == ZERO_BYTE)
+					return 0;
+				if (code == FULL_BYTE)
+					return 255;
+				if (code < PLANE_BYTE)
+					return pixel[code];
+				return planeRows[(code - PLANE_BYTE) / 2][x * sampleSize + (code - PLANE_BYTE) % 2];
+			}
+		};
+
+		using ShuffleMask = std::array<char, 16>;
+
+		// Byte shuffles of a channel map for 16 pixels: each output register ORs its constants with one shuffle per
+		// input register it takes bytes from
+		struct ShuffleTable {
+			// Properties
+			std::array<ShuffleMask, MAXIMUM_PIXEL_BYTES> constants{};
+			std::array<std::array<ShuffleMask, MAXIMUM_INPUTS>, MAXIMUM_PIXEL_BYTES> masks{};
+			std::array<std::array<int, MAXIMUM_INPUTS>, MAXIMUM_PIXEL_BYTES> inputs{};
+			std::array<int, MAXIMUM_PIXEL_BYTES> inputCounts{};
+
+			// Constructors
+			explicit ShuffleTable(const ChannelMap& map) {
+				std::array<std::array<ShuffleMask, MAXIMUM_INPUTS>, MAXIMUM_PIXEL_BYTES> byInput{};
+				std::array<std::array<bool, MAXIMUM_INPUTS>, MAXIMUM_PIXEL_BYTES> used{};
+				for (std::array<ShuffleMask, MAXIMUM_INPUTS>& outputMasks : byInput)
+					for (ShuffleMask& mask : outputMasks)
+						mask.fill(static_cast<char>(-1)); // Lanes with nothing to take stay zero
+
+				for (int output = 0; output < map.destinationBytes; output++) {
+					for (int lane = 0; lane < 16; lane++) {
+						const int byte = output * 16 + lane;
+						const int code = map.codes[byte % map.destinationBytes];
+						int inputLane = 0;
+						const int input = map.inputPosition(code, byte / map.destinationBytes, inputLane);
+						if (input < 0) {
+							constants[output][lane] = static_cast<char>(code == FULL_BYTE ? 0xFF : 0);
+							continue;
+						}
+						byInput[output][input][lane] = static_cast<char>(inputLane);
+						used[output][input] = true;
+					}
+					for (int input = 0; input < map.inputCount(); input++)
+						if (used[output][input]) {
+							masks[output][inputCounts[output]] = byInput[output][input];
+							inputs[output][inputCounts[output]++] = input;
+						}
+				}
+			}
+		};
+
+		// Functions | kernel
+		void mapRow(const ChannelMap& map, int y, [[maybe_unused]] const ShuffleTable& table) {
+			const unsigned char* source = map.sourceBytes > 0 ? map.source.row(y) : nullptr;
+			unsigned char* destination = map.destination.row(y);
+			std::array<const unsigned char*, MAXIMUM_PLANES> planeRows{};
+			for (int plane = 0; plane < map.planeCount; plane++)
+				planeRows[plane] = map.planes[plane].row(y);
+
+			int x = 0;
+#if defined(IT_SIMD_SSSE3)
+			for (; x + 16 <= map.width; x += 16) {
+				// Every input register is loaded before anything is stored, so the destination may be the source
+				__m128i registers[MAXIMUM_INPUTS];
+				for (int index = 0; index < map.sourceBytes; index++)
+					registers[index] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + static_cast<size_t>(x) * map.sourceBytes + index * 16));
+				for (int plane = 0; plane < map.planeCount; plane++)
+					for (int part = 0; part < map.sampleSize; part++)
+						registers[map.sourceBytes + plane * map.sampleSize + part] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planeRows[plane] + static_cast<size_t>(x) * map.sampleSize + part * 16));
+
+				unsigned char* pixels = destination + static_cast<size_t>(x) * map.destinationBytes;
+				for (int output = 0; output < map.destinationBytes; output++) {
+					__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table.constants[output].data()));
+					for (int index = 0; index < table.inputCounts[output]; index++) {
+						const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table.masks[output][index].data()));
+						bytes = _mm_or_si128(bytes, _mm_shuffle_epi8(registers[table.inputs[output][index]], mask));
+					}
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + output * 16), bytes);
+				}
+			}
+#endif
+
+			std::array<unsigned char, MAXIMUM_PIXEL_BYTES> pixel{};
+			for (; x < map.width; x++) {
+				const unsigned char* input = source != nullptr ? source + static_cast<size_t>(x) * map.sourceBytes : nullptr;
+				for (int byte = 0; byte < map.destinationBytes; byte++)
+					pixel[byte] = map.byteAt(map.codes[byte], input, x, planeRows);
+				std::memcpy(destination + static_cast<size_t>(x) * map.destinationBytes, pixel.data(), static_cast<size_t>(map.destinationBytes));
+			}
+		}
+
+		void mapChannels(const ChannelMap& map, ExecutionPolicy policy) {
+			const ShuffleTable table(map);
+			parallelFor(0, map.height, [&](int begin, int end) {
+				for (int y = begin; y < end; y++)
+					mapRow(map, y, table);
+			}, rowGrain(map.width), policy);
+		}
+
+		// Byte codes of a channel order, for samples of sampleSize bytes
+		bool orderCodes(const std::array<int, 4>& order, int sourceChannels, int destinationChannels, int sampleSize, ChannelMap& map) {
+			for (int channel = 0; channel < destinationChannels; channel++) {
+				const int index = order[channel];
+				if (index >= sourceChannels || (index < 0 && index != CHANNEL_ZERO && index != CHANNEL_MAX))
+					return false;
+				for (int byte = 0; byte < sampleSize; byte++) {
+					int& code = map.codes[channel * sampleSize + byte];
+					if (index == CHANNEL_ZERO)
+						code = ZERO_BYTE;
+					else if (index == CHANNEL_MAX)
+						code = FULL_BYTE;
+					else
+						code = index * sampleSize + byte;
+				}
+			}
+			return true;
+		}
+
+		template<IsImage Image>
+		Rows rowsOf(const Image& image) {
+			using Sample = std::conditional_t<sizeof(*std::declval<Image>().getData()) == Image::CHANNELS, unsigned char, unsigned short>;
+			return { reinterpret_cast<unsigned char*>(image.getData()), static_cast<size_t>(image.getWidth()) * Image::CHANNELS * sizeof(Sample) };
+		}
+		template<IsImage Image>
+		int sampleSizeOf() {
+			return static_cast<int>(sizeof(*std::declval<Image>().getData()) / Image::CHANNELS);
+		}
+	}
+
+	// Functions | channels
+	bool swizzleChannels(const ImageView& source, const ImageView& destination, const std::array<int, 4>& order, ExecutionPolicy policy) {
+		// Error check
+		if (!source.hasData() || !destination.hasData() || source.width != destination.width || source.height != destination.height)
+			return false;
+		// In place only with the same pixel layout
+		if (source.data == destination.data && (source.channels != destination.channels || source.stride != destination.stride))
+			return false;
+
+		ChannelMap map;
+		map.width = source.width;
+		map.height = source.height;
+		map.source = { source.data, source.stride };
+		map.sourceBytes = source.channels;
+		map.destination = { destination.data, destination.stride };
+		map.destinationBytes = destination.channels;
+		if (!orderCodes(order, source.channels, destination.channels, 1, map))
+			return false;
+
+		mapChannels(map, policy);
+		return true;
+	}
+	template<IsImage Image>
+	bool swizzleChannels(Image& image, const std::array<int, 4>& order, ExecutionPolicy policy) {
+		// Error check
+		if (image.getData() == nullptr)
+			return false;
+
+		ChannelMap map;
+		map.width = image.getWidth();
+		map.height = image.getHeight();
+		map.sampleSize = sampleSizeOf<Image>();
+		map.source = rowsOf(image);
+		map.sourceBytes = Image::CHANNELS * map.sampleSize;
+		map.destination = map.source;
+		map.destinationBytes = map.sourceBytes;
+		if (!orderCodes(order, Image::CHANNELS, Image::CHANNELS, map.sampleSize, map))
+			return false;
+
+		mapChannels(map, policy);
+		return true;
+	}
+
+	bool extractChannel(const ImageView& source, int channel, const ImageViewGray& destination, ExecutionPolicy policy) {
+		// Error check
+		if (!destination.hasData() || channel < 0 || channel >= source.channels)
+			return false;
+
+		return swizzleChannels(source, ImageView(destination.data, destination.width, destination.height, 1, destination.stride), { channel, 0, 0, 0 }, policy);
+	}
+	bool extractChannel(const ImageView& source, int channel, ImageGray& destination, ExecutionPolicy policy) {
+		// Error check
+		if (!source.hasData() || channel < 0 || channel >= source.channels)
+			return false;
+
+		if (destination.allocate(source.width, source.height) == nullptr)
+			return false;
+		return extractChannel(source, channel, ImageViewGray(destination), policy);
+	}
+	template<IsImage Image>
+	bool extractChannel(const Image& source, int channel, GrayImageOf<Image>& destination, ExecutionPolicy policy) {
+		// Error check
+		if (source.getData() == nullptr || channel < 0 || channel >= Image::CHANNELS)
+			return false;
+		if (destination.allocate(source.getWidth(), source.getHeight()) == nullptr)
+			return false;
+
+		ChannelMap map;
+		map.width = source.getWidth();
+		map.height = source.getHeight();
+		map.sampleSize = sampleSizeOf<Image>();
+		map.source = rowsOf(source);
+		map.sourceBytes = Image::CHANNELS * map.sampleSize;
+		map.destination = rowsOf(destination);
+		map.destinationBytes = map.sampleSize;
+		orderCodes({ channel, 0, 0, 0 }, Image::CHANNELS, 1, map.sampleSize, map);
+
+		mapChannels(map, policy);
+		return true;
+	}
+
+	bool insertChannel(const ImageViewGray& source, const ImageView& destination, int channel, ExecutionPolicy policy) {
+		// Error check
+		if (!source.hasData() || !destination.hasData() || channel < 0 || channel >= destination.channels)
+			return false;
+		if (source.width != destination.width || source.height != destination.height)
+			return false;
+
+		ChannelMap map;
+		map.width = destination.width;
+		map.height = destination.height;
+		map.source = { destination.data, destination.stride };
+		map.sourceBytes = destination.channels;
+		map.planes[0] = { source.data, source.stride };
+		map.planeCount = 1;
+		map.destination = map.source;
+		map.destinationBytes = destination.channels;
+		for (int byte = 0; byte < destination.channels; byte++)
+			map.codes[byte] = byte == channel ? PLANE_BYTE : byte;
+
+		mapChannels(map, policy);
+		return true;
+	}
+	template<IsImage Image>
+	bool insertChannel(const GrayImageOf<Image>& source, Image& destination, int channel, ExecutionPolicy policy) {
+		// Error check
+		if (source.getData() == nullptr || destination.getData() == nullptr || channel < 0 || channel >= Image::CHANNELS)
+			return false;
+		if (source.getWidth() != destination.getWidth() || source.getHeight() != destination.getHeight())
+			return false;
+
+		ChannelMap map;
+		map.width = destination.getWidth();
+		map.height = destination.getHeight();
+		map.sampleSize = sampleSizeOf<Image>();
+		map.source = rowsOf(destination);
+		map.sourceBytes = Image::CHANNELS * map.sampleSize;
+		map.planes[0] = rowsOf(source);
+		map.planeCount = 1;
+		map.destination = map.source;
+		map.destinationBytes = map.sourceBytes;
+		for (int byte = 0; byte < map.destinationBytes; byte++)
+			map.codes[byte] = byte / map.sampleSize == channel ? PLANE_BYTE + byte % map.sampleSize : byte;
+
+		mapChannels(map, policy);
+		return true;
+	}
+
+	bool mergeChannels(const std::vector<ImageViewGray>& planes, const ImageView& destination, ExecutionPolicy policy) {
+		// Error check
+		if (!destination.hasData() || planes.size() != static_cast<size_t>(destination.channels) || planes.size() > static_cast<size_t>(MAXIMUM_PLANES))
+			return false;
+		for (const ImageViewGray& plane : planes)
+			if (!plane.hasData() || plane.width != destination.width || plane.height != destination.height)
+				return false;
+
+		ChannelMap map;
+		map.width = destination.width;
+		map.height = destination.height;
+		for (int plane = 0; plane < destination.channels; plane++) {
+			map.planes[plane] = { planes[plane].data, planes[plane].stride };
+			map.codes[plane] = PLANE_BYTE + 2 * plane;
+		}
+		map.planeCount = destination.channels;
+		map.destination = { destination.data, destination.stride };
+		map.destinationBytes = destination.channels;
+
+		mapChannels(map, policy);
+		return true;
+	}
+	bool mergeAlpha(const ImageView& color, const ImageViewGray& alpha, const ImageView& destination, ExecutionPolicy policy) {
+		// Error check
+		if (!color.hasData() || !alpha.hasData() || !destination.hasData())
+			return false;
+		if ((color.channels != 1 && color.channels != 3) || destination.channels != color.channels + 1)
+			return false;
+		if (color.width != alpha.width || color.height != alpha.height || color.width != destination.width || color.height != destination.height)
+			return false;
+
+		ChannelMap map;
+		map.width = color.width;
+		map.height = color.height;
+		map.source = { color.data, color.stride };
+		map.sourceBytes = color.channels;
+		map.planes[0] = { alpha.data, alpha.stride };
+		map.planeCount = 1;
+		map.destination = { destination.data, destination.stride };
+		map.destinationBytes = destination.channels;
+		for (int byte = 0; byte < color.channels; byte++)
+			map.codes[byte] = byte;
+		map.codes[color.channels] = PLANE_BYTE;
+
+		mapChannels(map, policy);
+		return true;
+	}
+	bool mergeAlpha(const ImageViewRGB& color, const ImageViewGray& alpha, ImageRGBA& destination, ExecutionPolicy policy) {
+		// Error check
+		if (!color.hasData())
+			return false;
+
+		if (destination.allocate(color.width, color.height) == nullptr)
+			return false;
+		return mergeAlpha(ImageView(reinterpret_cast<unsigned char*>(color.data), color.width, color.height, 3, color.stride), alpha, ImageView(destination), policy);
+	}
+
+#define IT_CHANNELS_INSTANTIATE(Image) \
+	template bool swizzleChannels<Image>(Image&, const std::array<int, 4>&, ExecutionPolicy); \
+	template bool extractChannel<Image>(const Image&, int, GrayImageOf<Image>&, ExecutionPolicy); \
+	template bool insertChannel<Image>(const GrayImageOf<Image>&, Image&, int, ExecutionPolicy);
+
+	IT_CHANNELS_INSTANTIATE(ImageGray)
+	IT_CHANNELS_INSTANTIATE(ImageGrayAlpha)
+	IT_CHANNELS_INSTANTIATE(ImageRGB)
+	IT_CHANNELS_INSTANTIATE(ImageRGBA)
+	IT_CHANNELS_INSTANTIATE(ImageGray16)
+	IT_CHANNELS_INSTANTIATE(ImageGrayAlpha16)
+	IT_CHANNELS_INSTANTIATE(ImageRGB16)
+	IT_CHANNELS_INSTANTIATE(ImageRGBA16)
+
+#undef IT_CHANNELS_INSTANTIATE
+}
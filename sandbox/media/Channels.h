@@ -0,0 +1,54 @@
+#pragma once
+
+// Dependencies | std
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Dependencies | core
+#include <core/Parallel.h>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Properties
+	// Channel indices of a swizzle order that stand for a constant instead of a source channel
+	constexpr int CHANNEL_ZERO{ -1 };	// Every sample 0
+	constexpr int CHANNEL_MAX{ -2 };	// Every sample at its largest value (opaque alpha)
+
+	// Gray image class with the sample size of Image
+	template<IsImage Image>
+	using GrayImageOf = std::conditional_t<sizeof(*std::declval<Image>().getData()) == Image::CHANNELS, ImageGray, ImageGray16>;
+
+	// Functions | channels
+	// Every operation maps the bytes of 16 pixels at a time with SSSE3 byte shuffles (one shuffle per pair of input and
+	// output registers that share samples, ORed together), so any order and channel count runs the same kernel; 16-bit
+	// samples move as byte pairs. Rows run in parallel. Sources and destinations have the same size.
+
+	// Destination channel i takes source channel order[i] (or a constant); order entries past the destination channel
+	// count are ignored. Destination may be source when both have the same channel count: RGBA to BGRA is
+	// swizzleChannels(image, image, { 2, 1, 0, 3 }).
+	bool swizzleChannels(const ImageView& source, const ImageView& destination, const std::array<int, 4>& order, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	template<IsImage Image>
+	bool swizzleChannels(Image& image, const std::array<int, 4>& order, ExecutionPolicy policy = ExecutionPolicy::PARALLEL); // In place
+
+	// One channel to a gray image ((re)allocated by the overloads taking an image)
+	bool extractChannel(const ImageView& source, int channel, const ImageViewGray& destination, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	bool extractChannel(const ImageView& source, int channel, ImageGray& destination, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	template<IsImage Image>
+	bool extractChannel(const Image& source, int channel, GrayImageOf<Image>& destination, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+
+	// A gray image into one channel of destination, in place; the other channels are kept
+	bool insertChannel(const ImageViewGray& source, const ImageView& destination, int channel, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	template<IsImage Image>
+	bool insertChannel(const GrayImageOf<Image>& source, Image& destination, int channel, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+
+	// One gray plane per destination channel, in order
+	bool mergeChannels(const std::vector<ImageViewGray>& planes, const ImageView& destination, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	// Gray or RGB color with a separate alpha (for instance a mask) into gray alpha or RGBA ((re)allocated by the
+	// overload taking an image)
+	bool mergeAlpha(const ImageView& color, const ImageViewGray& alpha, const ImageView& destination, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	bool mergeAlpha(const ImageViewRGB& color, const ImageViewGray& alpha, ImageRGBA& destination, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+}
@@ -0,0 +1,324 @@
+#include "Comparison.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Dependencies | core
+#include <core/Parallel.h>
+#include <core/Simd.h>
+
+// Dependencies | media
+#include <media/Samples.h>
+
+namespace it {
+	namespace {
+		// Rows per parallel band
+		constexpr int BAND_ROWS{ 32 };
+		// Rows per parallel range of the equality check
+		constexpr int EQUALITY_GRAIN{ 16 };
+		// Window sums of the SSIM tables: the two images, their squares and their product
+		constexpr int SSIM_SUMS{ 5 };
+
+		template<typename Sample>
+		bool comparable(const Samples<Sample>& first, const Samples<Sample>& second) {
+			if (first.data == nullptr || second.data == nullptr || first.width <= 0 || first.height <= 0)
+				return false;
+			if (first.channels < 1 || first.channels > 4)
+				return false;
+			return first.width == second.width && first.height == second.height && first.channels == second.channels;
+		}
+
+		// Offset of the first differing byte at or after begin, or end if there is none
+		size_t firstDifference(const unsigned char* first, const unsigned char* second, size_t begin, size_t end) {
+			size_t offset = begin;
+#if defined(IT_SIMD_SSE2)
+			const auto load = [](const unsigned char* bytes) {
+				return _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+			};
+			// 64 bytes folded into one test, then 16 bytes at a time to find the block
+			for (; offset + 64 <= end; offset += 64) {
+				const __m128i low = _mm_or_si128(_mm_xor_si128(load(first + offset), load(second + offset)), _mm_xor_si128(load(first + offset + 16), load(second + offset + 16)));
+				const __m128i high = _mm_or_si128(_mm_xor_si128(load(first + offset + 32), load(second + offset + 32)), _mm_xor_si128(load(first + offset + 48), load(second + offset + 48)));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(low, high), _mm_setzero_si128())) != 0xFFFF)
+					break;
+			}
+			for (; offset + 16 <= end; offset += 16) {
+				const int equal = _mm_movemask_epi8(_mm_cmpeq_epi8(load(first + offset), load(second + offset)));
+				if (equal != 0xFFFF)
+					return offset + static_cast<size_t>(std::countr_one(static_cast<unsigned int>(equal)));
+			}
+#endif
+			for (; offset < end; offset++)
+				if (first[offset] != second[offset])
+					return offset;
+			return end;
+		}
+
+		template<typename Sample>
+		bool samplesEqual(const Samples<Sample>& first, const Samples<Sample>& second) {
+			// Error check
+			if (!comparable(first, second))
+				return false;
+
+			const size_t rowBytes = first.rowBytes();
+			std::atomic<bool> differs{ false };
+			parallelFor(0, first.height, [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd && !differs.load(std::memory_order_relaxed); y++) {
+					const unsigned char* firstRow = reinterpret_cast<const unsigned char*>(first.row(y));
+					const unsigned char* secondRow = reinterpret_cast<const unsigned char*>(second.row(y));
+					if (firstDifference(firstRow, secondRow, 0ULL, rowBytes) != rowBytes)
+						differs.store(true, std::memory_order_relaxed);
+				}
+			}, EQUALITY_GRAIN);
+			return !differs.load();
+		}
+
+		// Faded gray copy of the first image, the background of the highlight image
+		template<typename Sample>
+		void fadeRow(const Sample* samples, int width, int channels, glm::u8vec4* destination) {
+			constexpr int SHIFT = sizeof(Sample) == 1 ? 0 : 8;
+			for (int x = 0; x < width; x++, samples += channels) {
+				const int luma = channels >= 3 ? ((samples[0] >> SHIFT) * 77 + (samples[1] >> SHIFT) * 150 + (samples[2] >> SHIFT) * 29) >> 8 : samples[0] >> SHIFT;
+				const unsigned char value = static_cast<unsigned char>(191 + luma / 4);
+				destination[x] = glm::u8vec4(value, value, value, 255);
+			}
+		}
+
+		template<typename Sample>
+		bool compareSamples(const Samples<Sample>& first, const Samples<Sample>& second, ImageDifference& difference, ImageRGBA* highlight, int tolerance) {
+			// Error check
+			if (!comparable(first, second) || tolerance < 0)
+				return false;
+			if (highlight != nullptr && (highlight->getWidth() != first.width || highlight->getHeight() != first.height) && highlight->allocate(first.width, first.height) == nullptr)
+				return false;
+
+			struct Partial {
+				bool identical{ true };
+				unsigned long long differingPixels{ 0 };
+				int left{ std::numeric_limits<int>::max() };
+				int top{ std::numeric_limits<int>::max() };
+				int right{ -1 };
+				int bottom{ -1 };
+				std::array<int, 4> maximum{};
+				std::array<unsigned long long, 4> squares{};
+			};
+
+			const int channels = first.channels;
+			const size_t pixelBytes = static_cast<size_t>(channels) * sizeof(Sample);
+			const size_t rowBytes = first.rowBytes();
+			Partial total{};
+			std::mutex mergeMutex{};
+			parallelForBands(0, first.height, [&](int rowBegin, int rowEnd) {
+				Partial partial{};
+				for (int y = rowBegin; y < rowEnd; y++) {
+					const Sample* firstSamples = first.row(y);
+					const Sample* secondSamples = second.row(y);
+					glm::u8vec4* marked = nullptr;
+					if (highlight != nullptr) {
+						marked = reinterpret_cast<glm::u8vec4*>(highlight->getData()) + static_cast<size_t>(y) * static_cast<size_t>(first.width);
+						fadeRow(firstSamples, first.width, channels, marked);
+					}
+
+					// Jumps from one differing pixel to the next, over equal blocks
+					const unsigned char* firstBytes = reinterpret_cast<const unsigned char*>(firstSamples);
+					const unsigned char* secondBytes = reinterpret_cast<const unsigned char*>(secondSamples);
+					for (size_t offset = firstDifference(firstBytes, secondBytes, 0ULL, rowBytes); offset < rowBytes; offset = firstDifference(firstBytes, secondBytes, offset, rowBytes)) {
+						const int x = static_cast<int>(offset / pixelBytes);
+						partial.identical = false;
+						bool differs = false;
+						for (int channel = 0; channel < channels; channel++) {
+							const int delta = std::abs(static_cast<int>(firstSamples[x * channels + channel]) - static_cast<int>(secondSamples[x * channels + channel]));
+							partial.squares[channel] += static_cast<unsigned long long>(delta) * static_cast<unsigned long long>(delta);
+							partial.maximum[channel] = std::max(partial.maximum[channel], delta);
+							differs |= delta > tolerance;
+						}
+						if (differs) {
+							partial.differingPixels++;
+							partial.left = std::min(partial.left, x);
+							partial.right = std::max(partial.right, x);
+							partial.top = std::min(partial.top, y);
+							partial.bottom = y;
+							if (marked != nullptr)
+								marked[x] = glm::u8vec4(255, 0, 0, 255);
+						}
+						offset = static_cast<size_t>(x + 1) * pixelBytes;
+					}
+				}
+
+				std::lock_guard<std::mutex> lock(mergeMutex);
+				total.identical &= partial.identical;
+				total.differingPixels += partial.differingPixels;
+				total.left = std::min(total.left, partial.left);
+				total.top = std::min(total.top, partial.top);
+				total.right = std::max(total.right, partial.right);
+				total.bottom = std::max(total.bottom, partial.bottom);
+				for (int channel = 0; channel < channels; channel++) {
+					total.maximum[channel] = std::max(total.maximum[channel], partial.maximum[channel]);
+					total.squares[channel] += partial.squares[channel];
+				}
+			}, BAND_ROWS);
+
+			difference = ImageDifference{};
+			difference.channels = channels;
+			difference.identical = total.identical;
+			difference.differingPixels = total.differingPixels;
+			if (total.differingPixels > 0ULL)
+				difference.bounds = { { total.left, total.top }, { total.right - total.left + 1, total.bottom - total.top + 1 } };
+
+			const double pixels = static_cast<double>(first.width) * static_cast<double>(first.height);
+			unsigned long long squares{ 0ULL };
+			for (int channel = 0; channel < channels; channel++) {
+				difference.maximumDifference[channel] = total.maximum[channel];
+				difference.meanSquaredError[channel] = static_cast<double>(total.squares[channel]) / pixels;
+				squares += total.squares[channel];
+			}
+			difference.totalMeanSquaredError = static_cast<double>(squares) / (pixels * channels);
+			const double peak = static_cast<double>(std::numeric_limits<Sample>::max());
+			difference.psnr = squares == 0ULL ? std::numeric_limits<double>::infinity() : 10.0 * std::log10(peak * peak / difference.totalMeanSquaredError);
+			return true;
+		}
+
+		// Sums wrap around in unsigned arithmetic; window sums are still exact as long as they fit (8-bit samples in
+		// 32 bits, 16-bit samples in 64 bits)
+		template<typename Sample, typename Sum>
+		bool ssimOf(const Samples<Sample>& first, const Samples<Sample>& second, double& ssim, int windowSize) {
+			// Error check
+			if (!comparable(first, second) || windowSize < 1)
+				return false;
+
+			const int window = std::min({ windowSize, first.width, first.height });
+			const int channels = first.channels;
+			const int windowsX = first.width - window + 1;
+			const int windowsY = first.height - window + 1;
+			const size_t tableRow = static_cast<size_t>(first.width + 1) * static_cast<size_t>(channels) * SSIM_SUMS;
+			const double peak = static_cast<double>(std::numeric_limits<Sample>::max());
+			const double c1 = (0.01 * peak) * (0.01 * peak);
+			const double c2 = (0.03 * peak) * (0.03 * peak);
+			const double inverseArea = 1.0 / (static_cast<double>(window) * static_cast<double>(window));
+
+			double total{ 0.0 };
+			std::mutex mergeMutex{};
+			parallelForBands(0, windowsY, [&](int rowBegin, int rowEnd) {
+				// Summed-area rows relative to the top of the band, window + 1 of them in a ring
+				std::vector<Sum> ring(tableRow * static_cast<size_t>(window + 1), Sum{ 0 });
+				const auto tableAt = [&](int row) {
+					return ring.data() + static_cast<size_t>(row % (window + 1)) * tableRow;
+				};
+				const auto accumulate = [&](int row) {
+					const Sum* above = tableAt(row - rowBegin);
+					Sum* below = tableAt(row - rowBegin + 1);
+					const Sample* firstSamples = first.row(row);
+					const Sample* secondSamples = second.row(row);
+					std::fill(below, below + static_cast<size_t>(channels) * SSIM_SUMS, Sum{ 0 });
+					std::array<Sum, 4 * SSIM_SUMS> running{};
+					for (int x = 0; x < first.width; x++) {
+						for (int channel = 0; channel < channels; channel++) {
+							const Sum a = firstSamples[x * channels + channel];
+							const Sum b = secondSamples[x * channels + channel];
+							Sum* sums = running.data() + channel * SSIM_SUMS;
+							sums[0] += a;
+							sums[1] += b;
+							sums[2] += a * a;
+							sums[3] += b * b;
+							sums[4] += a * b;
+							const size_t index = (static_cast<size_t>(x + 1) * static_cast<size_t>(channels) + static_cast<size_t>(channel)) * SSIM_SUMS;
+							for (int sum = 0; sum < SSIM_SUMS; sum++)
+								below[index + sum] = above[index + sum] + sums[sum];
+						}
+					}
+				};
+
+				for (int row = rowBegin; row < rowBegin + window - 1; row++)
+					accumulate(row);
+				double partial{ 0.0 };
+				for (int y = rowBegin; y < rowEnd; y++) {
+					accumulate(y + window - 1);
+					const Sum* top = tableAt(y - rowBegin);
+					const Sum* bottom = tableAt(y - rowBegin + window);
+					for (int x = 0; x < windowsX; x++) {
+						for (int channel = 0; channel < channels; channel++) {
+							const size_t left = (static_cast<size_t>(x) * static_cast<size_t>(channels) + static_cast<size_t>(channel)) * SSIM_SUMS;
+							const size_t right = left + static_cast<size_t>(window) * static_cast<size_t>(channels) * SSIM_SUMS;
+							std::array<double, SSIM_SUMS> sums{};
+							for (int sum = 0; sum < SSIM_SUMS; sum++)
+								sums[sum] = static_cast<double>(static_cast<Sum>(bottom[right + sum] - bottom[left + sum] - top[right + sum] + top[left + sum]));
+
+							const double meanA = sums[0] * inverseArea;
+							const double meanB = sums[1] * inverseArea;
+							const double varianceA = sums[2] * inverseArea - meanA * meanA;
+							const double varianceB = sums[3] * inverseArea - meanB * meanB;
+							const double covariance = sums[4] * inverseArea - meanA * meanB;
+							partial += ((2.0 * meanA * meanB + c1) * (2.0 * covariance + c2)) / ((meanA * meanA + meanB * meanB + c1) * (varianceA + varianceB + c2));
+						}
+					}
+				}
+
+				std::lock_guard<std::mutex> lock(mergeMutex);
+				total += partial;
+			}, BAND_ROWS);
+
+			ssim = total / (static_cast<double>(windowsX) * static_cast<double>(windowsY) * channels);
+			return true;
+		}
+	}
+
+	// Functions | comparison
+	bool imagesEqual(const ImageView& first, const ImageView& second) {
+		return samplesEqual(samplesOf(first), samplesOf(second));
+	}
+	template<IsImage Image>
+	bool imagesEqual(const Image& first, const Image& second) {
+		return samplesEqual(samplesOf(first), samplesOf(second));
+	}
+
+	bool compareImages(const ImageView& first, const ImageView& second, ImageDifference& difference, int tolerance) {
+		return compareSamples(samplesOf(first), samplesOf(second), difference, nullptr, tolerance);
+	}
+	bool compareImages(const ImageView& first, const ImageView& second, ImageDifference& difference, ImageRGBA& highlight, int tolerance) {
+		return compareSamples(samplesOf(first), samplesOf(second), difference, &highlight, tolerance);
+	}
+	template<IsImage Image>
+	bool compareImages(const Image& first, const Image& second, ImageDifference& difference, int tolerance) {
+		return compareSamples(samplesOf(first), samplesOf(second), difference, nullptr, tolerance);
+	}
+	template<IsImage Image>
+	bool compareImages(const Image& first, const Image& second, ImageDifference& difference, ImageRGBA& highlight, int tolerance) {
+		return compareSamples(samplesOf(first), samplesOf(second), difference, &highlight, tolerance);
+	}
+
+	bool computeSSIM(const ImageView& first, const ImageView& second, double& ssim, int windowSize) {
+		return ssimOf<unsigned char, std::uint32_t>(samplesOf(first), samplesOf(second), ssim, windowSize);
+	}
+	template<IsImage Image>
+	bool computeSSIM(const Image& first, const Image& second, double& ssim, int windowSize) {
+		using Sample = SampleOf<Image>;
+		return ssimOf<Sample, std::conditional_t<sizeof(Sample) == 1, std::uint32_t, std::uint64_t>>(samplesOf(first), samplesOf(second), ssim, windowSize);
+	}
+
+#define IT_COMPARISON_INSTANTIATE(Image) \
+	template bool imagesEqual<Image>(const Image&, const Image&); \
+	template bool compareImages<Image>(const Image&, const Image&, ImageDifference&, int); \
+	template bool compareImages<Image>(const Image&, const Image&, ImageDifference&, ImageRGBA&, int); \
+	template bool computeSSIM<Image>(const Image&, const Image&, double&, int);
+
+	IT_COMPARISON_INSTANTIATE(ImageGray)
+	IT_COMPARISON_INSTANTIATE(ImageGrayAlpha)
+	IT_COMPARISON_INSTANTIATE(ImageRGB)
+	IT_COMPARISON_INSTANTIATE(ImageRGBA)
+	IT_COMPARISON_INSTANTIATE(ImageGray16)
+	IT_COMPARISON_INSTANTIATE(ImageGrayAlpha16)
+	IT_COMPARISON_INSTANTIATE(ImageRGB16)
+	IT_COMPARISON_INSTANTIATE(ImageRGBA16)
+
+#undef IT_COMPARISON_INSTANTIATE
+}
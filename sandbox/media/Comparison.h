@@ -0,0 +1,51 @@
+#pragma once
+
+// Dependencies | std
+#include <array>
+
+// Dependencies | core
+#include <core/Rect.h>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Structs
+	struct ImageDifference {
+		// Properties
+		int channels{ 0 };
+		bool identical{ false };					// Every sample equal (regardless of the tolerance)
+		unsigned long long differingPixels{ 0 };	// Pixels with a channel differing by more than the tolerance
+		ui::Rect bounds{};							// Smallest rect holding every differing pixel, empty if there is none
+		std::array<int, 4> maximumDifference{};		// Largest absolute difference per channel
+		std::array<double, 4> meanSquaredError{};	// Per channel
+		double totalMeanSquaredError{ 0.0 };		// Over all channels
+		double psnr{ 0.0 };							// dB against the largest sample value (255 or 65535), infinite if identical
+	};
+
+	// Functions | comparison
+	// Views cover the 8-bit formats with any stride; Image is any of the 8 image classes. Both images must have the
+	// same size and channel count. Rows are compared 64 bytes at a time with SSE2 and, in parallel bands, only the
+	// 16 byte blocks that differ are looked at sample by sample, so near identical images cost little more than the
+	// equality check.
+	// Exact equality; bands stop as soon as any of them finds a difference
+	bool imagesEqual(const ImageView& first, const ImageView& second);
+	template<IsImage Image>
+	bool imagesEqual(const Image& first, const Image& second);
+
+	// Error measures, bounds of the differences and, optionally, a highlight image: differing pixels in red over a
+	// faded gray copy of the first image (allocated to the size of the images). Returns false on invalid input only.
+	bool compareImages(const ImageView& first, const ImageView& second, ImageDifference& difference, int tolerance = 0);
+	bool compareImages(const ImageView& first, const ImageView& second, ImageDifference& difference, ImageRGBA& highlight, int tolerance = 0);
+	template<IsImage Image>
+	bool compareImages(const Image& first, const Image& second, ImageDifference& difference, int tolerance = 0);
+	template<IsImage Image>
+	bool compareImages(const Image& first, const Image& second, ImageDifference& difference, ImageRGBA& highlight, int tolerance = 0);
+
+	// Structural similarity averaged over every windowSize x windowSize window (clamped to the image) and over the
+	// channels, 1 for identical images. Window sums of both images, their squares and their product come from
+	// summed-area tables kept for windowSize + 1 rows at a time, so each window takes a fixed number of lookups.
+	bool computeSSIM(const ImageView& first, const ImageView& second, double& ssim, int windowSize = 8);
+	template<IsImage Image>
+	bool computeSSIM(const Image& first, const Image& second, double& ssim, int windowSize = 8);
+}
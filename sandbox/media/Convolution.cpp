@@ -0,0 +1,365 @@
+#include "Convolution.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+// Dependencies | core
+#include <core/Parallel.h>
+#include <core/Simd.h>
+
+namespace it {
+	namespace {
+		// Output tile size; with a 7x7 kernel on RGBA the float input tile of one band stays around 100 KB
+		constexpr int TILE_WIDTH{ 128 };
+		constexpr int TILE_HEIGHT{ 32 };
+
+		// Source index for a coordinate outside 0..size - 1, or -1 for the constant border
+		int resolveIndex(int index, int size, BorderMode border) {
+			if (index >= 0 && index < size)
+				return index;
+
+			switch (border) {
+				case BorderMode::CLAMP:
+					return std::clamp(index, 0, size - 1);
+				case BorderMode::MIRROR: {
+					if (size == 1)
+						return 0;
+					const int period = 2 * (size - 1);
+					index = ((index % period) + period) % period;
+					return index < size ? index : period - index;
+				}
+				case BorderMode::WRAP:
+					return ((index % size) + size) % size;
+				default:
+					return -1;
+			}
+		}
+
+		// output[i] = sum(weights[k] * input[i + offsets[k]]); TAPS > 0 unrolls the tap loop at compile time
+		template<int TAPS>
+		void accumulate(const float* input, const int* offsets, const float* weights, int runtimeTaps, float* output, size_t count) {
+			const int taps = TAPS > 0 ? TAPS : runtimeTaps;
+			size_t i = 0ULL;
+#if defined(IT_SIMD_AVX2)
+			for (; i + 8ULL <= count; i += 8ULL) {
+				__m256 sum = _mm256_setzero_ps();
+				for (int k = 0; k < taps; k++)
+					sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(weights[k]), _mm256_loadu_ps(input + offsets[k] + i)));
+				_mm256_storeu_ps(output + i, sum);
+			}
+#endif
+#if defined(IT_SIMD_SSE2)
+			for (; i + 4ULL <= count; i += 4ULL) {
+				__m128 sum = _mm_setzero_ps();
+				for (int k = 0; k < taps; k++)
+					sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[k]), _mm_loadu_ps(input + offsets[k] + i)));
+				_mm_storeu_ps(output + i, sum);
+			}
+#endif
+			for (; i < count; i++) {
+				float sum{ 0.0f };
+				for (int k = 0; k < taps; k++)
+					sum += weights[k] * input[offsets[k] + static_cast<ptrdiff_t>(i)];
+				output[i] = sum;
+			}
+		}
+		using AccumulateFunction = void (*)(const float*, const int*, const float*, int, float*, size_t);
+		AccumulateFunction accumulateFor(int taps) {
+			switch (taps) {
+				case 3:
+					return accumulate<3>;
+				case 5:
+					return accumulate<5>;
+				case 7:
+					return accumulate<7>;
+				case 9:
+					return accumulate<9>;
+				case 25:
+					return accumulate<25>;
+				case 49:
+					return accumulate<49>;
+				default:
+					return accumulate<0>;
+			}
+		}
+
+		void storeRow(const float* values, float bias, unsigned char* destination, size_t count) {
+			size_t i = 0ULL;
+#if defined(IT_SIMD_SSE2)
+			const __m128 BIAS = _mm_set1_ps(bias);
+			for (; i + 8ULL <= count; i += 8ULL) {
+				const __m128i low = _mm_cvtps_epi32(_mm_add_ps(_mm_loadu_ps(values + i), BIAS));
+				const __m128i high = _mm_cvtps_epi32(_mm_add_ps(_mm_loadu_ps(values + i + 4ULL), BIAS));
+				const __m128i packed = _mm_packs_epi32(low, high);
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(destination + i), _mm_packus_epi16(packed, packed));
+			}
+#endif
+			for (; i < count; i++)
+				destination[i] = static_cast<unsigned char>(std::clamp(std::nearbyint(values[i] + bias), 0.0f, 255.0f));
+		}
+
+		// Alpha is the last channel; colors are kept on the 0..255 scale, times alpha / 255
+		void premultiplyRow(float* samples, int width, int channels) {
+			for (int x = 0; x < width; x++, samples += channels) {
+				const float alpha = samples[channels - 1] * (1.0f / 255.0f);
+				for (int channel = 0; channel < channels - 1; channel++)
+					samples[channel] *= alpha;
+			}
+		}
+		// Colors are bounded so that kernels with negative weights cannot overflow the conversion where alpha nearly cancels
+		void unpremultiplyRow(float* samples, int width, int channels) {
+			for (int x = 0; x < width; x++, samples += channels) {
+				const float alpha = samples[channels - 1];
+				for (int channel = 0; channel < channels - 1; channel++)
+					samples[channel] = alpha > 0.0f ? std::clamp(samples[channel] * 255.0f / alpha, -255.0f, 255.0f) : 0.0f;
+			}
+		}
+
+		struct Plan {
+			int channels{ 0 };
+			int width{ 0 };
+			int height{ 0 };
+			int left{ 0 };		// Kernel extent left / above the anchor
+			int right{ 0 };		// Kernel extent right / below the anchor
+			int top{ 0 };
+			int bottom{ 0 };
+			bool separable{ false };
+			bool premultiplied{ false };
+			std::vector<float> weights{};		// 2D weights, or horizontal followed by vertical weights
+			const ConvolutionOptions* options{ nullptr };
+		};
+
+		// Converts the source pixels a tile reads (borders resolved) into a float tile with a fixed row stride
+		void loadTile(const unsigned char* source, size_t sourceStride, const Plan& plan, int x0, int y0, int tileWidth, int tileHeight, std::vector<int>& columns, float* tile, size_t tileStride) {
+			const int channels = plan.channels;
+			const int inputWidth = tileWidth + plan.left + plan.right;
+			const int inputHeight = tileHeight + plan.top + plan.bottom;
+			const BorderMode border = plan.options->border;
+
+			const int firstColumn = x0 - plan.left;
+			const bool interior = firstColumn >= 0 && firstColumn + inputWidth <= plan.width;
+			if (!interior) {
+				columns.resize(static_cast<size_t>(inputWidth));
+				for (int x = 0; x < inputWidth; x++)
+					columns[x] = resolveIndex(firstColumn + x, plan.width, border);
+			}
+
+			for (int y = 0; y < inputHeight; y++) {
+				float* output = tile + static_cast<size_t>(y) * tileStride;
+				const int row = resolveIndex(y0 - plan.top + y, plan.height, border);
+				if (row < 0) {
+					for (int x = 0; x < inputWidth; x++) {
+						for (int channel = 0; channel < channels; channel++)
+							*output++ = plan.options->borderColor[channel];
+					}
+					continue;
+				}
+
+				const unsigned char* pixels = source + static_cast<size_t>(row) * sourceStride;
+				if (interior) {
+					const unsigned char* samples = pixels + static_cast<size_t>(firstColumn) * static_cast<size_t>(channels);
+					const size_t count = static_cast<size_t>(inputWidth) * static_cast<size_t>(channels);
+					for (size_t i = 0ULL; i < count; i++)
+						output[i] = samples[i];
+					continue;
+				}
+				for (int x = 0; x < inputWidth; x++) {
+					for (int channel = 0; channel < channels; channel++)
+						*output++ = columns[x] < 0 ? plan.options->borderColor[channel] : pixels[static_cast<size_t>(columns[x]) * channels + channel];
+				}
+			}
+
+			if (plan.premultiplied) {
+				for (int y = 0; y < inputHeight; y++)
+					premultiplyRow(tile + static_cast<size_t>(y) * tileStride, inputWidth, channels);
+			}
+		}
+
+		bool run(const unsigned char* source, size_t sourceStride, unsigned char* destination, size_t destinationStride, int width, int height, int channels, const ConvolutionKernel& kernel, const ConvolutionOptions& options) {
+			// Error check
+			if (source == nullptr || destination == nullptr || source == destination || width <= 0 || height <= 0 || !kernel.isValid())
+				return false;
+
+			Plan plan{};
+			plan.channels = channels;
+			plan.width = width;
+			plan.height = height;
+			plan.left = kernel.width / 2;
+			plan.right = kernel.width - 1 - plan.left;
+			plan.top = kernel.height / 2;
+			plan.bottom = kernel.height - 1 - plan.top;
+			plan.options = &options;
+			plan.premultiplied = options.premultiplied && (channels == 2 || channels == 4);
+
+			std::vector<float> horizontal{};
+			std::vector<float> vertical{};
+			plan.separable = (kernel.width > 1 && kernel.height > 1) && kernel.separate(horizontal, vertical);
+			if (plan.separable) {
+				plan.weights = horizontal;
+				plan.weights.insert(plan.weights.end(), vertical.begin(), vertical.end());
+			}
+			else
+				plan.weights = kernel.weights;
+
+			const size_t tileStride = static_cast<size_t>(TILE_WIDTH + kernel.width - 1) * static_cast<size_t>(channels);
+			const size_t tileRows = static_cast<size_t>(TILE_HEIGHT + kernel.height - 1);
+			const size_t outputSamples = static_cast<size_t>(TILE_WIDTH) * static_cast<size_t>(channels);
+
+			// Tap offsets in samples, relative to the top-left input sample an output sample reads
+			std::vector<int> offsets{};
+			std::vector<int> verticalOffsets{};
+			if (plan.separable) {
+				for (int x = 0; x < kernel.width; x++)
+					offsets.push_back(x * channels);
+				for (int y = 0; y < kernel.height; y++)
+					verticalOffsets.push_back(y * static_cast<int>(outputSamples));
+			}
+			else {
+				for (int y = 0; y < kernel.height; y++) {
+					for (int x = 0; x < kernel.width; x++)
+						offsets.push_back(y * static_cast<int>(tileStride) + x * channels);
+				}
+			}
+			const AccumulateFunction first = accumulateFor(static_cast<int>(offsets.size()));
+			const AccumulateFunction second = accumulateFor(static_cast<int>(verticalOffsets.size()));
+
+			const int tileRowCount = (height + TILE_HEIGHT - 1) / TILE_HEIGHT;
+			parallelForBands(0, tileRowCount, [&](int tileRowBegin, int tileRowEnd) {
+				std::vector<float> tile(tileStride * tileRows);
+				std::vector<float> intermediate(plan.separable ? outputSamples * tileRows : 0ULL);
+				std::vector<float> output(outputSamples);
+				std::vector<int> columns{};
+
+				for (int tileRow = tileRowBegin; tileRow < tileRowEnd; tileRow++) {
+					const int y0 = tileRow * TILE_HEIGHT;
+					const int tileHeight = std::min(TILE_HEIGHT, height - y0);
+					for (int x0 = 0; x0 < width; x0 += TILE_WIDTH) {
+						const int tileWidth = std::min(TILE_WIDTH, width - x0);
+						const size_t samples = static_cast<size_t>(tileWidth) * static_cast<size_t>(channels);
+						loadTile(source, sourceStride, plan, x0, y0, tileWidth, tileHeight, columns, tile.data(), tileStride);
+
+						if (plan.separable) {
+							for (int y = 0; y < tileHeight + kernel.height - 1; y++)
+								first(tile.data() + static_cast<size_t>(y) * tileStride, offsets.data(), plan.weights.data(), kernel.width, intermediate.data() + static_cast<size_t>(y) * outputSamples, samples);
+						}
+
+						for (int y = 0; y < tileHeight; y++) {
+							if (plan.separable)
+								second(intermediate.data() + static_cast<size_t>(y) * outputSamples, verticalOffsets.data(), plan.weights.data() + kernel.width, kernel.height, output.data(), samples);
+							else
+								first(tile.data() + static_cast<size_t>(y) * tileStride, offsets.data(), plan.weights.data(), static_cast<int>(offsets.size()), output.data(), samples);
+
+							if (plan.premultiplied)
+								unpremultiplyRow(output.data(), tileWidth, channels);
+							unsigned char* pixels = destination + static_cast<size_t>(y0 + y) * destinationStride + static_cast<size_t>(x0) * static_cast<size_t>(channels);
+							storeRow(output.data(), options.bias, pixels, samples);
+						}
+					}
+				}
+			}, 1);
+
+			return true;
+		}
+
+		template<typename View>
+		bool convolveView(const View& source, const View& destination, const ConvolutionKernel& kernel, const ConvolutionOptions& options) {
+			// Error check
+			if (!source.hasData() || !destination.hasData() || source.width != destination.width || source.height != destination.height || source.channels != destination.channels)
+				return false;
+
+			return run(
+				reinterpret_cast<const unsigned char*>(source.data), source.stride,
+				reinterpret_cast<unsigned char*>(destination.data), destination.stride,
+				source.width, source.height, source.channels, kernel, options
+			);
+		}
+	}
+
+	// struct ConvolutionKernel
+
+	// Object | public
+
+	// Constructors
+	ConvolutionKernel::ConvolutionKernel(int width, int height, const std::vector<float>& weights) {
+		assert(width > 0 && height > 0 && weights.size() == static_cast<size_t>(width) * static_cast<size_t>(height) && "weights must hold width * height values");
+
+		this->width = width;
+		this->height = height;
+		this->weights = weights;
+	}
+	ConvolutionKernel::ConvolutionKernel(const std::vector<float>& horizontal, const std::vector<float>& vertical) {
+		width = static_cast<int>(horizontal.size());
+		height = static_cast<int>(vertical.size());
+		weights.reserve(horizontal.size() * vertical.size());
+		for (float row : vertical) {
+			for (float column : horizontal)
+				weights.push_back(row * column);
+		}
+	}
+
+	// Functions
+	float ConvolutionKernel::at(int x, int y) const {
+		assert(x >= 0 && x < width && y >= 0 && y < height && "position is out of range");
+		return weights[static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x)];
+	}
+	bool ConvolutionKernel::isValid() const {
+		return width > 0 && height > 0 && weights.size() == static_cast<size_t>(width) * static_cast<size_t>(height);
+	}
+	bool ConvolutionKernel::separate(std::vector<float>& horizontal, std::vector<float>& vertical, float tolerance) const {
+		// Error check
+		if (!isValid())
+			return false;
+
+		// A rank one kernel is the outer product of the row and column through its largest weight
+		const size_t pivot = static_cast<size_t>(std::max_element(weights.begin(), weights.end(), [](float a, float b) { return std::fabs(a) < std::fabs(b); }) - weights.begin());
+		const float largest = weights[pivot];
+		if (largest == 0.0f)
+			return false;
+
+		const int pivotX = static_cast<int>(pivot % static_cast<size_t>(width));
+		const int pivotY = static_cast<int>(pivot / static_cast<size_t>(width));
+		std::vector<float> row(static_cast<size_t>(width));
+		std::vector<float> column(static_cast<size_t>(height));
+		for (int x = 0; x < width; x++)
+			row[x] = at(x, pivotY);
+		for (int y = 0; y < height; y++)
+			column[y] = at(pivotX, y) / largest;
+
+		const float limit = tolerance * std::fabs(largest);
+		for (int y = 0; y < height; y++) {
+			for (int x = 0; x < width; x++) {
+				if (std::fabs(at(x, y) - column[y] * row[x]) > limit)
+					return false;
+			}
+		}
+
+		horizontal = std::move(row);
+		vertical = std::move(column);
+		return true;
+	}
+
+	// Functions | convolution
+	bool convolve(const ImageView& source, const ImageView& destination, const ConvolutionKernel& kernel, const ConvolutionOptions& options) {
+		// Error check
+		if (source.channels < 1 || source.channels > 4)
+			return false;
+
+		return convolveView(source, destination, kernel, options);
+	}
+	bool convolve(const ImageViewGray& source, const ImageViewGray& destination, const ConvolutionKernel& kernel, const ConvolutionOptions& options) {
+		return convolveView(source, destination, kernel, options);
+	}
+	bool convolve(const ImageViewGrayAlpha& source, const ImageViewGrayAlpha& destination, const ConvolutionKernel& kernel, const ConvolutionOptions& options) {
+		return convolveView(source, destination, kernel, options);
+	}
+	bool convolve(const ImageViewRGB& source, const ImageViewRGB& destination, const ConvolutionKernel& kernel, const ConvolutionOptions& options) {
+		return convolveView(source, destination, kernel, options);
+	}
+	bool convolve(const ImageViewRGBA& source, const ImageViewRGBA& destination, const ConvolutionKernel& kernel, const ConvolutionOptions& options) {
+		return convolveView(source, destination, kernel, options);
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+// Dependencies | std
+#include <vector>
+
+// Dependencies | glm
+#include <glm/vec4.hpp>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Enums
+	enum class BorderMode {
+		CLAMP,		// aaa|abcd|ddd
+		MIRROR,		// cb|abcd|cb (the edge pixel is not repeated)
+		WRAP,		// cd|abcd|ab
+		CONSTANT	// Options::borderColor
+	};
+
+	// Structs
+	// Row-major weights; the anchor is the center pixel (width / 2, height / 2)
+	struct ConvolutionKernel {
+		// Properties
+		int width{ 0 };
+		int height{ 0 };
+		std::vector<float> weights{};
+
+		// Constructors
+		ConvolutionKernel() = default;
+		ConvolutionKernel(int width, int height, const std::vector<float>& weights);
+		ConvolutionKernel(const std::vector<float>& horizontal, const std::vector<float>& vertical); // Outer product
+
+		// Functions
+		float at(int x, int y) const;
+		bool isValid() const;
+		bool separate(std::vector<float>& horizontal, std::vector<float>& vertical, float tolerance = 1e-5f) const;
+	};
+
+	struct ConvolutionOptions {
+		// Properties
+		BorderMode border{ BorderMode::CLAMP };
+		glm::u8vec4 borderColor{ 0, 0, 0, 0 };	// Per channel value used by BorderMode::CONSTANT
+		float bias{ 0.0f };						// Added to every result before rounding (e.g. 128 for signed responses)
+		bool premultiplied{ false };			// Gray alpha and RGBA: filter colors premultiplied by alpha (see convolve)
+	};
+
+	// Functions | convolution
+	// Every channel (alpha included) is filtered independently and the result is rounded and clamped to 0..255. With
+	// Options::premultiplied, gray alpha and RGBA colors are multiplied by alpha in the float tiles and divided by the
+	// filtered alpha before rounding, so transparent pixels do not bleed their color into their neighbors.
+	// Separable kernels are detected and run as two 1D passes; 3, 5 and 7 tap passes and 3x3, 5x5 and 7x7 kernels use
+	// unrolled SIMD loops. Work is split into tiles that fit in L2 and spread over threads by rows of tiles.
+	// Source and destination must have the same size and must not share pixels.
+	bool convolve(const ImageView& source, const ImageView& destination, const ConvolutionKernel& kernel, const ConvolutionOptions& options = {});
+	bool convolve(const ImageViewGray& source, const ImageViewGray& destination, const ConvolutionKernel& kernel, const ConvolutionOptions& options = {});
+	bool convolve(const ImageViewGrayAlpha& source, const ImageViewGrayAlpha& destination, const ConvolutionKernel& kernel, const ConvolutionOptions& options = {});
+	bool convolve(const ImageViewRGB& source, const ImageViewRGB& destination, const ConvolutionKernel& kernel, const ConvolutionOptions& options = {});
+	bool convolve(const ImageViewRGBA& source, const ImageViewRGBA& destination, const ConvolutionKernel& kernel, const ConvolutionOptions& options = {});
+}
@@ -0,0 +1,410 @@
+#include "Dithering.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Dependencies | core
+#include <core/Simd.h>
+
+namespace it {
+	namespace {
+		// Pixels per parallel range of the ordered passes
+		constexpr int PARALLEL_GRAIN{ 65536 };
+		// Columns per wavefront tile and rows of pending error (the current row and the two below it, plus one row of
+		// slack for the row above that may still be finishing)
+		constexpr int TILE_COLUMNS{ 128 };
+		constexpr int RING_ROWS{ 4 };
+		// Color bins of the nearest palette color cache: 5 bits of red, green and blue, 4 of alpha
+		constexpr int BIN_COUNT{ 1 << 19 };
+		constexpr int WORD_BITS{ 64 };
+
+		// Classic recursive 8x8 Bayer matrix, values 0 to 63
+		constexpr std::array<unsigned char, 64> BAYER{
+			0, 32, 8, 40, 2, 34, 10, 42,
+			48, 16, 56, 24, 50, 18, 58, 26,
+			12, 44, 4, 36, 14, 46, 6, 38,
+			60, 28, 52, 20, 62, 30, 54, 22,
+			3, 35, 11, 43, 1, 33, 9, 41,
+			51, 19, 59, 27, 49, 17, 57, 25,
+			15, 47, 7, 39, 13, 45, 5, 37,
+			63, 31, 55, 23, 61, 29, 53, 21
+		};
+
+		int rowGrain(int width) {
+			return std::max(1, PARALLEL_GRAIN / std::max(1, width));
+		}
+
+		// Matrix entry as a threshold of 1 to 253 in steps of 255
+		int bayerOffset(int x, int y) {
+			return (255 * (2 * BAYER[(y & 7) * 8 + (x & 7)] + 1)) / 128;
+		}
+
+		// Evenly spaced gray values; level * 255 / (levels - 1) is rounded through a 16-bit multiply so that the SIMD
+		// and scalar paths agree
+		struct Levels {
+			// Properties
+			int steps{ 1 };
+			int scale{ 65280 };
+
+			// Constructors
+			explicit Levels(int levels) : steps(levels - 1), scale((65280 + (levels - 1) / 2) / (levels - 1)) {
+			}
+
+			// Functions
+			int nearest(int value) const {
+				return valueOf((value * steps + 127) / 255);
+			}
+			int valueOf(int level) const {
+				return (level * scale + 128) >> 8;
+			}
+		};
+
+		// Functions | ordered
+		// level = floor((value * steps + offset) / 255), with x / 255 = (x + 1 + (x >> 8)) >> 8 below 65535
+		void bayerGrayRow(const unsigned char* source, unsigned char* destination, int width, int y, const Levels& levels) {
+			int x = 0;
+#if defined(IT_SIMD_SSE2)
+			alignas(16) std::array<short, 8> offsets{};
+			for (int column = 0; column < 8; column++)
+				offsets[column] = static_cast<short>(bayerOffset(column, y));
+			const __m128i OFFSETS = _mm_load_si128(reinterpret_cast<const __m128i*>(offsets.data()));
+			const __m128i STEPS = _mm_set1_epi16(static_cast<short>(levels.steps));
+			const __m128i SCALE = _mm_set1_epi16(static_cast<short>(levels.scale));
+			const __m128i ONE = _mm_set1_epi16(1);
+			const __m128i HALF = _mm_set1_epi16(128);
+			const __m128i ZERO = _mm_setzero_si128();
+			const auto quantizeLanes = [&](__m128i values) {
+				const __m128i sums = _mm_add_epi16(_mm_mullo_epi16(values, STEPS), OFFSETS);
+				const __m128i level = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(sums, ONE), _mm_srli_epi16(sums, 8)), 8);
+				return _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(level, SCALE), HALF), 8);
+			};
+			for (; x + 16 <= width; x += 16) {
+				const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + x));
+				const __m128i low = quantizeLanes(_mm_unpacklo_epi8(pixels, ZERO));
+				const __m128i high = quantizeLanes(_mm_unpackhi_epi8(pixels, ZERO));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + x), _mm_packus_epi16(low, high));
+			}
+#endif
+			for (; x < width; x++)
+				destination[x] = static_cast<unsigned char>(levels.valueOf((source[x] * levels.steps + bayerOffset(x, y)) / 255));
+		}
+
+		// Two levels: set where value + offset >= 255
+		void bayerMaskRow(const unsigned char* source, std::uint64_t* words, int width, int y) {
+			std::array<unsigned char, 8> thresholds{};
+			for (int column = 0; column < 8; column++)
+				thresholds[column] = static_cast<unsigned char>(255 - bayerOffset(column, y));
+
+			for (int wordX = 0; wordX < width; wordX += WORD_BITS) {
+				const int count = std::min(WORD_BITS, width - wordX);
+				const unsigned char* pixels = source + wordX;
+				std::uint64_t bits = 0;
+				int x = 0;
+#if defined(IT_SIMD_SSE2)
+				const __m128i THRESHOLDS = _mm_set_epi8(
+					thresholds[7], thresholds[6], thresholds[5], thresholds[4], thresholds[3], thresholds[2], thresholds[1], thresholds[0],
+					thresholds[7], thresholds[6], thresholds[5], thresholds[4], thresholds[3], thresholds[2], thresholds[1], thresholds[0]);
+				for (; x + 16 <= count; x += 16) {
+					const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + x));
+					const int lanes = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(samples, THRESHOLDS), samples));
+					bits |= static_cast<std::uint64_t>(static_cast<unsigned int>(lanes)) << x;
+				}
+#endif
+				for (; x < count; x++)
+					if (pixels[x] >= thresholds[x & 7])
+						bits |= std::uint64_t{ 1 } << x;
+				words[wordX / WORD_BITS] = bits;
+			}
+		}
+
+		// Nearest palette color per color bin, looked up on first use; several threads may fill the same entry with
+		// the same result
+		struct NearestColors {
+			// Properties
+			const std::vector<glm::u8vec4>& palette;
+			mutable std::vector<std::atomic<short>> cache; // Palette index + 1, 0 until looked up
+
+			// Constructors
+			explicit NearestColors(const std::vector<glm::u8vec4>& palette) : palette(palette), cache(BIN_COUNT) {
+			}
+
+			// Functions
+			int nearest(const int* color) const {
+				const int bin = ((color[0] >> 3) << 14) | ((color[1] >> 3) << 9) | ((color[2] >> 3) << 4) | (color[3] >> 4);
+				const short cached = cache[bin].load(std::memory_order_relaxed);
+				if (cached != 0)
+					return cached - 1;
+
+				// Measured from the center of the bin
+				const int center[4]{ (color[0] & ~7) | 4, (color[1] & ~7) | 4, (color[2] & ~7) | 4, (color[3] & ~15) | 8 };
+				int best = 0;
+				int bestDistance = std::numeric_limits<int>::max();
+				for (size_t i = 0ULL; i < palette.size(); i++) {
+					int distance = 0;
+					for (int channel = 0; channel < 4; channel++) {
+						const int difference = center[channel] - palette[i][channel];
+						distance += difference * difference;
+					}
+					if (distance < bestDistance) {
+						bestDistance = distance;
+						best = static_cast<int>(i);
+					}
+				}
+				cache[bin].store(static_cast<short>(best + 1), std::memory_order_relaxed);
+				return best;
+			}
+		};
+
+		// The matrix shifts every channel by up to half the average palette spacing
+		void bayerPaletteRow(const glm::u8vec4* source, unsigned char* destination, int width, int y, const NearestColors& colors, int spread) {
+			std::array<int, 8> offsets{};
+			for (int column = 0; column < 8; column++)
+				offsets[column] = (bayerOffset(column, y) - 127) * spread / 255;
+
+			for (int x = 0; x < width; x++) {
+				int color[4];
+				for (int channel = 0; channel < 4; channel++)
+					color[channel] = std::clamp(source[x][channel] + offsets[x & 7], 0, 255);
+				destination[x] = static_cast<unsigned char>(colors.nearest(color));
+			}
+		}
+
+		// Structs | error diffusion kernels
+		struct Tap {
+			int dx{ 0 };
+			int dy{ 0 };
+			int weight{ 0 };
+		};
+		struct FloydSteinberg {
+			static constexpr int SHIFT{ 4 };
+			static constexpr std::array<Tap, 4> TAPS{ { { 1, 0, 7 }, { -1, 1, 3 }, { 0, 1, 5 }, { 1, 1, 1 } } };
+		};
+		struct Atkinson {
+			static constexpr int SHIFT{ 3 };
+			static constexpr std::array<Tap, 6> TAPS{ { { 1, 0, 1 }, { 2, 0, 1 }, { -1, 1, 1 }, { 0, 1, 1 }, { 1, 1, 1 }, { 0, 2, 1 } } };
+		};
+
+		// Structs | error diffusion targets
+		// load() reads the source pixel, store() quantizes the corrected value, writes it and returns the error
+		struct GrayTarget {
+			static constexpr int CHANNELS{ 1 };
+
+			// Properties
+			const ImageViewGray& source;
+			const ImageViewGray& destination;
+			std::array<unsigned char, 256> values;
+
+			// Functions
+			void load(int x, int y, int* value) const {
+				value[0] = source.row(y)[x];
+			}
+			void store(int x, int y, const int* value, int* error) const {
+				const int clamped = std::clamp(value[0], 0, 255);
+				destination.row(y)[x] = values[clamped];
+				error[0] = clamped - values[clamped];
+			}
+		};
+		struct MaskTarget {
+			static constexpr int CHANNELS{ 1 };
+
+			// Properties
+			const ImageViewGray& source;
+			ImageMask& destination;
+
+			// Functions
+			void load(int x, int y, int* value) const {
+				value[0] = source.row(y)[x];
+			}
+			void store(int x, int y, const int* value, int* error) const {
+				// Branchless: dithered bits are as unpredictable as it gets
+				const int clamped = std::clamp(value[0], 0, 255);
+				const int bit = clamped >> 7;
+				destination.row(y)[x / WORD_BITS] |= static_cast<std::uint64_t>(bit) << (x % WORD_BITS);
+				error[0] = clamped - 255 * bit;
+			}
+		};
+		struct PaletteTarget {
+			static constexpr int CHANNELS{ 4 };
+
+			// Properties
+			const ImageViewRGBA& source;
+			ImageIndexed& destination;
+			const NearestColors& colors;
+
+			// Functions
+			void load(int x, int y, int* value) const {
+				const glm::u8vec4 pixel = source.row(y)[x];
+				for (int channel = 0; channel < 4; channel++)
+					value[channel] = pixel[channel];
+			}
+			void store(int x, int y, const int* value, int* error) const {
+				int clamped[4];
+				for (int channel = 0; channel < 4; channel++)
+					clamped[channel] = std::clamp(value[channel], 0, 255);
+				const int index = colors.nearest(clamped);
+				destination.setIndex(x, y, static_cast<unsigned char>(index));
+				for (int channel = 0; channel < 4; channel++)
+					error[channel] = clamped[channel] - destination.getPalette()[index][channel];
+			}
+		};
+
+		// Wavefront over tiles of columns: rows are claimed in order and tile t of a row waits until the row above has
+		// finished tile t + 1, which covers every tap of both kernels. Pending errors are kept scaled by 2^SHIFT in a
+		// ring of rows and cleared as they are read, so a slot is free again by the time a row two below writes to it.
+		template<class Kernel, class Target>
+		void diffuseErrors(const Target& target, int width, int height, bool serpentine, ExecutionPolicy policy) {
+			constexpr int CHANNELS = Target::CHANNELS;
+			const int tileCount = (width + TILE_COLUMNS - 1) / TILE_COLUMNS;
+			const size_t slotSize = static_cast<size_t>(width) * CHANNELS;
+			std::vector<int> errors(slotSize * RING_ROWS, 0);
+			std::vector<std::atomic<int>> progress(static_cast<size_t>(height)); // Finished tiles per row
+			std::atomic<int> nextRow{ 0 };
+
+			const auto work = [&](int, int) {
+				for (int y = nextRow.fetch_add(1); y < height; y = nextRow.fetch_add(1)) {
+					const bool reversed = serpentine && (y & 1) != 0;
+					const int direction = reversed ? -1 : 1;
+					// Pending error of this row and the two below it
+					std::array<int*, 3> rows{};
+					for (int dy = 0; dy < 3; dy++)
+						rows[dy] = errors.data() + static_cast<size_t>((y + dy) % RING_ROWS) * slotSize;
+					const int lastRow = std::min(2, height - 1 - y);
+
+					for (int tile = 0; tile < tileCount; tile++) {
+						if (y > 0) {
+							const int needed = std::min(tile + 2, tileCount);
+							while (progress[y - 1].load(std::memory_order_acquire) < needed)
+								std::this_thread::yield();
+						}
+
+						const int tileBegin = tile * TILE_COLUMNS;
+						const int tileEnd = std::min(width, tileBegin + TILE_COLUMNS);
+						// Taps reach at most 2 pixels sideways, so away from the tile edges only the rows need checking
+						const auto diffusePixel = [&](int x, auto bounded) {
+							int* pending = rows[0] + static_cast<size_t>(x) * CHANNELS;
+							int value[CHANNELS];
+							target.load(x, y, value);
+							for (int channel = 0; channel < CHANNELS; channel++) {
+								value[channel] += (pending[channel] + (1 << (Kernel::SHIFT - 1))) >> Kernel::SHIFT;
+								pending[channel] = 0;
+							}
+
+							int error[CHANNELS];
+							target.store(x, y, value, error);
+							for (const Tap& tap : Kernel::TAPS) {
+								const int tapX = x + direction * tap.dx;
+								int tapRow = tap.dy;
+								if constexpr (decltype(bounded)::value) {
+									// Going back into a finished tile of this row
+									if (tap.dy == 0 && tapX < tileBegin)
+										tapRow = 1;
+									if (tapX < 0 || tapX >= width)
+										continue;
+								}
+								if (tapRow > lastRow)
+									continue;
+
+								int* destination = rows[tapRow] + static_cast<size_t>(tapX) * CHANNELS;
+								for (int channel = 0; channel < CHANNELS; channel++)
+									destination[channel] += error[channel] * tap.weight;
+							}
+						};
+						for (int i = tileBegin; i < tileEnd; i++) {
+							const int x = reversed ? tileBegin + tileEnd - 1 - i : i;
+							if (x >= tileBegin + 2 && x < tileEnd - 2)
+								diffusePixel(x, std::false_type{});
+							else
+								diffusePixel(x, std::true_type{});
+						}
+						progress[y].store(tile + 1, std::memory_order_release);
+					}
+				}
+			};
+
+			if (policy == ExecutionPolicy::PARALLEL && height > 1)
+				parallelFor(0, hardwareThreadCount(), work, 1, policy);
+			else
+				work(0, 1);
+		}
+
+		template<class Target>
+		void diffuse(const Target& target, int width, int height, const DitherOptions& options) {
+			if (options.method == DitherMethod::ATKINSON)
+				diffuseErrors<Atkinson>(target, width, height, options.serpentine, options.policy);
+			else
+				diffuseErrors<FloydSteinberg>(target, width, height, options.serpentine, options.policy);
+		}
+	}
+
+	// Functions | dithering
+	bool dither(const ImageViewGray& source, const ImageViewGray& destination, int levels, const DitherOptions& options) {
+		// Error check
+		if (!source.hasData() || !destination.hasData())
+			return false;
+		if (source.width != destination.width || source.height != destination.height)
+			return false;
+		if (levels < 2 || levels > 256)
+			return false;
+
+		const Levels spacing(levels);
+		if (options.method == DitherMethod::BAYER) {
+			parallelFor(0, source.height, [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd; y++)
+					bayerGrayRow(source.row(y), destination.row(y), source.width, y, spacing);
+			}, rowGrain(source.width), options.policy);
+			return true;
+		}
+
+		GrayTarget target{ source, destination, {} };
+		for (int value = 0; value < 256; value++)
+			target.values[value] = static_cast<unsigned char>(spacing.nearest(value));
+		diffuse(target, source.width, source.height, options);
+		return true;
+	}
+	bool dither(const ImageViewGray& source, ImageMask& destination, const DitherOptions& options) {
+		// Error check
+		if (!source.hasData())
+			return false;
+		if (destination.allocate(source.width, source.height) == nullptr)
+			return false;
+
+		if (options.method == DitherMethod::BAYER) {
+			parallelFor(0, source.height, [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd; y++)
+					bayerMaskRow(source.row(y), destination.row(y), source.width, y);
+			}, rowGrain(source.width), options.policy);
+			return true;
+		}
+
+		diffuse(MaskTarget{ source, destination }, source.width, source.height, options);
+		return true;
+	}
+	bool dither(const ImageViewRGBA& source, ImageIndexed& destination, const DitherOptions& options) {
+		// Error check
+		if (!source.hasData() || destination.getPalette().empty())
+			return false;
+		if ((destination.getWidth() != source.width || destination.getHeight() != source.height) && destination.allocate(source.width, source.height) == nullptr)
+			return false;
+
+		const NearestColors colors(destination.getPalette());
+		if (options.method == DitherMethod::BAYER) {
+			const int spread = static_cast<int>(255.0 / std::cbrt(static_cast<double>(destination.getPalette().size())) + 0.5);
+			parallelFor(0, source.height, [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd; y++)
+					bayerPaletteRow(source.row(y), destination.getData() + static_cast<size_t>(y) * static_cast<size_t>(source.width), source.width, y, colors, spread);
+			}, rowGrain(source.width), options.policy);
+			return true;
+		}
+
+		diffuse(PaletteTarget{ source, destination, colors }, source.width, source.height, options);
+		return true;
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+// Dependencies | core
+#include <core/Parallel.h>
+
+// Dependencies | media
+#include <media/Image.h>
+#include <media/ImageMask.h>
+
+namespace it {
+	// Enums
+	enum class DitherMethod {
+		BAYER,				// Ordered, 8x8 threshold matrix; every pixel is independent
+		FLOYD_STEINBERG,	// Error diffusion to 4 neighbors (7, 3, 5 and 1 sixteenths)
+		ATKINSON			// Error diffusion of 6 eighths to 6 neighbors over two rows, keeps more contrast
+	};
+
+	// Structs
+	struct DitherOptions {
+		// Properties
+		DitherMethod method{ DitherMethod::FLOYD_STEINBERG };
+		bool serpentine{ true };	// Error diffusion alternates the scan direction every row
+		ExecutionPolicy policy{ ExecutionPolicy::PARALLEL };
+	};
+
+	// Functions | dithering
+	// Bayer dithering runs 16 pixels per SSE2 step for gray and 1-bit outputs. Error diffusion keeps only a rolling
+	// buffer of four rows of pending errors and runs as a wavefront: rows are split into tiles of 128 columns and a
+	// row may start a tile as soon as the row above has finished the next one, so one row per thread is in flight.
+	// With a serpentine scan the direction alternates within every tile; error that would flow back into a finished
+	// tile goes to the pixel below instead.
+	// Gray to levels evenly spaced gray values (2 to 256); destination has the size of the source and may be the source
+	bool dither(const ImageViewGray& source, const ImageViewGray& destination, int levels, const DitherOptions& options = {});
+	// Gray to 1 bit (set is white); the mask is (re)allocated to the size of the source
+	bool dither(const ImageViewGray& source, ImageMask& destination, const DitherOptions& options = {});
+	// RGBA to the palette of destination (for instance from quantize()); destination is (re)allocated to the size of
+	// the source and keeps its palette. Nearest colors are cached per 5-5-5-4 bit color bin.
+	bool dither(const ImageViewRGBA& source, ImageIndexed& destination, const DitherOptions& options = {});
+}
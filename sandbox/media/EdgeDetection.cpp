@@ -0,0 +1,378 @@
+#include "EdgeDetection.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Dependencies | core
+#include <core/Parallel.h>
+#include <core/Simd.h>
+
+namespace it {
+	namespace {
+		// Rows per parallel band
+		constexpr int BAND_ROWS{ 32 };
+
+		// Outer and center weights of the smoothing half of the operator
+		struct Weights {
+			short outer{ 0 };
+			short center{ 0 };
+		};
+		Weights weightsOf(GradientOperator gradientOperator) {
+			return gradientOperator == GradientOperator::SCHARR ? Weights{ 3, 10 } : Weights{ 1, 2 };
+		}
+
+		// Derivatives of one row from the rows above, at and below it. The vertical half of both operators is done
+		// first into two padded scratch rows (smoothed and differenced), the horizontal half then reads them shifted.
+		void gradientRow(const unsigned char* above, const unsigned char* center, const unsigned char* below, int width, Weights weights, short* smoothed, short* differenced, short* dx, short* dy) {
+			int x = 0;
+#if defined(IT_SIMD_SSE2)
+			const __m128i ZERO = _mm_setzero_si128();
+			const __m128i OUTER = _mm_set1_epi16(weights.outer);
+			const __m128i CENTER = _mm_set1_epi16(weights.center);
+			for (; x + 8 <= width; x += 8) {
+				const __m128i top = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(above + x)), ZERO);
+				const __m128i middle = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(center + x)), ZERO);
+				const __m128i bottom = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(below + x)), ZERO);
+				const __m128i smooth = _mm_add_epi16(_mm_mullo_epi16(_mm_add_epi16(top, bottom), OUTER), _mm_mullo_epi16(middle, CENTER));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(smoothed + x + 1), smooth);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(differenced + x + 1), _mm_sub_epi16(bottom, top));
+			}
+#endif
+			for (; x < width; x++) {
+				smoothed[x + 1] = static_cast<short>(weights.outer * (above[x] + below[x]) + weights.center * center[x]);
+				differenced[x + 1] = static_cast<short>(below[x] - above[x]);
+			}
+			smoothed[0] = smoothed[1];
+			smoothed[width + 1] = smoothed[width];
+			differenced[0] = differenced[1];
+			differenced[width + 1] = differenced[width];
+
+			x = 0;
+#if defined(IT_SIMD_SSE2)
+			for (; x + 8 <= width; x += 8) {
+				const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(smoothed + x));
+				const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(smoothed + x + 2));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dx + x), _mm_sub_epi16(right, left));
+
+				const __m128i outer = _mm_add_epi16(
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(differenced + x)),
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(differenced + x + 2))
+				);
+				const __m128i middle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(differenced + x + 1));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dy + x), _mm_add_epi16(_mm_mullo_epi16(outer, OUTER), _mm_mullo_epi16(middle, CENTER)));
+			}
+#endif
+			for (; x < width; x++) {
+				dx[x] = static_cast<short>(smoothed[x + 2] - smoothed[x]);
+				dy[x] = static_cast<short>(weights.outer * (differenced[x] + differenced[x + 2]) + weights.center * differenced[x + 1]);
+			}
+		}
+
+		const unsigned char* clampedRow(const ImageViewGray& source, int y) {
+			return source.row(std::clamp(y, 0, source.height - 1));
+		}
+
+		// Magnitudes are compared as integers: L1 directly, L2 squared
+		void magnitudeRow(const short* dx, const short* dy, int width, bool l2, int* magnitude) {
+			for (int x = 0; x < width; x++) {
+				const int gx = dx[x];
+				const int gy = dy[x];
+				magnitude[x] = l2 ? gx * gx + gy * gy : std::abs(gx) + std::abs(gy);
+			}
+		}
+		int thresholdOf(float threshold, bool l2) {
+			const double value = std::max(0.0, static_cast<double>(threshold));
+			return static_cast<int>(std::min(std::floor(l2 ? value * value : value), 2147483647.0));
+		}
+
+		// Edge map values before hysteresis
+		constexpr unsigned char NOT_EDGE{ 0 };
+		constexpr unsigned char WEAK_EDGE{ 1 };
+		constexpr unsigned char STRONG_EDGE{ 255 };
+	}
+
+	// class ImageGradient
+
+	// Object | public
+
+	// Constructor / Destructor
+	ImageGradient::ImageGradient(int width, int height) {
+		allocate(width, height);
+	}
+	ImageGradient::ImageGradient(const ImageGradient& other) {
+		*this = other;
+	}
+	ImageGradient::ImageGradient(ImageGradient&& other) noexcept {
+		*this = std::move(other);
+	}
+	ImageGradient::~ImageGradient() {
+		free();
+	}
+
+	// Operators | assignment
+	ImageGradient& ImageGradient::operator=(const ImageGradient& other) {
+		if (this == &other)
+			return *this;
+
+		if (other.data == nullptr) {
+			free();
+			return *this;
+		}
+		if (allocate(other.width, other.height) != nullptr)
+			std::memcpy(data, other.data, other.dataSize());
+
+		return *this;
+	}
+	ImageGradient& ImageGradient::operator=(ImageGradient&& other) noexcept {
+		if (this == &other)
+			return *this;
+
+		free();
+
+		width = other.width;
+		height = other.height;
+		data = other.data;
+
+		other.width = 0;
+		other.height = 0;
+		other.data = nullptr;
+
+		return *this;
+	}
+
+	// Getters
+	int ImageGradient::getWidth() const {
+		return width;
+	}
+	int ImageGradient::getHeight() const {
+		return height;
+	}
+	short* ImageGradient::getDx() const {
+		return data;
+	}
+	short* ImageGradient::getDy() const {
+		return data == nullptr ? nullptr : data + static_cast<size_t>(width) * static_cast<size_t>(height);
+	}
+
+	// Functions | allocation / deallocation
+	short* ImageGradient::allocate(int width, int height) {
+		assert(width > 0 && "width must be greater than 0");
+		assert(height > 0 && "height must be greater than 0");
+		if (width <= 0 || height <= 0)
+			return nullptr;
+
+		if (data != nullptr && this->width == width && this->height == height)
+			return data;
+
+		free();
+		data = reinterpret_cast<short*>(std::malloc(static_cast<size_t>(width) * static_cast<size_t>(height) * 2ULL * sizeof(short)));
+		if (data == nullptr)
+			return nullptr;
+
+		this->width = width;
+		this->height = height;
+		return data;
+	}
+	bool ImageGradient::isAllocated() const {
+		return data != nullptr;
+	}
+	size_t ImageGradient::dataSize() const {
+		return static_cast<size_t>(width) * static_cast<size_t>(height) * 2ULL * sizeof(short);
+	}
+	void ImageGradient::free() {
+		width = 0;
+		height = 0;
+		if (data != nullptr) {
+			std::free(data);
+			data = nullptr;
+		}
+	}
+
+	// Functions | gradients
+	bool gradient(const ImageViewGray& source, ImageGradient& destination, GradientOperator gradientOperator) {
+		// Error check
+		if (!source.hasData() || source.width <= 0 || source.height <= 0)
+			return false;
+		if (destination.allocate(source.width, source.height) == nullptr)
+			return false;
+
+		const Weights weights = weightsOf(gradientOperator);
+		const size_t width = static_cast<size_t>(source.width);
+		parallelForBands(0, source.height, [&](int rowBegin, int rowEnd) {
+			std::vector<short> smoothed(width + 2ULL);
+			std::vector<short> differenced(width + 2ULL);
+			for (int y = rowBegin; y < rowEnd; y++) {
+				gradientRow(
+					clampedRow(source, y - 1), source.row(y), clampedRow(source, y + 1), source.width, weights, smoothed.data(), differenced.data(),
+					destination.getDx() + static_cast<size_t>(y) * width, destination.getDy() + static_cast<size_t>(y) * width
+				);
+			}
+		}, BAND_ROWS);
+
+		return true;
+	}
+	bool gradientMagnitude(const ImageGradient& gradient, ImageGray16& destination, bool l2) {
+		// Error check
+		if (!gradient.isAllocated())
+			return false;
+		if ((destination.getWidth() != gradient.getWidth() || destination.getHeight() != gradient.getHeight()) && destination.allocate(gradient.getWidth(), gradient.getHeight()) == nullptr)
+			return false;
+
+		const size_t width = static_cast<size_t>(gradient.getWidth());
+		parallelForBands(0, gradient.getHeight(), [&](int rowBegin, int rowEnd) {
+			for (int y = rowBegin; y < rowEnd; y++) {
+				const short* dx = gradient.getDx() + static_cast<size_t>(y) * width;
+				const short* dy = gradient.getDy() + static_cast<size_t>(y) * width;
+				unsigned short* output = destination.getData() + static_cast<size_t>(y) * width;
+				size_t x = 0ULL;
+#if defined(IT_SIMD_SSSE3)
+				if (!l2) {
+					for (; x + 8ULL <= width; x += 8ULL) {
+						const __m128i gx = _mm_abs_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(dx + x)));
+						const __m128i gy = _mm_abs_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(dy + x)));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(output + x), _mm_add_epi16(gx, gy));
+					}
+				}
+#endif
+				for (; x < width; x++) {
+					const int gx = dx[x];
+					const int gy = dy[x];
+					output[x] = static_cast<unsigned short>(l2 ? std::lround(std::sqrt(static_cast<double>(gx * gx + gy * gy))) : std::abs(gx) + std::abs(gy));
+				}
+			}
+		}, BAND_ROWS);
+
+		return true;
+	}
+
+	// Functions | edge detection
+	bool canny(const ImageViewGray& source, ImageGray& edges, float lowThreshold, float highThreshold, GradientOperator gradientOperator, bool l2) {
+		// Error check
+		if (!source.hasData() || source.width <= 0 || source.height <= 0 || source.data == edges.getData())
+			return false;
+		if ((edges.getWidth() != source.width || edges.getHeight() != source.height) && edges.allocate(source.width, source.height) == nullptr)
+			return false;
+
+		if (lowThreshold > highThreshold)
+			std::swap(lowThreshold, highThreshold);
+		const int low = thresholdOf(lowThreshold, l2);
+		const int high = thresholdOf(highThreshold, l2);
+
+		const Weights weights = weightsOf(gradientOperator);
+		const int width = source.width;
+		const int height = source.height;
+		unsigned char* map = edges.getData();
+
+		// Gradients and non-maximum suppression, streamed through a three row window per band
+		std::vector<size_t> strong{};
+		std::mutex strongMutex{};
+		parallelForBands(0, height, [&](int rowBegin, int rowEnd) {
+			const size_t rowSize = static_cast<size_t>(width);
+			std::vector<short> smoothed(rowSize + 2ULL);
+			std::vector<short> differenced(rowSize + 2ULL);
+			std::vector<short> dx(rowSize * 3ULL);
+			std::vector<short> dy(rowSize * 3ULL);
+			std::vector<int> magnitude((rowSize + 2ULL) * 3ULL, 0); // One zero column on each side
+			std::vector<size_t> bandStrong{};
+
+			auto slotOf = [](int y) { return static_cast<size_t>((y % 3 + 3) % 3); };
+			auto magnitudeRowOf = [&](int y) { return magnitude.data() + slotOf(y) * (rowSize + 2ULL); };
+			auto computeRow = [&](int y) {
+				int* magnitudes = magnitudeRowOf(y);
+				if (y < 0 || y >= height) {
+					std::fill(magnitudes, magnitudes + rowSize + 2ULL, 0);
+					return;
+				}
+				short* rowDx = dx.data() + slotOf(y) * rowSize;
+				short* rowDy = dy.data() + slotOf(y) * rowSize;
+				gradientRow(clampedRow(source, y - 1), source.row(y), clampedRow(source, y + 1), width, weights, smoothed.data(), differenced.data(), rowDx, rowDy);
+				magnitudeRow(rowDx, rowDy, width, l2, magnitudes + 1);
+			};
+
+			computeRow(rowBegin - 1);
+			computeRow(rowBegin);
+			for (int y = rowBegin; y < rowEnd; y++) {
+				computeRow(y + 1);
+
+				const int* previous = magnitudeRowOf(y - 1) + 1;
+				const int* current = magnitudeRowOf(y) + 1;
+				const int* next = magnitudeRowOf(y + 1) + 1;
+				const short* rowDx = dx.data() + slotOf(y) * rowSize;
+				const short* rowDy = dy.data() + slotOf(y) * rowSize;
+				unsigned char* output = map + static_cast<size_t>(y) * rowSize;
+
+				// Direction sectors via tan(22.5) in 15-bit fixed point, which avoids atan2 per pixel
+				constexpr int TAN_22_5{ 13573 };
+				for (int x = 0; x < width; x++) {
+					const int value = current[x];
+					output[x] = NOT_EDGE;
+					if (value <= low)
+						continue;
+
+					const int gx = rowDx[x];
+					const int gy = rowDy[x];
+					const long long ax = std::abs(gx);
+					const long long ay = static_cast<long long>(std::abs(gy)) << 15;
+					const long long tan22 = ax * TAN_22_5;
+					bool isMaximum{ false };
+					if (ay < tan22)
+						isMaximum = value > current[x - 1] && value >= current[x + 1];
+					else if (ay > tan22 + (ax << 16))
+						isMaximum = value > previous[x] && value >= next[x];
+					else {
+						const int step = (gx ^ gy) < 0 ? -1 : 1;
+						isMaximum = value > previous[x - step] && value > next[x + step];
+					}
+					if (!isMaximum)
+						continue;
+
+					if (value > high) {
+						output[x] = STRONG_EDGE;
+						bandStrong.push_back(static_cast<size_t>(y) * rowSize + static_cast<size_t>(x));
+					}
+					else
+						output[x] = WEAK_EDGE;
+				}
+			}
+
+			std::lock_guard<std::mutex> lock(strongMutex);
+			strong.insert(strong.end(), bandStrong.begin(), bandStrong.end());
+		}, BAND_ROWS);
+
+		// Hysteresis: weak pixels 8-connected to a strong one become strong
+		std::vector<size_t>& worklist = strong;
+		while (!worklist.empty()) {
+			const size_t index = worklist.back();
+			worklist.pop_back();
+
+			const int x = static_cast<int>(index % static_cast<size_t>(width));
+			const int y = static_cast<int>(index / static_cast<size_t>(width));
+			for (int neighbourY = std::max(y - 1, 0); neighbourY <= std::min(y + 1, height - 1); neighbourY++) {
+				for (int neighbourX = std::max(x - 1, 0); neighbourX <= std::min(x + 1, width - 1); neighbourX++) {
+					const size_t neighbour = static_cast<size_t>(neighbourY) * static_cast<size_t>(width) + static_cast<size_t>(neighbourX);
+					if (map[neighbour] == WEAK_EDGE) {
+						map[neighbour] = STRONG_EDGE;
+						worklist.push_back(neighbour);
+					}
+				}
+			}
+		}
+
+		// Weak pixels that were never reached are dropped
+		parallelForBands(0, height, [&](int rowBegin, int rowEnd) {
+			unsigned char* pixels = map + static_cast<size_t>(rowBegin) * static_cast<size_t>(width);
+			const size_t count = static_cast<size_t>(rowEnd - rowBegin) * static_cast<size_t>(width);
+			for (size_t i = 0ULL; i < count; i++)
+				pixels[i] = pixels[i] == STRONG_EDGE ? STRONG_EDGE : NOT_EDGE;
+		}, BAND_ROWS);
+
+		return true;
+	}
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Enums
+	enum class GradientOperator {
+		SOBEL,	// [1 2 1] smoothing, responses up to 4 * 255
+		SCHARR	// [3 10 3] smoothing, better rotational symmetry, responses up to 16 * 255
+	};
+
+	// Classes
+	// Signed 16-bit image derivatives, stored as two planes (x derivative, then y derivative)
+	class ImageGradient {
+		// Object
+		private:
+			// Properties
+			int width{ 0 };
+			int height{ 0 };
+			short* data{ nullptr };
+
+		public:
+			// Constructor / Destructor
+			ImageGradient() = default;
+			ImageGradient(int width, int height);
+			ImageGradient(const ImageGradient& other);
+			ImageGradient(ImageGradient&& other) noexcept;
+			~ImageGradient();
+
+			// Operators | assignment
+			ImageGradient& operator=(const ImageGradient& other);
+			ImageGradient& operator=(ImageGradient&& other) noexcept;
+
+			// Getters
+			int getWidth() const;
+			int getHeight() const;
+			short* getDx() const;
+			short* getDy() const;
+
+			// Functions | allocation / deallocation
+			short* allocate(int width, int height);
+			bool isAllocated() const;
+			size_t dataSize() const;
+			void free();
+	};
+
+	// Functions | gradients (borders replicate the edge pixels)
+	bool gradient(const ImageViewGray& source, ImageGradient& destination, GradientOperator gradientOperator = GradientOperator::SOBEL);
+	bool gradientMagnitude(const ImageGradient& gradient, ImageGray16& destination, bool l2 = false); // |dx| + |dy| or sqrt(dx^2 + dy^2)
+
+	// Functions | edge detection
+	// Canny edges as 0 / 255. Thresholds are in gradient magnitude units of the chosen operator (L1 unless l2 is set).
+	// Gradients and non-maximum suppression are streamed per band of rows, so no full size gradient planes are kept;
+	// hysteresis then grows the strong edges through the weak ones with a worklist.
+	bool canny(const ImageViewGray& source, ImageGray& edges, float lowThreshold, float highThreshold, GradientOperator gradientOperator = GradientOperator::SOBEL, bool l2 = false);
+}
@@ -0,0 +1,25 @@
+#include "Expression.h"
+
+// Dependencies | std
+#include <utility>
+
+namespace it {
+	namespace {
+		// One tree per node type, operator and channel count
+		using ScaledGray = decltype(toGray(std::declval<const ImageRGBA&>()) * 0.5f + 10);
+		using ShadedGrayAlpha = decltype(withAlpha(invert(std::declval<const ImageViewGray&>()) / 2.0f, std::declval<const ImageGray&>()));
+		using Difference = decltype(pixelClamp(pixelAbs(std::declval<const ImageRGB&>() - std::declval<const ImageViewRGB&>()), 16.0f, 240.0f));
+		using Blend = decltype(mix(-pixels(std::declval<const ImageRGBA&>()), toRGBA(std::declval<const ImageGrayAlpha&>()), std::declval<const ImageGray&>()));
+		using Swizzled = decltype(swizzle<2, 1, 0, 3>(std::declval<const ImageViewRGBA&>()));
+	}
+
+	// The expression templates are header only; instantiating the assignments here compiles every node with the library
+	template ImageGray& ImageGray::operator=(const PixelExpression<ScaledGray>&);
+	template ImageGrayAlpha& ImageGrayAlpha::operator=(const PixelExpression<ShadedGrayAlpha>&);
+	template ImageRGB& ImageRGB::operator=(const PixelExpression<Difference>&);
+	template ImageRGBA& ImageRGBA::operator=(const PixelExpression<Blend>&);
+	template ImageViewGray& ImageViewGray::operator=(const PixelExpression<ScaledGray>&);
+	template ImageViewGrayAlpha& ImageViewGrayAlpha::operator=(const PixelExpression<ShadedGrayAlpha>&);
+	template ImageViewRGB& ImageViewRGB::operator=(const PixelExpression<Difference>&);
+	template ImageViewRGBA& ImageViewRGBA::operator=(const PixelExpression<Swizzled>&);
+}
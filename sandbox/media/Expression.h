@@ -0,0 +1,680 @@
+#pragma once
+
+// Dependencies | std
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+// Dependencies | core
+#include <core/Parallel.h>
+
+// Dependencies | media
+#include <media/Image.h>
+
+// Lazy per-pixel expressions over 8-bit images, e.g.
+//
+//	ImageGray dst;
+//	dst = toGray(src) * 0.5f + 10;
+//
+// Operators and functions only build a tree of small value types; nothing is computed until the tree is assigned to an
+// image or view. The assignment then walks the destination once, in parallel row bands, and evaluates the whole tree
+// per pixel in float with every node inlined into one loop: no intermediate images, and a body the compiler can
+// vectorize at -O3 (at -O2 it stays a scalar loop). Results are rounded and saturated to 0..255 on store.
+//
+// Operands are expressions, images / views (ImageGray, ImageGrayAlpha, ImageRGB, ImageRGBA and their views) or numbers.
+// A single channel operand is broadcast against a multi channel one; other channel counts must match. Every image in
+// a tree must have the size of the destination.
+namespace it {
+	// Structs
+	// Samples of one pixel as floats on the 0..255 scale
+	template<int N>
+	struct PixelValue {
+		// Properties
+		float channels[N]{};
+
+		// Operators | member access
+		float& operator[](int channel) {
+			return channels[channel];
+		}
+		float operator[](int channel) const {
+			return channels[channel];
+		}
+	};
+
+	// Base of every expression node (CRTP). A node provides:
+	//	static constexpr int CHANNELS
+	//	bool fits(int width, int height) const - true if every image it reads has this size
+	//	glm::ivec2 size() const - size of the first image it reads, (0, 0) if it reads none
+	//	Row row(int y) const - a cursor whose operator()(int x) returns PixelValue<CHANNELS>
+	template<typename Derived>
+	struct PixelExpression {
+		// Functions
+		const Derived& self() const {
+			return static_cast<const Derived&>(*this);
+		}
+	};
+
+	// Reads an 8-bit image with N interleaved channels
+	template<int N>
+	struct ViewExpression : PixelExpression<ViewExpression<N>> {
+		// Static
+		static constexpr int CHANNELS{ N };
+
+		// Properties
+		const unsigned char* data{ nullptr };
+		int width{ 0 };
+		int height{ 0 };
+		size_t stride{ 0 };
+
+		// Structs
+		struct Row {
+			// Properties
+			const unsigned char* samples{ nullptr };
+
+			// Operators | evaluation
+			PixelValue<N> operator()(int x) const {
+				PixelValue<N> value{};
+				for (int channel = 0; channel < N; channel++)
+					value[channel] = static_cast<float>(samples[static_cast<size_t>(x) * N + channel]);
+				return value;
+			}
+		};
+
+		// Constructors
+		ViewExpression(const unsigned char* data, int width, int height, size_t stride) : data(data), width(width), height(height), stride(stride) {}
+
+		// Functions
+		bool fits(int width, int height) const {
+			return data != nullptr && this->width == width && this->height == height;
+		}
+		glm::ivec2 size() const {
+			return { width, height };
+		}
+		Row row(int y) const {
+			return { data + static_cast<size_t>(y) * stride };
+		}
+	};
+
+	// The same value everywhere
+	struct ConstantExpression : PixelExpression<ConstantExpression> {
+		// Static
+		static constexpr int CHANNELS{ 1 };
+
+		// Properties
+		float value{ 0.0f };
+
+		// Structs
+		struct Row {
+			// Properties
+			float value{ 0.0f };
+
+			// Operators | evaluation
+			PixelValue<1> operator()(int) const {
+				return { { value } };
+			}
+		};
+
+		// Constructors
+		ConstantExpression(float value) : value(value) {}
+
+		// Functions
+		bool fits(int, int) const {
+			return true;
+		}
+		glm::ivec2 size() const {
+			return { 0, 0 };
+		}
+		Row row(int) const {
+			return { value };
+		}
+	};
+
+	// Functions | operands
+	template<typename Derived>
+	const Derived& asExpression(const PixelExpression<Derived>& expression) {
+		return expression.self();
+	}
+	inline ViewExpression<1> asExpression(const ImageViewGray& image) {
+		return { image.data, image.width, image.height, image.stride };
+	}
+	inline ViewExpression<2> asExpression(const ImageViewGrayAlpha& image) {
+		return { reinterpret_cast<const unsigned char*>(image.data), image.width, image.height, image.stride };
+	}
+	inline ViewExpression<3> asExpression(const ImageViewRGB& image) {
+		return { reinterpret_cast<const unsigned char*>(image.data), image.width, image.height, image.stride };
+	}
+	inline ViewExpression<4> asExpression(const ImageViewRGBA& image) {
+		return { reinterpret_cast<const unsigned char*>(image.data), image.width, image.height, image.stride };
+	}
+	inline ConstantExpression asExpression(float value) {
+		return { value };
+	}
+
+	// Concepts
+	template<typename T>
+	concept IsPixelOperand = std::is_arithmetic_v<T> || requires(const T& operand) {
+		{ asExpression(operand) };
+	};
+
+	// Images, views and expressions (numbers excluded)
+	template<typename T>
+	concept IsPixelSource = IsPixelOperand<T> && !std::is_arithmetic_v<T>;
+
+	template<typename T>
+	using OperandExpression = std::decay_t<decltype(asExpression(std::declval<const T&>()))>;
+
+	// Functions | values
+	// Channel c of a value broadcast to N channels (single channel values repeat)
+	template<int N>
+	float channelOf(const PixelValue<N>& value, int channel) {
+		return N == 1 ? value[0] : value[channel];
+	}
+	inline float luminanceOf(float r, float g, float b) {
+		return 0.299f * r + 0.587f * g + 0.114f * b;
+	}
+	// std::max(0, value) is (0 < value ? value : 0), so NaN (0 / 0 for instance) stores 0 instead of converting NaN;
+	// the selects map to maxps / minps when the loop is vectorized, unlike std::fmax
+	inline unsigned char toSample(float value) {
+		return static_cast<unsigned char>(std::min(std::max(0.0f, value + 0.5f), 255.0f));
+	}
+	inline glm::ivec2 sizeOf(const glm::ivec2& a, const glm::ivec2& b) {
+		return a.x > 0 ? a : b;
+	}
+
+	// Structs | operations
+	struct AddOperation {
+		static float apply(float a, float b) {
+			return a + b;
+		}
+	};
+	struct SubtractOperation {
+		static float apply(float a, float b) {
+			return a - b;
+		}
+	};
+	struct MultiplyOperation {
+		static float apply(float a, float b) {
+			return a * b;
+		}
+	};
+	struct DivideOperation {
+		static float apply(float a, float b) {
+			return a / b;
+		}
+	};
+	struct MinimumOperation {
+		static float apply(float a, float b) {
+			return std::min(a, b);
+		}
+	};
+	struct MaximumOperation {
+		static float apply(float a, float b) {
+			return std::max(a, b);
+		}
+	};
+	struct NegateOperation {
+		static float apply(float a) {
+			return -a;
+		}
+	};
+	struct InvertOperation {
+		static float apply(float a) {
+			return 255.0f - a;
+		}
+	};
+	struct AbsoluteOperation {
+		static float apply(float a) {
+			return std::max(a, -a);
+		}
+	};
+
+	// Structs | nodes
+	template<typename Operand, typename Operation>
+	struct UnaryExpression : PixelExpression<UnaryExpression<Operand, Operation>> {
+		// Static
+		static constexpr int CHANNELS{ Operand::CHANNELS };
+
+		// Properties
+		Operand operand;
+
+		// Structs
+		struct Row {
+			// Properties
+			typename Operand::Row operand;
+
+			// Operators | evaluation
+			PixelValue<CHANNELS> operator()(int x) const {
+				const PixelValue<CHANNELS> value = operand(x);
+				PixelValue<CHANNELS> result{};
+				for (int channel = 0; channel < CHANNELS; channel++)
+					result[channel] = Operation::apply(value[channel]);
+				return result;
+			}
+		};
+
+		// Constructors
+		UnaryExpression(const Operand& operand) : operand(operand) {}
+
+		// Functions
+		bool fits(int width, int height) const {
+			return operand.fits(width, height);
+		}
+		glm::ivec2 size() const {
+			return operand.size();
+		}
+		Row row(int y) const {
+			return { operand.row(y) };
+		}
+	};
+
+	template<typename Left, typename Right, typename Operation>
+	struct BinaryExpression : PixelExpression<BinaryExpression<Left, Right, Operation>> {
+		static_assert(Left::CHANNELS == Right::CHANNELS || Left::CHANNELS == 1 || Right::CHANNELS == 1, "channel counts must match or one side must be single channel");
+
+		// Static
+		static constexpr int CHANNELS{ std::max(Left::CHANNELS, Right::CHANNELS) };
+
+		// Properties
+		Left left;
+		Right right;
+
+		// Structs
+		struct Row {
+			// Properties
+			typename Left::Row left;
+			typename Right::Row right;
+
+			// Operators | evaluation
+			PixelValue<CHANNELS> operator()(int x) const {
+				const PixelValue<Left::CHANNELS> a = left(x);
+				const PixelValue<Right::CHANNELS> b = right(x);
+				PixelValue<CHANNELS> result{};
+				for (int channel = 0; channel < CHANNELS; channel++)
+					result[channel] = Operation::apply(channelOf(a, channel), channelOf(b, channel));
+				return result;
+			}
+		};
+
+		// Constructors
+		BinaryExpression(const Left& left, const Right& right) : left(left), right(right) {}
+
+		// Functions
+		bool fits(int width, int height) const {
+			return left.fits(width, height) && right.fits(width, height);
+		}
+		glm::ivec2 size() const {
+			return sizeOf(left.size(), right.size());
+		}
+		Row row(int y) const {
+			return { left.row(y), right.row(y) };
+		}
+	};
+
+	// a + (b - a) * t per channel
+	template<typename A, typename B, typename T>
+	struct MixExpression : PixelExpression<MixExpression<A, B, T>> {
+		// Static
+		static constexpr int CHANNELS{ std::max({ A::CHANNELS, B::CHANNELS, T::CHANNELS }) };
+		static_assert((A::CHANNELS == CHANNELS || A::CHANNELS == 1) && (B::CHANNELS == CHANNELS || B::CHANNELS == 1) && (T::CHANNELS == CHANNELS || T::CHANNELS == 1), "channel counts must match or be single channel");
+
+		// Properties
+		A a;
+		B b;
+		T t;
+
+		// Structs
+		struct Row {
+			// Properties
+			typename A::Row a;
+			typename B::Row b;
+			typename T::Row t;
+
+			// Operators | evaluation
+			PixelValue<CHANNELS> operator()(int x) const {
+				const PixelValue<A::CHANNELS> from = a(x);
+				const PixelValue<B::CHANNELS> to = b(x);
+				const PixelValue<T::CHANNELS> amount = t(x);
+				PixelValue<CHANNELS> result{};
+				for (int channel = 0; channel < CHANNELS; channel++)
+					result[channel] = channelOf(from, channel) + (channelOf(to, channel) - channelOf(from, channel)) * channelOf(amount, channel);
+				return result;
+			}
+		};
+
+		// Constructors
+		MixExpression(const A& a, const B& b, const T& t) : a(a), b(b), t(t) {}
+
+		// Functions
+		bool fits(int width, int height) const {
+			return a.fits(width, height) && b.fits(width, height) && t.fits(width, height);
+		}
+		glm::ivec2 size() const {
+			return sizeOf(a.size(), sizeOf(b.size(), t.size()));
+		}
+		Row row(int y) const {
+			return { a.row(y), b.row(y), t.row(y) };
+		}
+	};
+
+	// Luminance of RGB(A) with the weights of the image conversions, gray of gray(+ alpha); alpha is dropped
+	template<typename Operand>
+	struct GrayExpression : PixelExpression<GrayExpression<Operand>> {
+		// Static
+		static constexpr int CHANNELS{ 1 };
+
+		// Properties
+		Operand operand;
+
+		// Structs
+		struct Row {
+			// Properties
+			typename Operand::Row operand;
+
+			// Operators | evaluation
+			PixelValue<1> operator()(int x) const {
+				const PixelValue<Operand::CHANNELS> value = operand(x);
+				if constexpr (Operand::CHANNELS >= 3)
+					return { { luminanceOf(value[0], value[1], value[2]) } };
+				else
+					return { { value[0] } };
+			}
+		};
+
+		// Constructors
+		GrayExpression(const Operand& operand) : operand(operand) {}
+
+		// Functions
+		bool fits(int width, int height) const {
+			return operand.fits(width, height);
+		}
+		glm::ivec2 size() const {
+			return operand.size();
+		}
+		Row row(int y) const {
+			return { operand.row(y) };
+		}
+	};
+
+	// Selects channels of the operand by index; -1 takes the luminance of a color operand (gray for gray operands)
+	template<typename Operand, int... INDICES>
+	struct SwizzleExpression : PixelExpression<SwizzleExpression<Operand, INDICES...>> {
+		static_assert(((INDICES >= -1 && INDICES < Operand::CHANNELS) && ...), "channel index is out of range");
+
+		// Static
+		static constexpr int CHANNELS{ sizeof...(INDICES) };
+
+		// Properties
+		Operand operand;
+
+		// Structs
+		struct Row {
+			// Properties
+			typename Operand::Row operand;
+
+			// Operators | evaluation
+			PixelValue<CHANNELS> operator()(int x) const {
+				const PixelValue<Operand::CHANNELS> value = operand(x);
+				return { { pick(value, INDICES)... } };
+			}
+			static float pick(const PixelValue<Operand::CHANNELS>& value, int index) {
+				if (index >= 0)
+					return value[index];
+				if constexpr (Operand::CHANNELS >= 3)
+					return luminanceOf(value[0], value[1], value[2]);
+				else
+					return value[0];
+			}
+		};
+
+		// Constructors
+		SwizzleExpression(const Operand& operand) : operand(operand) {}
+
+		// Functions
+		bool fits(int width, int height) const {
+			return operand.fits(width, height);
+		}
+		glm::ivec2 size() const {
+			return operand.size();
+		}
+		Row row(int y) const {
+			return { operand.row(y) };
+		}
+	};
+
+	// Color channels of one operand followed by the single channel of another
+	template<typename Color, typename Alpha>
+	struct AppendExpression : PixelExpression<AppendExpression<Color, Alpha>> {
+		static_assert(Alpha::CHANNELS == 1, "the appended operand must be single channel");
+
+		// Static
+		static constexpr int CHANNELS{ Color::CHANNELS + 1 };
+
+		// Properties
+		Color color;
+		Alpha alpha;
+
+		// Structs
+		struct Row {
+			// Properties
+			typename Color::Row color;
+			typename Alpha::Row alpha;
+
+			// Operators | evaluation
+			PixelValue<CHANNELS> operator()(int x) const {
+				const PixelValue<Color::CHANNELS> value = color(x);
+				PixelValue<CHANNELS> result{};
+				for (int channel = 0; channel < Color::CHANNELS; channel++)
+					result[channel] = value[channel];
+				result[Color::CHANNELS] = alpha(x)[0];
+				return result;
+			}
+		};
+
+		// Constructors
+		AppendExpression(const Color& color, const Alpha& alpha) : color(color), alpha(alpha) {}
+
+		// Functions
+		bool fits(int width, int height) const {
+			return color.fits(width, height) && alpha.fits(width, height);
+		}
+		glm::ivec2 size() const {
+			return sizeOf(color.size(), alpha.size());
+		}
+		Row row(int y) const {
+			return { color.row(y), alpha.row(y) };
+		}
+	};
+
+	// Functions | sources
+	template<IsPixelSource Operand>
+	OperandExpression<Operand> pixels(const Operand& operand) {
+		return asExpression(operand);
+	}
+
+	// Functions | arithmetic (at least one side must be an image, view or expression)
+	template<typename Operation, typename A, typename B>
+	BinaryExpression<OperandExpression<A>, OperandExpression<B>, Operation> makeBinaryExpression(const A& a, const B& b) {
+		return { asExpression(a), asExpression(b) };
+	}
+
+	template<IsPixelOperand A, IsPixelOperand B> requires (IsPixelSource<A> || IsPixelSource<B>)
+	auto operator+(const A& a, const B& b) {
+		return makeBinaryExpression<AddOperation>(a, b);
+	}
+	template<IsPixelOperand A, IsPixelOperand B> requires (IsPixelSource<A> || IsPixelSource<B>)
+	auto operator-(const A& a, const B& b) {
+		return makeBinaryExpression<SubtractOperation>(a, b);
+	}
+	template<IsPixelOperand A, IsPixelOperand B> requires (IsPixelSource<A> || IsPixelSource<B>)
+	auto operator*(const A& a, const B& b) {
+		return makeBinaryExpression<MultiplyOperation>(a, b);
+	}
+	template<IsPixelOperand A, IsPixelOperand B> requires (IsPixelSource<A> || IsPixelSource<B>)
+	auto operator/(const A& a, const B& b) {
+		return makeBinaryExpression<DivideOperation>(a, b);
+	}
+	template<IsPixelSource A>
+	UnaryExpression<OperandExpression<A>, NegateOperation> operator-(const A& a) {
+		return { asExpression(a) };
+	}
+
+	// Functions | per channel (prefixed so they do not hide std::min, std::abs and the like inside the namespace)
+	template<IsPixelOperand A, IsPixelOperand B> requires (IsPixelSource<A> || IsPixelSource<B>)
+	auto pixelMin(const A& a, const B& b) {
+		return makeBinaryExpression<MinimumOperation>(a, b);
+	}
+	template<IsPixelOperand A, IsPixelOperand B> requires (IsPixelSource<A> || IsPixelSource<B>)
+	auto pixelMax(const A& a, const B& b) {
+		return makeBinaryExpression<MaximumOperation>(a, b);
+	}
+	template<IsPixelSource A>
+	auto pixelClamp(const A& a, float low, float high) {
+		return pixelMin(pixelMax(a, low), high);
+	}
+	template<IsPixelSource A>
+	UnaryExpression<OperandExpression<A>, InvertOperation> invert(const A& a) {
+		return { asExpression(a) };
+	}
+	template<IsPixelSource A>
+	UnaryExpression<OperandExpression<A>, AbsoluteOperation> pixelAbs(const A& a) {
+		return { asExpression(a) };
+	}
+	template<IsPixelOperand A, IsPixelOperand B, IsPixelOperand T> requires (IsPixelSource<A> || IsPixelSource<B>)
+	MixExpression<OperandExpression<A>, OperandExpression<B>, OperandExpression<T>> mix(const A& a, const B& b, const T& t) {
+		return { asExpression(a), asExpression(b), asExpression(t) };
+	}
+
+	// Functions | channels
+	template<IsPixelSource A>
+	GrayExpression<OperandExpression<A>> toGray(const A& a) {
+		return { asExpression(a) };
+	}
+	template<IsPixelSource A>
+	auto toRGB(const A& a) {
+		using Operand = OperandExpression<A>;
+		if constexpr (Operand::CHANNELS >= 3)
+			return SwizzleExpression<Operand, 0, 1, 2>(asExpression(a));
+		else
+			return SwizzleExpression<Operand, 0, 0, 0>(asExpression(a));
+	}
+	template<IsPixelSource A, IsPixelOperand Alpha>
+	AppendExpression<std::decay_t<decltype(toRGB(std::declval<const A&>()))>, OperandExpression<Alpha>> toRGBA(const A& a, const Alpha& alpha) {
+		return { toRGB(a), asExpression(alpha) };
+	}
+	template<IsPixelSource A>
+	auto toRGBA(const A& a) {
+		return toRGBA(a, 255.0f);
+	}
+	template<int... INDICES, IsPixelSource A>
+	SwizzleExpression<OperandExpression<A>, INDICES...> swizzle(const A& a) {
+		return { asExpression(a) };
+	}
+	template<IsPixelSource A, IsPixelOperand Alpha>
+	AppendExpression<OperandExpression<A>, OperandExpression<Alpha>> withAlpha(const A& color, const Alpha& alpha) {
+		return { asExpression(color), asExpression(alpha) };
+	}
+
+	// Functions | evaluation
+	// One destination row. Everything the loop reads is a local value so the compiler can count its iterations and, at
+	// -O3, vectorize across pixels.
+	template<int N, typename Row>
+	void evaluateRow(const Row source, unsigned char* samples, int width) {
+		for (int x = 0; x < width; x++) {
+			const auto value = source(x);
+			for (int channel = 0; channel < N; channel++)
+				samples[static_cast<size_t>(x) * N + channel] = toSample(channelOf(value, channel));
+		}
+	}
+
+	// Writes the expression into N-channel rows; false if the destination is empty or an image of the tree does not fit
+	template<int N, typename Derived>
+	bool evaluate(unsigned char* data, int width, int height, size_t stride, const PixelExpression<Derived>& expression) {
+		static_assert(Derived::CHANNELS == N || Derived::CHANNELS == 1, "expression and destination channel counts differ");
+		constexpr int BAND_ROWS{ 16 };
+
+		// Error check
+		const Derived& tree = expression.self();
+		if (data == nullptr || width <= 0 || height <= 0 || !tree.fits(width, height))
+			return false;
+
+		parallelForBands(0, height, [&](int rowBegin, int rowEnd) {
+			for (int y = rowBegin; y < rowEnd; y++)
+				evaluateRow<N>(tree.row(y), data + static_cast<size_t>(y) * stride, width);
+		}, BAND_ROWS);
+
+		return true;
+	}
+	template<typename Derived>
+	bool evaluate(const ImageViewGray& destination, const PixelExpression<Derived>& expression) {
+		return evaluate<1>(destination.data, destination.width, destination.height, destination.stride, expression);
+	}
+	template<typename Derived>
+	bool evaluate(const ImageViewGrayAlpha& destination, const PixelExpression<Derived>& expression) {
+		return evaluate<2>(reinterpret_cast<unsigned char*>(destination.data), destination.width, destination.height, destination.stride, expression);
+	}
+	template<typename Derived>
+	bool evaluate(const ImageViewRGB& destination, const PixelExpression<Derived>& expression) {
+		return evaluate<3>(reinterpret_cast<unsigned char*>(destination.data), destination.width, destination.height, destination.stride, expression);
+	}
+	template<typename Derived>
+	bool evaluate(const ImageViewRGBA& destination, const PixelExpression<Derived>& expression) {
+		return evaluate<4>(reinterpret_cast<unsigned char*>(destination.data), destination.width, destination.height, destination.stride, expression);
+	}
+	// Images are reallocated to the size of the expression unless they already have it. The tree is checked first, so a
+	// failing assignment keeps the destination as it was; that includes a tree reading the destination at another size.
+	template<typename Image, typename Derived>
+	bool allocateFor(Image& destination, const PixelExpression<Derived>& expression) {
+		const glm::ivec2 size = expression.self().size();
+		if (size.x <= 0 || size.y <= 0 || !expression.self().fits(size.x, size.y))
+			return false;
+		if (destination.isAllocated() && destination.getWidth() == size.x && destination.getHeight() == size.y)
+			return true;
+		return destination.allocate(size.x, size.y) != nullptr;
+	}
+
+	// Operators | assignment (declared in media/Image.h)
+	template<typename Derived>
+	ImageGray& ImageGray::operator=(const PixelExpression<Derived>& expression) {
+		if (allocateFor(*this, expression))
+			evaluate(ImageViewGray(*this), expression);
+		return *this;
+	}
+	template<typename Derived>
+	ImageGrayAlpha& ImageGrayAlpha::operator=(const PixelExpression<Derived>& expression) {
+		if (allocateFor(*this, expression))
+			evaluate(ImageViewGrayAlpha(*this), expression);
+		return *this;
+	}
+	template<typename Derived>
+	ImageRGB& ImageRGB::operator=(const PixelExpression<Derived>& expression) {
+		if (allocateFor(*this, expression))
+			evaluate(ImageViewRGB(*this), expression);
+		return *this;
+	}
+	template<typename Derived>
+	ImageRGBA& ImageRGBA::operator=(const PixelExpression<Derived>& expression) {
+		if (allocateFor(*this, expression))
+			evaluate(ImageViewRGBA(*this), expression);
+		return *this;
+	}
+	template<typename Derived>
+	ImageViewGray& ImageViewGray::operator=(const PixelExpression<Derived>& expression) {
+		evaluate(*this, expression);
+		return *this;
+	}
+	template<typename Derived>
+	ImageViewGrayAlpha& ImageViewGrayAlpha::operator=(const PixelExpression<Derived>& expression) {
+		evaluate(*this, expression);
+		return *this;
+	}
+	template<typename Derived>
+	ImageViewRGB& ImageViewRGB::operator=(const PixelExpression<Derived>& expression) {
+		evaluate(*this, expression);
+		return *this;
+	}
+	template<typename Derived>
+	ImageViewRGBA& ImageViewRGBA::operator=(const PixelExpression<Derived>& expression) {
+		evaluate(*this, expression);
+		return *this;
+	}
+}
@@ -0,0 +1,415 @@
+#include "Hashing.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <numbers>
+#include <utility>
+
+// Dependencies | core
+#include <core/Simd.h>
+
+// Dependencies | media
+#include <media/Samples.h>
+
+namespace it {
+	namespace {
+		// Bytes per independently hashed chunk of rows
+		constexpr size_t CHUNK_BYTES{ 1ULL << 20 };
+		constexpr size_t STRIPE_BYTES{ 64 };
+		// Stripes between two scrambles of the accumulators
+		constexpr size_t BLOCK_STRIPES{ 16 };
+		// Hashes per parallel range of the search
+		constexpr int SEARCH_GRAIN{ 1 << 16 };
+
+		constexpr std::uint64_t PRIME32_1{ 0x9E3779B1ULL };
+		constexpr std::uint64_t PRIME64_1{ 0x9E3779B185EBCA87ULL };
+		constexpr std::uint64_t PRIME64_2{ 0xC2B2AE3D27D4EB4FULL };
+		constexpr std::uint64_t PRIME64_3{ 0x165667B19E3779F9ULL };
+
+		std::uint64_t splitMix(std::uint64_t& state) {
+			std::uint64_t value = (state += 0x9E3779B97F4A7C15ULL);
+			value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+			return value ^ (value >> 31);
+		}
+		std::uint64_t avalanche(std::uint64_t value) {
+			value ^= value >> 33;
+			value *= PRIME64_2;
+			value ^= value >> 29;
+			value *= PRIME64_3;
+			return value ^ (value >> 32);
+		}
+
+		// Streaming hash over 8 64-bit lanes: every lane adds the product of the low and high halves of its keyed
+		// input and the unkeyed input of its neighbor lane; the lanes are scrambled every block of stripes
+		class StripeHasher {
+			// Object
+			private:
+				// Properties
+				alignas(16) std::array<std::uint64_t, 8> accumulators{};
+				alignas(16) std::array<std::uint64_t, 8> key{};
+				std::array<unsigned char, STRIPE_BYTES> buffer{};
+				size_t buffered{ 0 };
+				size_t stripes{ 0 };
+				std::uint64_t length{ 0 };
+
+			public:
+				// Constructor / Destructor
+				explicit StripeHasher(std::uint64_t seed) {
+					std::uint64_t state = seed;
+					for (size_t lane = 0ULL; lane < key.size(); lane++) {
+						key[lane] = splitMix(state);
+						accumulators[lane] = splitMix(state);
+					}
+				}
+
+				// Functions
+				void update(const void* data, size_t size) {
+					const unsigned char* bytes = static_cast<const unsigned char*>(data);
+					length += size;
+					if (buffered > 0ULL) {
+						const size_t taken = std::min(size, STRIPE_BYTES - buffered);
+						std::memcpy(buffer.data() + buffered, bytes, taken);
+						buffered += taken;
+						bytes += taken;
+						size -= taken;
+						if (buffered < STRIPE_BYTES)
+							return;
+						consume(buffer.data(), 1ULL);
+						buffered = 0ULL;
+					}
+
+					const size_t count = size / STRIPE_BYTES;
+					consume(bytes, count);
+					bytes += count * STRIPE_BYTES;
+					size -= count * STRIPE_BYTES;
+					std::memcpy(buffer.data(), bytes, size);
+					buffered = size;
+				}
+				std::uint64_t digest() {
+					// The zero padding of the last stripe is told apart by the length
+					if (buffered > 0ULL) {
+						std::fill(buffer.begin() + static_cast<std::ptrdiff_t>(buffered), buffer.end(), static_cast<unsigned char>(0));
+						consume(buffer.data(), 1ULL);
+						buffered = 0ULL;
+					}
+
+					std::uint64_t result = length * PRIME64_1;
+					for (size_t lane = 0ULL; lane < accumulators.size(); lane++)
+						result = avalanche(result ^ accumulators[lane] ^ key[lane]) + PRIME64_3;
+					return avalanche(result);
+				}
+
+			private:
+				// Functions
+				void consume(const unsigned char* bytes, size_t count) {
+					while (count > 0ULL) {
+						const size_t run = std::min(count, BLOCK_STRIPES - stripes % BLOCK_STRIPES);
+						accumulate(bytes, run);
+						bytes += run * STRIPE_BYTES;
+						count -= run;
+						stripes += run;
+						if (stripes % BLOCK_STRIPES == 0ULL)
+							scramble();
+					}
+				}
+				void accumulate(const unsigned char* bytes, size_t count) {
+#if defined(IT_SIMD_SSE2)
+					__m128i lanes[4];
+					__m128i keys[4];
+					for (int pair = 0; pair < 4; pair++) {
+						lanes[pair] = _mm_load_si128(reinterpret_cast<const __m128i*>(accumulators.data() + 2 * pair));
+						keys[pair] = _mm_load_si128(reinterpret_cast<const __m128i*>(key.data() + 2 * pair));
+					}
+					for (size_t stripe = 0ULL; stripe < count; stripe++, bytes += STRIPE_BYTES) {
+						for (int pair = 0; pair < 4; pair++) {
+							const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + 16 * pair));
+							const __m128i keyed = _mm_xor_si128(data, keys[pair]);
+							const __m128i product = _mm_mul_epu32(keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+							const __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+							lanes[pair] = _mm_add_epi64(lanes[pair], _mm_add_epi64(product, swapped));
+						}
+					}
+					for (int pair = 0; pair < 4; pair++)
+						_mm_store_si128(reinterpret_cast<__m128i*>(accumulators.data() + 2 * pair), lanes[pair]);
+#else
+					for (size_t stripe = 0ULL; stripe < count; stripe++, bytes += STRIPE_BYTES) {
+						std::array<std::uint64_t, 8> data;
+						std::memcpy(data.data(), bytes, STRIPE_BYTES);
+						for (size_t lane = 0ULL; lane < 8ULL; lane++) {
+							const std::uint64_t keyed = data[lane] ^ key[lane];
+							accumulators[lane] += (keyed & 0xFFFFFFFFULL) * (keyed >> 32) + data[lane ^ 1ULL];
+						}
+					}
+#endif
+				}
+				void scramble() {
+					for (size_t lane = 0ULL; lane < accumulators.size(); lane++) {
+						std::uint64_t value = accumulators[lane];
+						value ^= value >> 47;
+						value ^= key[lane];
+						accumulators[lane] = value * PRIME32_1;
+					}
+				}
+		};
+
+		template<typename Sample>
+		std::uint64_t hashSamples(const Samples<Sample>& samples, std::uint64_t seed) {
+			const std::array<std::uint64_t, 4> format{ static_cast<std::uint64_t>(samples.width), static_cast<std::uint64_t>(samples.height), static_cast<std::uint64_t>(samples.channels), sizeof(Sample) };
+			if (!samples.isValid()) {
+				StripeHasher hasher(seed);
+				hasher.update(format.data(), sizeof(format));
+				return hasher.digest();
+			}
+
+			// Fixed chunks of rows keep the result independent of the thread count
+			const size_t rowBytes = samples.rowBytes();
+			const int chunkRows = static_cast<int>(std::clamp(CHUNK_BYTES / rowBytes, size_t{ 1 }, static_cast<size_t>(samples.height)));
+			const int chunkCount = (samples.height + chunkRows - 1) / chunkRows;
+			std::vector<std::uint64_t> chunks(static_cast<size_t>(chunkCount));
+			parallelFor(0, chunkCount, [&](int chunkBegin, int chunkEnd) {
+				for (int chunk = chunkBegin; chunk < chunkEnd; chunk++) {
+					StripeHasher hasher(seed + static_cast<std::uint64_t>(chunk));
+					const int rowEnd = std::min(samples.height, (chunk + 1) * chunkRows);
+					if (samples.stride == rowBytes)
+						hasher.update(samples.row(chunk * chunkRows), rowBytes * static_cast<size_t>(rowEnd - chunk * chunkRows));
+					else
+						for (int y = chunk * chunkRows; y < rowEnd; y++)
+							hasher.update(samples.row(y), rowBytes);
+					chunks[chunk] = hasher.digest();
+				}
+			});
+
+			StripeHasher hasher(seed);
+			hasher.update(format.data(), sizeof(format));
+			hasher.update(chunks.data(), chunks.size() * sizeof(std::uint64_t));
+			return hasher.digest();
+		}
+
+		// Mean luma of columns x rows areas that together cover the image (areas overlap on images smaller than the
+		// grid); 16-bit samples are taken at 8 bits
+		template<typename Sample>
+		std::vector<double> lumaGrid(const Samples<Sample>& samples, int columns, int rows) {
+			constexpr int SHIFT = sizeof(Sample) == 1 ? 0 : 8;
+			const auto spanOf = [](int cell, int cells, int size) {
+				const int begin = static_cast<int>(static_cast<long long>(cell) * size / cells);
+				const int end = static_cast<int>(static_cast<long long>(cell + 1) * size / cells);
+				return std::pair<int, int>{ std::min(begin, size - 1), std::max(end, std::min(begin, size - 1) + 1) };
+			};
+
+			std::vector<double> grid(static_cast<size_t>(columns) * static_cast<size_t>(rows), 0.0);
+			parallelFor(0, rows, [&](int cellBegin, int cellEnd) {
+				std::vector<unsigned long long> columnSums(static_cast<size_t>(samples.width));
+				for (int cellY = cellBegin; cellY < cellEnd; cellY++) {
+					const auto [rowBegin, rowEnd] = spanOf(cellY, rows, samples.height);
+					std::fill(columnSums.begin(), columnSums.end(), 0ULL);
+					for (int y = rowBegin; y < rowEnd; y++) {
+						const Sample* pixel = samples.row(y);
+						for (int x = 0; x < samples.width; x++, pixel += samples.channels) {
+							if (samples.channels >= 3)
+								columnSums[x] += static_cast<unsigned int>((pixel[0] >> SHIFT) * 77 + (pixel[1] >> SHIFT) * 150 + (pixel[2] >> SHIFT) * 29) >> 8;
+							else
+								columnSums[x] += static_cast<unsigned int>(pixel[0] >> SHIFT);
+						}
+					}
+					for (int cellX = 0; cellX < columns; cellX++) {
+						const auto [columnBegin, columnEnd] = spanOf(cellX, columns, samples.width);
+						unsigned long long sum{ 0ULL };
+						for (int x = columnBegin; x < columnEnd; x++)
+							sum += columnSums[x];
+						grid[static_cast<size_t>(cellY) * static_cast<size_t>(columns) + static_cast<size_t>(cellX)] = static_cast<double>(sum) / (static_cast<double>(rowEnd - rowBegin) * static_cast<double>(columnEnd - columnBegin));
+					}
+				}
+			});
+			return grid;
+		}
+
+		std::uint64_t averageHash(const std::vector<double>& grid) {
+			double mean{ 0.0 };
+			for (double value : grid)
+				mean += value;
+			mean /= static_cast<double>(grid.size());
+
+			std::uint64_t hash{ 0ULL };
+			for (size_t bit = 0ULL; bit < 64ULL; bit++)
+				if (grid[bit] > mean)
+					hash |= std::uint64_t{ 1 } << bit;
+			return hash;
+		}
+		std::uint64_t differenceHash(const std::vector<double>& grid) {
+			std::uint64_t hash{ 0ULL };
+			for (size_t y = 0ULL; y < 8ULL; y++)
+				for (size_t x = 0ULL; x < 8ULL; x++)
+					if (grid[y * 9ULL + x] > grid[y * 9ULL + x + 1ULL])
+						hash |= std::uint64_t{ 1 } << (y * 8ULL + x);
+			return hash;
+		}
+		// Lowest 8x8 frequencies of the 32x32 DCT-II, rows then columns
+		std::uint64_t dctHash(const std::vector<double>& grid) {
+			constexpr int SIZE{ 32 };
+			constexpr int KEPT{ 8 };
+			std::array<double, KEPT * SIZE> cosines{};
+			for (int frequency = 0; frequency < KEPT; frequency++)
+				for (int i = 0; i < SIZE; i++)
+					cosines[frequency * SIZE + i] = std::cos(std::numbers::pi * frequency * (2 * i + 1) / (2.0 * SIZE));
+
+			std::array<double, SIZE * KEPT> rows{};
+			for (int y = 0; y < SIZE; y++)
+				for (int u = 0; u < KEPT; u++) {
+					double sum{ 0.0 };
+					for (int x = 0; x < SIZE; x++)
+						sum += grid[static_cast<size_t>(y * SIZE + x)] * cosines[u * SIZE + x];
+					rows[y * KEPT + u] = sum;
+				}
+			std::array<double, KEPT * KEPT> coefficients{};
+			for (int v = 0; v < KEPT; v++)
+				for (int u = 0; u < KEPT; u++) {
+					double sum{ 0.0 };
+					for (int y = 0; y < SIZE; y++)
+						sum += rows[y * KEPT + u] * cosines[v * SIZE + y];
+					coefficients[v * KEPT + u] = sum;
+				}
+
+			// The DC term only carries the overall brightness and stays out of the median
+			std::array<double, KEPT * KEPT - 1> ac{};
+			std::copy(coefficients.begin() + 1, coefficients.end(), ac.begin());
+			std::nth_element(ac.begin(), ac.begin() + ac.size() / 2, ac.end());
+			const double median = ac[ac.size() / 2];
+
+			std::uint64_t hash{ 0ULL };
+			for (size_t bit = 0ULL; bit < 64ULL; bit++)
+				if (coefficients[bit] > median)
+					hash |= std::uint64_t{ 1 } << bit;
+			return hash;
+		}
+
+		template<typename Sample>
+		std::uint64_t hashPerception(const Samples<Sample>& samples, PerceptualHashMethod method) {
+			// Error check
+			if (!samples.isValid())
+				return 0ULL;
+
+			switch (method) {
+				case PerceptualHashMethod::AVERAGE:
+					return averageHash(lumaGrid(samples, 8, 8));
+				case PerceptualHashMethod::DIFFERENCE:
+					return differenceHash(lumaGrid(samples, 9, 8));
+				default:
+					return dctHash(lumaGrid(samples, 32, 32));
+			}
+		}
+
+		// Matches among hashes[begin, end), appended in index order
+		void searchRange(const std::uint64_t* hashes, size_t begin, size_t end, std::uint64_t query, int maximumDistance, std::vector<HashMatch>& matches) {
+			size_t i = begin;
+#if defined(IT_SIMD_AVX2)
+			{
+				const __m256i NIBBLES = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+				const __m256i LOW = _mm256_set1_epi8(0x0F);
+				const __m256i QUERY = _mm256_set1_epi64x(static_cast<long long>(query));
+				const __m256i LIMIT = _mm256_set1_epi64x(maximumDistance);
+				for (; i + 4 <= end; i += 4) {
+					const __m256i bits = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hashes + i)), QUERY);
+					const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(NIBBLES, _mm256_and_si256(bits, LOW)), _mm256_shuffle_epi8(NIBBLES, _mm256_and_si256(_mm256_srli_epi16(bits, 4), LOW)));
+					const __m256i distances = _mm256_sad_epu8(counts, _mm256_setzero_si256());
+					const unsigned int over = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpgt_epi32(distances, LIMIT)));
+					if (over == 0x0F0F0F0FU)
+						continue;
+					for (size_t lane = 0ULL; lane < 4ULL; lane++)
+						if ((over & (1U << (8ULL * lane))) == 0U)
+							matches.push_back({ i + lane, std::popcount(hashes[i + lane] ^ query) });
+				}
+			}
+#elif defined(IT_SIMD_SSSE3)
+			{
+				const __m128i NIBBLES = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+				const __m128i LOW = _mm_set1_epi8(0x0F);
+				const __m128i QUERY = _mm_set1_epi64x(static_cast<long long>(query));
+				const __m128i LIMIT = _mm_set1_epi32(maximumDistance);
+				for (; i + 2 <= end; i += 2) {
+					const __m128i bits = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hashes + i)), QUERY);
+					const __m128i counts = _mm_add_epi8(_mm_shuffle_epi8(NIBBLES, _mm_and_si128(bits, LOW)), _mm_shuffle_epi8(NIBBLES, _mm_and_si128(_mm_srli_epi16(bits, 4), LOW)));
+					const __m128i distances = _mm_sad_epu8(counts, _mm_setzero_si128());
+					const unsigned int over = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpgt_epi32(distances, LIMIT)));
+					if ((over & 0x0101U) == 0x0101U)
+						continue;
+					for (size_t lane = 0ULL; lane < 2ULL; lane++)
+						if ((over & (1U << (8ULL * lane))) == 0U)
+							matches.push_back({ i + lane, std::popcount(hashes[i + lane] ^ query) });
+				}
+			}
+#endif
+			for (; i < end; i++) {
+				const int distance = std::popcount(hashes[i] ^ query);
+				if (distance <= maximumDistance)
+					matches.push_back({ i, distance });
+			}
+		}
+	}
+
+	// Functions | content hashing
+	std::uint64_t contentHash(const ImageView& image, std::uint64_t seed) {
+		return hashSamples(samplesOf(image), seed);
+	}
+	template<IsImage Image>
+	std::uint64_t contentHash(const Image& image, std::uint64_t seed) {
+		return hashSamples(samplesOf(image), seed);
+	}
+
+	// Functions | perceptual hashing
+	std::uint64_t perceptualHash(const ImageView& image, PerceptualHashMethod method) {
+		return hashPerception(samplesOf(image), method);
+	}
+	template<IsImage Image>
+	std::uint64_t perceptualHash(const Image& image, PerceptualHashMethod method) {
+		return hashPerception(samplesOf(image), method);
+	}
+
+	// Functions | search
+	int hammingDistance(std::uint64_t first, std::uint64_t second) {
+		return std::popcount(first ^ second);
+	}
+	bool findNearHashes(const std::uint64_t* hashes, size_t count, std::uint64_t query, int maximumDistance, std::vector<HashMatch>& matches, ExecutionPolicy policy) {
+		matches.clear();
+
+		// Error check
+		if (hashes == nullptr && count > 0ULL)
+			return false;
+		if (maximumDistance < 0)
+			return true;
+
+		// Every range keeps its own matches so the result stays in index order
+		const int rangeCount = static_cast<int>((count + SEARCH_GRAIN - 1) / SEARCH_GRAIN);
+		std::vector<std::vector<HashMatch>> found(static_cast<size_t>(rangeCount));
+		parallelFor(0, rangeCount, [&](int rangeBegin, int rangeEnd) {
+			for (int range = rangeBegin; range < rangeEnd; range++)
+				searchRange(hashes, static_cast<size_t>(range) * SEARCH_GRAIN, std::min(count, static_cast<size_t>(range + 1) * SEARCH_GRAIN), query, maximumDistance, found[range]);
+		}, 1, policy);
+
+		for (const std::vector<HashMatch>& range : found)
+			matches.insert(matches.end(), range.begin(), range.end());
+		return true;
+	}
+	bool findNearHashes(const std::vector<std::uint64_t>& hashes, std::uint64_t query, int maximumDistance, std::vector<HashMatch>& matches, ExecutionPolicy policy) {
+		return findNearHashes(hashes.data(), hashes.size(), query, maximumDistance, matches, policy);
+	}
+
+#define IT_HASHING_INSTANTIATE(Image) \
+	template std::uint64_t contentHash<Image>(const Image&, std::uint64_t); \
+	template std::uint64_t perceptualHash<Image>(const Image&, PerceptualHashMethod);
+
+	IT_HASHING_INSTANTIATE(ImageGray)
+	IT_HASHING_INSTANTIATE(ImageGrayAlpha)
+	IT_HASHING_INSTANTIATE(ImageRGB)
+	IT_HASHING_INSTANTIATE(ImageRGBA)
+	IT_HASHING_INSTANTIATE(ImageGray16)
+	IT_HASHING_INSTANTIATE(ImageGrayAlpha16)
+	IT_HASHING_INSTANTIATE(ImageRGB16)
+	IT_HASHING_INSTANTIATE(ImageRGBA16)
+
+#undef IT_HASHING_INSTANTIATE
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+// Dependencies | std
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Dependencies | core
+#include <core/Parallel.h>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Enums
+	enum class PerceptualHashMethod {
+		AVERAGE,	// aHash: 8x8 luma grid, set where a cell is brighter than the mean
+		DIFFERENCE,	// dHash: 9x8 luma grid, set where a cell is brighter than its right neighbor
+		DCT			// pHash: 32x32 luma grid, set where a low frequency DCT coefficient is above their median
+	};
+
+	// Structs
+	struct HashMatch {
+		// Properties
+		size_t index{ 0 };	// Into the searched hashes
+		int distance{ 0 };	// Differing bits
+	};
+
+	// Functions | content hashing
+	// Hash of the pixel bytes only (row padding is skipped), tagged with the size, channel count and sample size so
+	// equal bytes in different formats hash differently. Rows are hashed in fixed chunks of about 1 MiB in parallel,
+	// 64-byte stripes per step with SSE2 multiply-accumulate lanes in the style of XXH3 (not compatible with its
+	// outputs), and the chunk hashes are hashed again, so the result does not depend on the thread count.
+	std::uint64_t contentHash(const ImageView& image, std::uint64_t seed = 0);
+	template<IsImage Image>
+	std::uint64_t contentHash(const Image& image, std::uint64_t seed = 0);
+
+	// Functions | perceptual hashing
+	// 64-bit hashes of the luma (alpha is ignored) averaged over a small grid of image areas; similar images differ in
+	// few bits. Bit y * 8 + x stands for grid cell (x, y). Returns 0 for empty images.
+	std::uint64_t perceptualHash(const ImageView& image, PerceptualHashMethod method = PerceptualHashMethod::DCT);
+	template<IsImage Image>
+	std::uint64_t perceptualHash(const Image& image, PerceptualHashMethod method = PerceptualHashMethod::DCT);
+
+	// Functions | search
+	int hammingDistance(std::uint64_t first, std::uint64_t second);
+	// Every hash within maximumDistance bits of query, in index order. Population counts run 4 hashes per AVX2 step
+	// (2 with SSSE3) through nibble lookups and byte sums, over parallel chunks of the array.
+	bool findNearHashes(const std::uint64_t* hashes, size_t count, std::uint64_t query, int maximumDistance, std::vector<HashMatch>& matches, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	bool findNearHashes(const std::vector<std::uint64_t>& hashes, std::uint64_t query, int maximumDistance, std::vector<HashMatch>& matches, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+}
@@ -5,12 +5,425 @@
 #include <fstream>
 #include <cstring>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// Dependencies | core
+#include <core/Simd.h>
 
 // Dependencies | stb
 #include <stb/stb_image.h>
 #include <stb/stb_image_write.h>
 
 namespace it {
+	// Internal helpers
+	namespace {
+		// Samples per parallel range; smaller ranges cost more to schedule than they save
+		constexpr size_t PARALLEL_GRAIN = 65536ULL;
+
+		// Runs body over [0, count) on the calling thread or in PARALLEL_GRAIN sized ranges on the shared pool
+		void forEachRange(size_t count, ExecutionPolicy policy, const std::function<void(size_t, size_t)>& body) {
+			const size_t rangeCount = (count + PARALLEL_GRAIN - 1ULL) / PARALLEL_GRAIN;
+			if (policy == ExecutionPolicy::SEQUENTIAL || rangeCount <= 1ULL) {
+				body(0ULL, count);
+				return;
+			}
+
+			parallelFor(0, static_cast<int>(rangeCount), [&](int first, int last) {
+				body(static_cast<size_t>(first) * PARALLEL_GRAIN, std::min(count, static_cast<size_t>(last) * PARALLEL_GRAIN));
+			}, 1, policy);
+		}
+		void copyBytes(void* destination, const void* source, size_t size, ExecutionPolicy policy) {
+			forEachRange(size, policy, [&](size_t begin, size_t end) {
+				std::memcpy(static_cast<unsigned char*>(destination) + begin, static_cast<const unsigned char*>(source) + begin, end - begin);
+			});
+		}
+		// Rows per parallel range for rows of rowSamples samples
+		int fillGrainRows(int rowSamples) {
+			return std::max(1, static_cast<int>(PARALLEL_GRAIN) / std::max(1, rowSamples));
+		}
+
+		// Widening maps 0..255 onto 0..65535 exactly (v * 257)
+		void widenSamples(const unsigned char* source, unsigned short* destination, size_t count) {
+			size_t i = 0ULL;
+#if defined(IT_SIMD_SSE2)
+			for (; i + 16ULL <= count; i += 16ULL) {
+				__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_unpacklo_epi8(bytes, bytes));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i + 8ULL), _mm_unpackhi_epi8(bytes, bytes));
+			}
+#endif
+			for (; i < count; i++)
+				destination[i] = static_cast<unsigned short>(source[i] * 257U);
+		}
+
+		// Narrowing computes (v - ((v + 128) >> 8) + bias) >> 8 without leaving 16 bits. A bias of 128 gives
+		// round(v / 257), the same as (v * 255 + 32895) >> 16; an ordered dither threshold (0..255) per sample spreads
+		// the error. pavgw keeps the carry of v + 128: (avg(v, 127) >> 7) == (v + 128) >> 8.
+		void narrowSamples(const unsigned short* source, unsigned char* destination, size_t count, const unsigned short* bias) {
+			size_t i = 0ULL;
+#if defined(IT_SIMD_SSE2)
+			const __m128i ROUNDING = _mm_set1_epi16(128);
+			const __m128i HALF_ROUNDING = _mm_set1_epi16(127);
+			for (; i + 16ULL <= count; i += 16ULL) {
+				__m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+				__m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + 8ULL));
+				__m128i lowBias = bias ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(bias + i)) : ROUNDING;
+				__m128i highBias = bias ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(bias + i + 8ULL)) : ROUNDING;
+				low = _mm_srli_epi16(_mm_add_epi16(_mm_sub_epi16(low, _mm_srli_epi16(_mm_avg_epu16(low, HALF_ROUNDING), 7)), lowBias), 8);
+				high = _mm_srli_epi16(_mm_add_epi16(_mm_sub_epi16(high, _mm_srli_epi16(_mm_avg_epu16(high, HALF_ROUNDING), 7)), highBias), 8);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packus_epi16(low, high));
+			}
+#endif
+			for (; i < count; i++) {
+				unsigned int value = source[i];
+				unsigned int offset = bias ? bias[i] : 128U;
+				destination[i] = static_cast<unsigned char>((value - ((value + 128U) >> 8) + offset) >> 8);
+			}
+		}
+
+		// Narrows a whole image; dithering uses a 4x4 Bayer matrix shared by all channels of a pixel
+		void narrowImage(const unsigned short* source, unsigned char* destination, int width, int height, int channels, bool dither, ExecutionPolicy policy) {
+			const size_t rowSamples = static_cast<size_t>(width) * static_cast<size_t>(channels);
+			if (!dither) {
+				forEachRange(rowSamples * static_cast<size_t>(height), policy, [&](size_t begin, size_t end) {
+					narrowSamples(source + begin, destination + begin, end - begin, nullptr);
+				});
+				return;
+			}
+
+			static const unsigned short BAYER[4][4] = {
+				{ 0, 8, 2, 10 },
+				{ 12, 4, 14, 6 },
+				{ 3, 11, 1, 9 },
+				{ 15, 7, 13, 5 }
+			};
+
+			// One threshold row per Bayer row, expanded to sample granularity so the kernel stays branch free
+			std::vector<unsigned short> thresholds(rowSamples * 4ULL);
+			for (size_t row = 0ULL; row < 4ULL; row++) {
+				unsigned short* rowThresholds = thresholds.data() + row * rowSamples;
+				for (int x = 0; x < width; x++) {
+					for (int channel = 0; channel < channels; channel++)
+						rowThresholds[static_cast<size_t>(x) * channels + channel] = static_cast<unsigned short>(BAYER[row][x & 3] * 16U + 8U);
+				}
+			}
+
+			parallelForRows({ { 0, 0 }, { width, height } }, [&](const ui::Rect& band) {
+				for (int y = band.top(); y < band.bottom(); y++) {
+					size_t offset = static_cast<size_t>(y) * rowSamples;
+					narrowSamples(source + offset, destination + offset, rowSamples, thresholds.data() + static_cast<size_t>(y & 3) * rowSamples);
+				}
+			}, fillGrainRows(width * channels), policy);
+		}
+
+		// Loads 8-bit samples; 16-bit sources are narrowed with rounding instead of stb's truncating conversion
+		unsigned char* loadNarrowed(const unsigned char* fileInMemory, size_t size, int& width, int& height, int channels) {
+			int unusedChannelParameter{ 0 };
+			if (!stbi_is_16_bit_from_memory(fileInMemory, static_cast<int>(size)))
+				return stbi_load_from_memory(fileInMemory, static_cast<int>(size), &width, &height, &unusedChannelParameter, channels);
+
+			unsigned short* wide = stbi_load_16_from_memory(fileInMemory, static_cast<int>(size), &width, &height, &unusedChannelParameter, channels);
+			if (wide == nullptr)
+				return nullptr;
+
+			unsigned char* narrow = reinterpret_cast<unsigned char*>(std::malloc(static_cast<size_t>(width) * static_cast<size_t>(height) * channels));
+			if (narrow != nullptr)
+				narrowImage(wide, narrow, width, height, channels, false, ExecutionPolicy::PARALLEL);
+			stbi_image_free(wide);
+			return narrow;
+		}
+
+		// PNG CRC-32 (ISO 3309)
+		unsigned int crc32(const unsigned char* data, size_t size, unsigned int crc) {
+			static const auto TABLE = [] {
+				std::array<unsigned int, 256> table{};
+				for (unsigned int n = 0U; n < 256U; n++) {
+					unsigned int c = n;
+					for (int k = 0; k < 8; k++)
+						c = (c & 1U) ? 0xEDB88320U ^ (c >> 1) : c >> 1;
+					table[n] = c;
+				}
+				return table;
+			}();
+
+			crc = ~crc;
+			for (size_t i = 0ULL; i < size; i++)
+				crc = TABLE[(crc ^ data[i]) & 0xFFU] ^ (crc >> 8);
+			return ~crc;
+		}
+
+		// Ancillary chunk written between IHDR and IDAT
+		struct PNGChunk {
+			const char* type{ nullptr };
+			std::vector<unsigned char> data{};
+		};
+
+		// Compresses filtered scanlines (a filter byte before every row) with stb's deflate and writes the PNG file
+		bool writePNG(const std::filesystem::path& path, int width, int height, unsigned char bitDepth, unsigned char colorType, std::vector<unsigned char>& scanlines, const std::vector<PNGChunk>& chunks = {}) {
+			// Error check
+			if (scanlines.size() > static_cast<size_t>(std::numeric_limits<int>::max()))
+				return false;
+
+			int compressedSize{ 0 };
+			unsigned char* compressed = stbi_zlib_compress(scanlines.data(), static_cast<int>(scanlines.size()), &compressedSize, 8);
+			if (compressed == nullptr)
+				return false;
+
+			std::ofstream ofstream{ path, std::ios::binary };
+			auto writeChunk = [&ofstream](const char* type, const unsigned char* chunkData, unsigned int chunkSize) {
+				const unsigned char header[8] = {
+					static_cast<unsigned char>(chunkSize >> 24), static_cast<unsigned char>(chunkSize >> 16),
+					static_cast<unsigned char>(chunkSize >> 8), static_cast<unsigned char>(chunkSize),
+					static_cast<unsigned char>(type[0]), static_cast<unsigned char>(type[1]),
+					static_cast<unsigned char>(type[2]), static_cast<unsigned char>(type[3])
+				};
+				unsigned int crc = crc32(header + 4, 4ULL, 0U);
+				crc = crc32(chunkData, chunkSize, crc);
+				const unsigned char footer[4] = {
+					static_cast<unsigned char>(crc >> 24), static_cast<unsigned char>(crc >> 16),
+					static_cast<unsigned char>(crc >> 8), static_cast<unsigned char>(crc)
+				};
+				ofstream.write(reinterpret_cast<const char*>(header), 8);
+				ofstream.write(reinterpret_cast<const char*>(chunkData), chunkSize);
+				ofstream.write(reinterpret_cast<const char*>(footer), 4);
+			};
+
+			const unsigned char SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+			const unsigned char IHDR[13] = {
+				static_cast<unsigned char>(width >> 24), static_cast<unsigned char>(width >> 16),
+				static_cast<unsigned char>(width >> 8), static_cast<unsigned char>(width),
+				static_cast<unsigned char>(height >> 24), static_cast<unsigned char>(height >> 16),
+				static_cast<unsigned char>(height >> 8), static_cast<unsigned char>(height),
+				bitDepth, colorType, 0U, 0U, 0U
+			};
+			if (ofstream.is_open()) {
+				ofstream.write(reinterpret_cast<const char*>(SIGNATURE), 8);
+				writeChunk("IHDR", IHDR, 13U);
+				for (const PNGChunk& chunk : chunks)
+					writeChunk(chunk.type, chunk.data.data(), static_cast<unsigned int>(chunk.data.size()));
+				writeChunk("IDAT", compressed, static_cast<unsigned int>(compressedSize));
+				writeChunk("IEND", nullptr, 0U);
+			}
+			std::free(compressed);
+
+			return ofstream.good();
+		}
+
+		// stb_image_write only emits 8-bit PNGs, so 16-bit images are encoded here with stb's deflate
+		bool writePNG16(const std::filesystem::path& path, int width, int height, int channels, const unsigned short* data) {
+			static const unsigned char COLOR_TYPES[5] = { 0, 0, 4, 2, 6 };
+
+			// Error check
+			if (data == nullptr || width <= 0 || height <= 0 || channels < 1 || channels > 4)
+				return false;
+
+			// Scanlines: filter byte followed by big-endian samples, "Up" filtered
+			const size_t rowBytes = static_cast<size_t>(width) * static_cast<size_t>(channels) * 2ULL;
+			const size_t rawSize = (rowBytes + 1ULL) * static_cast<size_t>(height);
+			if (rawSize > static_cast<size_t>(std::numeric_limits<int>::max()))
+				return false;
+
+			std::vector<unsigned char> raw(rawSize);
+			std::vector<unsigned char> previous(rowBytes, 0U);
+			std::vector<unsigned char> current(rowBytes);
+			const unsigned short* sample = data;
+			for (int y = 0; y < height; y++) {
+				unsigned char* line = raw.data() + static_cast<size_t>(y) * (rowBytes + 1ULL);
+				for (size_t i = 0ULL; i < rowBytes; i += 2ULL, sample++) {
+					current[i] = static_cast<unsigned char>(*sample >> 8);
+					current[i + 1ULL] = static_cast<unsigned char>(*sample & 0xFFU);
+				}
+				line[0] = 2U;
+				for (size_t i = 0ULL; i < rowBytes; i++)
+					line[i + 1ULL] = static_cast<unsigned char>(current[i] - previous[i]);
+				previous.swap(current);
+			}
+
+			return writePNG(path, width, height, 16U, COLOR_TYPES[channels], raw);
+		}
+
+		// 8-bit palette PNG: PLTE holds the colors, tRNS the alphas up to the last translucent entry
+		bool writePNG8(const std::filesystem::path& path, int width, int height, const unsigned char* indices, const std::vector<glm::u8vec4>& palette) {
+			// Error check
+			if (indices == nullptr || width <= 0 || height <= 0 || palette.empty() || palette.size() > 256ULL)
+				return false;
+
+			// Scanlines: filter byte followed by the indices, unfiltered (filters rarely pay off on palette images)
+			const size_t rowBytes = static_cast<size_t>(width);
+			std::vector<unsigned char> raw((rowBytes + 1ULL) * static_cast<size_t>(height));
+			unsigned char highestIndex{ 0 };
+			for (int y = 0; y < height; y++) {
+				unsigned char* line = raw.data() + static_cast<size_t>(y) * (rowBytes + 1ULL);
+				line[0] = 0U;
+				std::memcpy(line + 1, indices + static_cast<size_t>(y) * rowBytes, rowBytes);
+				highestIndex = std::max(highestIndex, *std::max_element(line + 1, line + 1 + rowBytes));
+			}
+
+			// Decoders reject indices past PLTE, so the palette is padded up to the highest one with transparent black,
+			// which is what expand gives them
+			std::vector<PNGChunk> chunks{ { "PLTE", {} } };
+			size_t alphaCount = 0ULL;
+			const size_t entryCount = std::max<size_t>(palette.size(), static_cast<size_t>(highestIndex) + 1ULL);
+			for (size_t i = 0ULL; i < entryCount; i++) {
+				const glm::u8vec4 color = i < palette.size() ? palette[i] : glm::u8vec4(0U);
+				chunks[0].data.insert(chunks[0].data.end(), { color.r, color.g, color.b });
+				if (color.a != 255U)
+					alphaCount = i + 1ULL;
+			}
+			if (alphaCount > 0ULL) {
+				chunks.push_back({ "tRNS", {} });
+				for (size_t i = 0ULL; i < alphaCount; i++)
+					chunks[1].data.push_back(i < palette.size() ? palette[i].a : 0U);
+			}
+
+			return writePNG(path, width, height, 8U, 3U, raw, chunks);
+		}
+
+		// Palette lookup of count indices; table holds all 256 entries (zero past the palette)
+		void expandIndices(const unsigned char* indices, glm::u8vec4* destination, int count, const std::array<unsigned int, 256>& table, size_t paletteSize) {
+			int x = 0;
+#if defined(IT_SIMD_SSSE3)
+			// Up to 16 colors: the palette fits one register per channel and pshufb looks up 16 pixels at once
+			if (paletteSize <= 16ULL) {
+				alignas(16) unsigned char planes[4][16]{};
+				for (int entry = 0; entry < 16; entry++)
+					for (int channel = 0; channel < 4; channel++)
+						planes[channel][entry] = static_cast<unsigned char>(table[entry] >> (8 * channel));
+				const __m128i red = _mm_load_si128(reinterpret_cast<const __m128i*>(planes[0]));
+				const __m128i green = _mm_load_si128(reinterpret_cast<const __m128i*>(planes[1]));
+				const __m128i blue = _mm_load_si128(reinterpret_cast<const __m128i*>(planes[2]));
+				const __m128i alpha = _mm_load_si128(reinterpret_cast<const __m128i*>(planes[3]));
+				const __m128i SIXTEEN = _mm_set1_epi8(16);
+				for (; x + 16 <= count; x += 16) {
+					__m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + x));
+					// Indices from 16 up get the high bit, which makes pshufb return zero
+					index = _mm_or_si128(index, _mm_cmpeq_epi8(_mm_max_epu8(index, SIXTEEN), index));
+					const __m128i r = _mm_shuffle_epi8(red, index);
+					const __m128i g = _mm_shuffle_epi8(green, index);
+					const __m128i b = _mm_shuffle_epi8(blue, index);
+					const __m128i a = _mm_shuffle_epi8(alpha, index);
+					const __m128i redGreenLow = _mm_unpacklo_epi8(r, g);
+					const __m128i redGreenHigh = _mm_unpackhi_epi8(r, g);
+					const __m128i blueAlphaLow = _mm_unpacklo_epi8(b, a);
+					const __m128i blueAlphaHigh = _mm_unpackhi_epi8(b, a);
+					__m128i* pixels = reinterpret_cast<__m128i*>(destination + x);
+					_mm_storeu_si128(pixels, _mm_unpacklo_epi16(redGreenLow, blueAlphaLow));
+					_mm_storeu_si128(pixels + 1, _mm_unpackhi_epi16(redGreenLow, blueAlphaLow));
+					_mm_storeu_si128(pixels + 2, _mm_unpacklo_epi16(redGreenHigh, blueAlphaHigh));
+					_mm_storeu_si128(pixels + 3, _mm_unpackhi_epi16(redGreenHigh, blueAlphaHigh));
+				}
+			}
+#endif
+#if defined(IT_SIMD_AVX2)
+			for (; x + 8 <= count; x += 8) {
+				const __m256i index = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(indices + x)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + x), _mm256_i32gather_epi32(reinterpret_cast<const int*>(table.data()), index, 4));
+			}
+#endif
+			(void)paletteSize;
+			for (; x < count; x++) {
+				const unsigned int color = table[indices[x]];
+				destination[x] = glm::u8vec4(color & 0xFFU, (color >> 8) & 0xFFU, (color >> 16) & 0xFFU, color >> 24);
+			}
+		}
+
+		// Functions | external memory
+		void releasePixels(void* pixels, PixelDeleter& deleter, bool& borrowed) {
+			if (pixels != nullptr && !borrowed) {
+				if (deleter)
+					deleter(pixels);
+				else
+					stbi_image_free(pixels);
+			}
+			deleter = nullptr;
+			borrowed = false;
+		}
+		PixelDeleter takeDeleter(PixelDeleter& deleter, bool& borrowed) {
+			PixelDeleter taken;
+			if (borrowed)
+				taken = [](void*) {};
+			else if (deleter)
+				taken = std::move(deleter);
+			else
+				taken = [](void* pixels) { stbi_image_free(pixels); };
+			deleter = nullptr;
+			borrowed = false;
+			return taken;
+		}
+	}
+
+	// Functions | file inspection
+	BitDepth bitDepthOf(const std::filesystem::path& path) {
+		int width{ 0 };
+		int height{ 0 };
+		int channels{ 0 };
+		const std::string pathString = path.string();
+		if (!stbi_info(pathString.c_str(), &width, &height, &channels))
+			return BitDepth::UNKNOWN;
+		return stbi_is_16_bit(pathString.c_str()) ? BitDepth::BITS_16 : BitDepth::BITS_8;
+	}
+	BitDepth bitDepthOfMemory(const unsigned char* fileInMemory, size_t size) {
+		int width{ 0 };
+		int height{ 0 };
+		int channels{ 0 };
+		if (fileInMemory == nullptr || size == 0ULL || !stbi_info_from_memory(fileInMemory, static_cast<int>(size), &width, &height, &channels))
+			return BitDepth::UNKNOWN;
+		return stbi_is_16_bit_from_memory(fileInMemory, static_cast<int>(size)) ? BitDepth::BITS_16 : BitDepth::BITS_8;
+	}
+
+	// Functions | batches
+	template<typename Image>
+	bool loadImages(const std::vector<std::filesystem::path>& paths, std::vector<Image>& images, bool flipImagesOnLoad, ExecutionPolicy policy) {
+		images.clear();
+		images.resize(paths.size());
+
+		std::atomic<bool> succeeded{ true };
+		parallelFor(0, static_cast<int>(paths.size()), [&](int first, int last) {
+			for (int i = first; i < last; i++) {
+				if (!images[static_cast<size_t>(i)].load(paths[static_cast<size_t>(i)], flipImagesOnLoad))
+					succeeded = false;
+			}
+		}, 1, policy);
+		return succeeded;
+	}
+	template<typename Image>
+	bool saveImages(const std::vector<Image>& images, const std::vector<std::filesystem::path>& paths, int quality, ExecutionPolicy policy) {
+		// Error check
+		if (images.size() != paths.size())
+			return false;
+
+		std::atomic<bool> succeeded{ true };
+		parallelFor(0, static_cast<int>(images.size()), [&](int first, int last) {
+			for (int i = first; i < last; i++) {
+				if (!images[static_cast<size_t>(i)].save(paths[static_cast<size_t>(i)], quality))
+					succeeded = false;
+			}
+		}, 1, policy);
+		return succeeded;
+	}
+
+	template bool loadImages<ImageGray>(const std::vector<std::filesystem::path>&, std::vector<ImageGray>&, bool, ExecutionPolicy);
+	template bool loadImages<ImageGrayAlpha>(const std::vector<std::filesystem::path>&, std::vector<ImageGrayAlpha>&, bool, ExecutionPolicy);
+	template bool loadImages<ImageRGB>(const std::vector<std::filesystem::path>&, std::vector<ImageRGB>&, bool, ExecutionPolicy);
+	template bool loadImages<ImageRGBA>(const std::vector<std::filesystem::path>&, std::vector<ImageRGBA>&, bool, ExecutionPolicy);
+	template bool loadImages<ImageGray16>(const std::vector<std::filesystem::path>&, std::vector<ImageGray16>&, bool, ExecutionPolicy);
+	template bool loadImages<ImageGrayAlpha16>(const std::vector<std::filesystem::path>&, std::vector<ImageGrayAlpha16>&, bool, ExecutionPolicy);
+	template bool loadImages<ImageRGB16>(const std::vector<std::filesystem::path>&, std::vector<ImageRGB16>&, bool, ExecutionPolicy);
+	template bool loadImages<ImageRGBA16>(const std::vector<std::filesystem::path>&, std::vector<ImageRGBA16>&, bool, ExecutionPolicy);
+	template bool saveImages<ImageGray>(const std::vector<ImageGray>&, const std::vector<std::filesystem::path>&, int, ExecutionPolicy);
+	template bool saveImages<ImageGrayAlpha>(const std::vector<ImageGrayAlpha>&, const std::vector<std::filesystem::path>&, int, ExecutionPolicy);
+	template bool saveImages<ImageRGB>(const std::vector<ImageRGB>&, const std::vector<std::filesystem::path>&, int, ExecutionPolicy);
+	template bool saveImages<ImageRGBA>(const std::vector<ImageRGBA>&, const std::vector<std::filesystem::path>&, int, ExecutionPolicy);
+	template bool saveImages<ImageGray16>(const std::vector<ImageGray16>&, const std::vector<std::filesystem::path>&, int, ExecutionPolicy);
+	template bool saveImages<ImageGrayAlpha16>(const std::vector<ImageGrayAlpha16>&, const std::vector<std::filesystem::path>&, int, ExecutionPolicy);
+	template bool saveImages<ImageRGB16>(const std::vector<ImageRGB16>&, const std::vector<std::filesystem::path>&, int, ExecutionPolicy);
+	template bool saveImages<ImageRGBA16>(const std::vector<ImageRGBA16>&, const std::vector<std::filesystem::path>&, int, ExecutionPolicy);
+
 	// class ImageGray
 
 	// class ImageGray::RowView
@@ -45,6 +458,9 @@ namespace it {
 		this->width = width;
 		this->height = height;
 	}
+	ImageGray::ImageGray(unsigned char* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		wrap(pixels, width, height, ownership, std::move(deleter), stride);
+	}
 	ImageGray::ImageGray(const std::filesystem::path& path) {
 		load(path);
 	}
@@ -59,7 +475,7 @@ namespace it {
 
 		width = other.width;
 		height = other.height;
-		std::copy(other.data, other.data + otherDataSize, data);
+		copyBytes(data, other.data, otherDataSize, ExecutionPolicy::PARALLEL);
 	}
 	ImageGray::ImageGray(const ImageGrayAlpha& other, bool factorInAlpha) {
 		copy(other, factorInAlpha);
@@ -70,6 +486,9 @@ namespace it {
 	ImageGray::ImageGray(const ImageRGBA& other, bool factorInAlpha) {
 		copy(other, factorInAlpha);
 	}
+	ImageGray::ImageGray(const ImageGray16& other, bool dither) {
+		copy(other, dither);
+	}
 	ImageGray::ImageGray(ImageGray&& other) noexcept {
 		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return;
@@ -77,10 +496,14 @@ namespace it {
 		width = other.width;
 		height = other.height;
 		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
 
 		other.width = 0;
 		other.height = 0;
 		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
 	}
 	ImageGray::~ImageGray() {
 		free();
@@ -95,19 +518,19 @@ namespace it {
 		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return *this;
 
+		free();
+
 		width = other.width;
 		height = other.height;
 		data = other.data;
-
-		size_t pixelCount = other.pixelCount();
-		glm::u8vec2* otherData = reinterpret_cast<glm::u8vec2*>(other.data);
-		for (size_t i = 0ULL; i < pixelCount; i++) {
-			data[i] = otherData[i][0];
-		}
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
 
 		other.width = 0;
 		other.height = 0;
 		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
 
 		return *this;
 	}
@@ -173,8 +596,12 @@ namespace it {
 		if (width <= 0 || height <= 0)
 			return nullptr;
 
-		size_t bufferSize = static_cast<size_t>(width * height);
+		size_t bufferSize = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(unsigned char);
 		data = reinterpret_cast<unsigned char*>(std::malloc(bufferSize));
+		if (data == nullptr)
+			return nullptr;
+		this->width = width;
+		this->height = height;
 		return data;
 	}
 	bool ImageGray::isAllocated() const {
@@ -186,10 +613,37 @@ namespace it {
 	void ImageGray::free() {
 		width = 0;
 		height = 0;
-		if (data != nullptr) {
-			stbi_image_free(data);
-			data = nullptr;
-		}
+		releasePixels(data, deleter, borrowed);
+		data = nullptr;
+	}
+
+	// Functions | external memory
+	bool ImageGray::wrap(unsigned char* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		// Error check
+		if (pixels == nullptr || pixels == data || width <= 0 || height <= 0)
+			return false;
+		if (stride != 0 && stride != static_cast<size_t>(width) * sizeof(unsigned char))
+			return false;
+
+		free();
+
+		data = pixels;
+		this->width = width;
+		this->height = height;
+		this->deleter = std::move(deleter);
+		borrowed = ownership == PixelOwnership::BORROW;
+		return true;
+	}
+	unsigned char* ImageGray::release(PixelDeleter& deleter) {
+		unsigned char* pixels = data;
+		deleter = takeDeleter(this->deleter, borrowed);
+		width = 0;
+		height = 0;
+		data = nullptr;
+		return pixels;
+	}
+	bool ImageGray::ownsData() const {
+		return data != nullptr && !borrowed;
 	}
 
 	// Functions | file loading (allocated memory) / saving
@@ -236,15 +690,14 @@ namespace it {
 		free();
 
 		// Set vertical flip
-		stbi_set_flip_vertically_on_load(flipImageOnLoad);
+		stbi_set_flip_vertically_on_load_thread(flipImageOnLoad);
 
 		// Load image with one channel
-		int unusedChannelParameter{ 0 }; // Reason: CHANNELS returns 1, enforcing it to always be 1 channel
-		data = stbi_load_from_memory(fileInMemory, static_cast<int>(size), &width, &height, &unusedChannelParameter, CHANNELS);
+		data = loadNarrowed(fileInMemory, size, width, height, CHANNELS);
 
 		return data != nullptr;
 	}
-	bool ImageGray::copy(const ImageGray& other) {
+	bool ImageGray::copy(const ImageGray& other, ExecutionPolicy policy) {
 		// Error check
 		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -261,12 +714,12 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		std::memcpy(data, other.data, dataSize);
+		copyBytes(data, other.data, dataSize, policy);
 
 		// Success
 		return true;
 	}
-	bool ImageGray::copy(const ImageGrayAlpha& other, bool factorInAlpha) {
+	bool ImageGray::copy(const ImageGrayAlpha& other, bool factorInAlpha, ExecutionPolicy policy) {
 		// Error check
 		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -283,19 +736,21 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		for (size_t i = 0; i < otherPixelCount; i++) {
-			unsigned char pixel = other.data[i].r;
-			if (factorInAlpha) {
-				float alphaFactor = other.data[i][1] / 255.0f; // assuming second channel is alpha
-				pixel = static_cast<unsigned char>(pixel * alphaFactor);
+		forEachRange(otherPixelCount, policy, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++) {
+				unsigned char pixel = other.data[i].r;
+				if (factorInAlpha) {
+					float alphaFactor = other.data[i][1] / 255.0f; // assuming second channel is alpha
+					pixel = static_cast<unsigned char>(pixel * alphaFactor);
+				}
+				data[i] = pixel;
 			}
-			data[i] = pixel;
-		}
+		});
 
 		// Success
 		return true;
 	}
-	bool ImageGray::copy(const ImageRGB& other) {
+	bool ImageGray::copy(const ImageRGB& other, ExecutionPolicy policy) {
 		// Error check
 		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -312,23 +767,25 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		for (size_t i = 0ULL; i < otherPixelCount; i++) {
-			unsigned char r = other.data[i].r;
-			unsigned char g = other.data[i].g;
-			unsigned char b = other.data[i].b;
-
-			// Luminance formula
-			unsigned char pixel = static_cast<unsigned char>(
-			0.299f * r + 0.587f * g + 0.114f * b
-				);
+		forEachRange(otherPixelCount, policy, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++) {
+				unsigned char r = other.data[i].r;
+				unsigned char g = other.data[i].g;
+				unsigned char b = other.data[i].b;
+
+				// Luminance formula
+				unsigned char pixel = static_cast<unsigned char>(
+				0.299f * r + 0.587f * g + 0.114f * b
+					);
 
-			data[i] = pixel;
-		}
+				data[i] = pixel;
+			}
+		});
 
 		// Success
 		return true;
 	}
-	bool ImageGray::copy(const ImageRGBA& other, bool factorInAlpha) {
+	bool ImageGray::copy(const ImageRGBA& other, bool factorInAlpha, ExecutionPolicy policy) {
 		// Error check
 		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -345,23 +802,47 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		for (size_t i = 0ULL; i < otherPixelCount; i++) {
-			unsigned char r = other.data[i].r;
-			unsigned char g = other.data[i].g;
-			unsigned char b = other.data[i].b;
-			unsigned char a = other.data[i].a;
-
-			// Convert ImageRGB to grayscale
-			float pixel = 0.299f * r + 0.587f * g + 0.114f * b;
-
-			// Factor in alpha if requested
-			if (factorInAlpha) {
-				float alphaFactor = a / 255.0f;
-				pixel *= alphaFactor;
+		forEachRange(otherPixelCount, policy, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++) {
+				unsigned char r = other.data[i].r;
+				unsigned char g = other.data[i].g;
+				unsigned char b = other.data[i].b;
+				unsigned char a = other.data[i].a;
+
+				// Convert ImageRGB to grayscale
+				float pixel = 0.299f * r + 0.587f * g + 0.114f * b;
+
+				// Factor in alpha if requested
+				if (factorInAlpha) {
+					float alphaFactor = a / 255.0f;
+					pixel *= alphaFactor;
+				}
+
+				data[i] = static_cast<unsigned char>(pixel);
 			}
+		});
 
-			data[i] = static_cast<unsigned char>(pixel);
-		}
+		// Success
+		return true;
+	}
+	bool ImageGray::copy(const ImageGray16& other, bool dither, ExecutionPolicy policy) {
+		// Error check
+		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return false;
+
+		// Release existing data
+		free();
+
+		// Allocate memory for copy operation
+		size_t pixelCount = other.pixelCount();
+		data = reinterpret_cast<unsigned char*>(std::malloc(pixelCount * sizeof(unsigned char)));
+		if (data == nullptr)
+			return false;
+		width = other.width;
+		height = other.height;
+
+		// Narrow data
+		narrowImage(reinterpret_cast<const unsigned short*>(other.data), reinterpret_cast<unsigned char*>(data), width, height, CHANNELS, dither, policy);
 
 		// Success
 		return true;
@@ -452,22 +933,22 @@ namespace it {
 		// Success
 		return true;
 	}
-	void ImageGray::fillRect(int x, int y, int width, int height, unsigned char color) {
+	void ImageGray::fillRect(int rectX, int rectY, int rectWidth, int rectHeight, unsigned char color, ExecutionPolicy policy) {
 		// Error check
 		assert(data != nullptr);
-		assert(x >= 0 && "rectX < 0");
-		assert(y >= 0 && "rectY < 0");
-		assert(x < this->width && " rectX >= this->rectWidth");
-		assert(y < this->height && "rectY >= this->rectHeight");
-		assert(x + width <= this->width && "specified rectWidth is out of image bounds");
-		assert(y + height <= this->height && "specified rectHeight is out of image bounds");
-		
-		for (int currentX = x; currentX <= x; x++) {
-			for (int currentY = y; y <= y; y++) {
-				size_t index = static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x);
-				data[index] = color;
+		assert(rectX >= 0 && "rectX < 0");
+		assert(rectY >= 0 && "rectY < 0");
+		assert(rectX < width && "rectX >= width");
+		assert(rectY < height && "rectY >= height");
+		assert(rectX + rectWidth <= width && "rectX + rectWidth is out of image bounds");
+		assert(rectY + rectHeight <= height && "rectY + rectHeight is out of image bounds");
+
+		parallelForRows({ { rectX, rectY }, { rectWidth, rectHeight } }, [&](const ui::Rect& band) {
+			for (int currentY = band.top(), yEnd = band.bottom(); currentY < yEnd; ++currentY) {
+				unsigned char* row = data + static_cast<size_t>(currentY) * static_cast<size_t>(width);
+				std::fill(row + rectX, row + rectX + rectWidth, color);
 			}
-		}
+		}, fillGrainRows(rectWidth * CHANNELS), policy);
 	}
 
 	// class ImageGrayAlpha
@@ -504,6 +985,9 @@ namespace it {
 		this->width = width;
 		this->height = height;
 	}
+	ImageGrayAlpha::ImageGrayAlpha(glm::u8vec2* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		wrap(pixels, width, height, ownership, std::move(deleter), stride);
+	}
 	ImageGrayAlpha::ImageGrayAlpha(const std::filesystem::path& path) {
 		load(path);
 	}
@@ -521,7 +1005,7 @@ namespace it {
 
 		width = other.width;
 		height = other.height;
-		std::copy(other.data, other.data + otherDataSize, data);
+		copyBytes(data, other.data, otherDataSize, ExecutionPolicy::PARALLEL);
 	}
 	ImageGrayAlpha::ImageGrayAlpha(const ImageRGB& other) {
 		copy(other);
@@ -529,6 +1013,9 @@ namespace it {
 	ImageGrayAlpha::ImageGrayAlpha(const ImageRGBA& other) {
 		copy(other);
 	}
+	ImageGrayAlpha::ImageGrayAlpha(const ImageGrayAlpha16& other, bool dither) {
+		copy(other, dither);
+	}
 	ImageGrayAlpha::ImageGrayAlpha(ImageGrayAlpha&& other) noexcept {
 		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return;
@@ -536,10 +1023,14 @@ namespace it {
 		width = other.width;
 		height = other.height;
 		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
 
 		other.width = 0;
 		other.height = 0;
 		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
 	}
 	ImageGrayAlpha::~ImageGrayAlpha() {
 		free();
@@ -563,13 +1054,19 @@ namespace it {
 		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return *this;
 
+		free();
+
 		width = other.width;
 		height = other.height;
 		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
 
 		other.width = 0;
 		other.height = 0;
 		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
 
 		return *this;
 	}
@@ -626,8 +1123,12 @@ namespace it {
 		if (width <= 0 || height <= 0)
 			return nullptr;
 
-		size_t bufferSize = static_cast<size_t>(width * height * 2);
+		size_t bufferSize = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(glm::u8vec2);
 		data = reinterpret_cast<glm::u8vec2*>(std::malloc(bufferSize));
+		if (data == nullptr)
+			return nullptr;
+		this->width = width;
+		this->height = height;
 		return data;
 	}
 	bool ImageGrayAlpha::isAllocated() const {
@@ -639,10 +1140,37 @@ namespace it {
 	void ImageGrayAlpha::free() {
 		width = 0;
 		height = 0;
-		if (data != nullptr) {
-			stbi_image_free(data);
-			data = nullptr;
-		}
+		releasePixels(data, deleter, borrowed);
+		data = nullptr;
+	}
+
+	// Functions | external memory
+	bool ImageGrayAlpha::wrap(glm::u8vec2* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		// Error check
+		if (pixels == nullptr || pixels == data || width <= 0 || height <= 0)
+			return false;
+		if (stride != 0 && stride != static_cast<size_t>(width) * sizeof(glm::u8vec2))
+			return false;
+
+		free();
+
+		data = pixels;
+		this->width = width;
+		this->height = height;
+		this->deleter = std::move(deleter);
+		borrowed = ownership == PixelOwnership::BORROW;
+		return true;
+	}
+	glm::u8vec2* ImageGrayAlpha::release(PixelDeleter& deleter) {
+		glm::u8vec2* pixels = data;
+		deleter = takeDeleter(this->deleter, borrowed);
+		width = 0;
+		height = 0;
+		data = nullptr;
+		return pixels;
+	}
+	bool ImageGrayAlpha::ownsData() const {
+		return data != nullptr && !borrowed;
 	}
 
 	// Functions | file loading (allocates memory) / saving
@@ -689,15 +1217,14 @@ namespace it {
 		free();
 
 		// Set vertical flip
-		stbi_set_flip_vertically_on_load(flipImageOnLoad);
+		stbi_set_flip_vertically_on_load_thread(flipImageOnLoad);
 
 		// Load image with one channel
-		int unusedChannelParameter{ 0 }; // Reason: CHANNELS returns 2, enforcing it to always be 2 channel
-		data = reinterpret_cast<glm::u8vec2*>(stbi_load_from_memory(fileInMemory, static_cast<int>(size), &width, &height, &unusedChannelParameter, CHANNELS));
+		data = reinterpret_cast<glm::u8vec2*>(loadNarrowed(fileInMemory, size, width, height, CHANNELS));
 
 		return data != nullptr;
 	}
-	bool ImageGrayAlpha::copy(const ImageGray& other) {
+	bool ImageGrayAlpha::copy(const ImageGray& other, ExecutionPolicy policy) {
 		// Error check
 		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -714,13 +1241,15 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		for (size_t i = 0ULL; i < pixelCount; i++)
-			data[i] = glm::u8vec2(other.data[i], 255U);
+		forEachRange(pixelCount, policy, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++)
+				data[i] = glm::u8vec2(other.data[i], 255U);
+		});
 
 		// Success
 		return true;
 	}
-	bool ImageGrayAlpha::copy(const ImageGrayAlpha& other) {
+	bool ImageGrayAlpha::copy(const ImageGrayAlpha& other, ExecutionPolicy policy) {
 		// Error check
 		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -737,12 +1266,12 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		std::memcpy(data, other.data, dataSize);
+		copyBytes(data, other.data, dataSize, policy);
 
 		// Success
 		return true;
 	}
-	bool ImageGrayAlpha::copy(const ImageRGB& other) {
+	bool ImageGrayAlpha::copy(const ImageRGB& other, ExecutionPolicy policy) {
 		// Error check
 		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -759,23 +1288,25 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		for (size_t i = 0ULL; i < pixelCount; i++) {
-			unsigned char r = other.data[i].r;
-			unsigned char g = other.data[i].g;
-			unsigned char b = other.data[i].b;
-
-			// Luminance formula
-			unsigned char grayValue = static_cast<unsigned char>(
-				0.299f * r + 0.587f * g + 0.114f * b
-				);
-
-			data[i] = glm::u8vec2(grayValue, 255U);
-		}
+		forEachRange(pixelCount, policy, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++) {
+				unsigned char r = other.data[i].r;
+				unsigned char g = other.data[i].g;
+				unsigned char b = other.data[i].b;
+
+				// Luminance formula
+				unsigned char grayValue = static_cast<unsigned char>(
+					0.299f * r + 0.587f * g + 0.114f * b
+					);
+
+				data[i] = glm::u8vec2(grayValue, 255U);
+			}
+		});
 
 		// Success
 		return true;
 	}
-	bool ImageGrayAlpha::copy(const ImageRGBA& other) {
+	bool ImageGrayAlpha::copy(const ImageRGBA& other, ExecutionPolicy policy) {
 		// Error check
 		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -792,18 +1323,42 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		for (size_t i = 0ULL; i < pixelCount; i++) {
-			unsigned char r = other.data[i].r;
-			unsigned char g = other.data[i].g;
-			unsigned char b = other.data[i].b;
+		forEachRange(pixelCount, policy, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++) {
+				unsigned char r = other.data[i].r;
+				unsigned char g = other.data[i].g;
+				unsigned char b = other.data[i].b;
+
+				// Luminance formula
+				unsigned char grayValue = static_cast<unsigned char>(
+					0.299f * r + 0.587f * g + 0.114f * b
+					);
+
+				data[i] = glm::u8vec2(grayValue, other.data[i].a);
+			}
+		});
 
-			// Luminance formula
-			unsigned char grayValue = static_cast<unsigned char>(
-				0.299f * r + 0.587f * g + 0.114f * b
-				);
+		// Success
+		return true;
+	}
+	bool ImageGrayAlpha::copy(const ImageGrayAlpha16& other, bool dither, ExecutionPolicy policy) {
+		// Error check
+		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return false;
 
-			data[i] = glm::u8vec2(grayValue, other.data[i].a);
-		}
+		// Release existing data
+		free();
+
+		// Allocate memory for copy operation
+		size_t pixelCount = other.pixelCount();
+		data = reinterpret_cast<glm::u8vec2*>(std::malloc(pixelCount * sizeof(glm::u8vec2)));
+		if (data == nullptr)
+			return false;
+		width = other.width;
+		height = other.height;
+
+		// Narrow data
+		narrowImage(reinterpret_cast<const unsigned short*>(other.data), reinterpret_cast<unsigned char*>(data), width, height, CHANNELS, dither, policy);
 
 		// Success
 		return true;
@@ -899,7 +1454,7 @@ namespace it {
 		// Success
 		return true;
 	}
-	void ImageGrayAlpha::fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u8vec2& color) {
+	void ImageGrayAlpha::fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u8vec2& color, ExecutionPolicy policy) {
 		// Error check
 		assert(data != nullptr);
 		assert(rectX >= 0 && "rectX < 0");
@@ -909,12 +1464,14 @@ namespace it {
 		assert(rectX + rectWidth <= width && "rectX + rectWidth is out of image bounds");
 		assert(rectY + rectHeight <= height && "rectY + rectHeight is out of image bounds");
 
-		for (int currentY = rectY, yEnd = rectY + rectHeight; currentY < yEnd; ++currentY) {
-			for (int currentX = rectX, xEnd = rectX + rectWidth; currentX < xEnd; ++currentX) {
-				size_t index = static_cast<size_t>(currentY) * static_cast<size_t>(width) + static_cast<size_t>(currentX);
-				data[index] = color;
+		parallelForRows({ { rectX, rectY }, { rectWidth, rectHeight } }, [&](const ui::Rect& band) {
+			for (int currentY = band.top(), yEnd = band.bottom(); currentY < yEnd; ++currentY) {
+				for (int currentX = rectX, xEnd = rectX + rectWidth; currentX < xEnd; ++currentX) {
+					size_t index = static_cast<size_t>(currentY) * static_cast<size_t>(width) + static_cast<size_t>(currentX);
+					data[index] = color;
+				}
 			}
-		}
+		}, fillGrainRows(rectWidth * CHANNELS), policy);
 	}
 
 	// class ImageRGB
@@ -951,6 +1508,9 @@ namespace it {
 		this->width = width;
 		this->height = height;
 	}
+	ImageRGB::ImageRGB(glm::u8vec3* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		wrap(pixels, width, height, ownership, std::move(deleter), stride);
+	}
 	ImageRGB::ImageRGB(const std::filesystem::path& path) {
 		load(path);
 	}
@@ -971,11 +1531,14 @@ namespace it {
 
 		width = other.width;
 		height = other.height;
-		std::copy(other.data, other.data + otherDataSize, data);
+		copyBytes(data, other.data, otherDataSize, ExecutionPolicy::PARALLEL);
 	}
 	ImageRGB::ImageRGB(const ImageRGBA& other, bool factorInAlpha) {
 		copy(other, factorInAlpha);
 	}
+	ImageRGB::ImageRGB(const ImageRGB16& other, bool dither) {
+		copy(other, dither);
+	}
 	ImageRGB::ImageRGB(ImageRGB&& other) noexcept {
 		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return;
@@ -983,10 +1546,14 @@ namespace it {
 		width = other.width;
 		height = other.height;
 		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
 
 		other.width = 0;
 		other.height = 0;
 		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
 	}
 	ImageRGB::~ImageRGB() {
 		free();
@@ -1019,13 +1586,19 @@ namespace it {
 		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return *this;
 
+		free();
+
 		width = other.width;
 		height = other.height;
 		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
 
 		other.width = 0;
 		other.height = 0;
 		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
 
 		return *this;
 	}
@@ -1073,8 +1646,12 @@ namespace it {
 		if (width <= 0 || height <= 0)
 			return nullptr;
 
-		size_t bufferSize = static_cast<size_t>(width * height * 3);
+		size_t bufferSize = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(glm::u8vec3);
 		data = reinterpret_cast<glm::u8vec3*>(std::malloc(bufferSize));
+		if (data == nullptr)
+			return nullptr;
+		this->width = width;
+		this->height = height;
 		return data;
 	}
 	bool ImageRGB::isAllocated() const {
@@ -1086,10 +1663,37 @@ namespace it {
 	void ImageRGB::free() {
 		width = 0;
 		height = 0;
-		if (data != nullptr) {
-			stbi_image_free(data);
-			data = nullptr;
-		}
+		releasePixels(data, deleter, borrowed);
+		data = nullptr;
+	}
+
+	// Functions | external memory
+	bool ImageRGB::wrap(glm::u8vec3* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		// Error check
+		if (pixels == nullptr || pixels == data || width <= 0 || height <= 0)
+			return false;
+		if (stride != 0 && stride != static_cast<size_t>(width) * sizeof(glm::u8vec3))
+			return false;
+
+		free();
+
+		data = pixels;
+		this->width = width;
+		this->height = height;
+		this->deleter = std::move(deleter);
+		borrowed = ownership == PixelOwnership::BORROW;
+		return true;
+	}
+	glm::u8vec3* ImageRGB::release(PixelDeleter& deleter) {
+		glm::u8vec3* pixels = data;
+		deleter = takeDeleter(this->deleter, borrowed);
+		width = 0;
+		height = 0;
+		data = nullptr;
+		return pixels;
+	}
+	bool ImageRGB::ownsData() const {
+		return data != nullptr && !borrowed;
 	}
 
 	// Functions | file loading (allocates memory) / saving
@@ -1136,15 +1740,14 @@ namespace it {
 		free();
 
 		// Set vertical flip
-		stbi_set_flip_vertically_on_load(flipImageOnLoad);
+		stbi_set_flip_vertically_on_load_thread(flipImageOnLoad);
 
 		// Load image with one channel
-		int unusedChannelParameter{ 0 }; // Reason: CHANNELS returns 3, enforcing it to always be 3 channel
-		data = reinterpret_cast<glm::u8vec3*>(stbi_load_from_memory(fileInMemory, static_cast<int>(size), &width, &height, &unusedChannelParameter, CHANNELS));
+		data = reinterpret_cast<glm::u8vec3*>(loadNarrowed(fileInMemory, size, width, height, CHANNELS));
 
 		return data != nullptr;
 	}
-	bool ImageRGB::copy(const ImageGray& other) {
+	bool ImageRGB::copy(const ImageGray& other, ExecutionPolicy policy) {
 		// Error check
 		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -1160,13 +1763,15 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		for (size_t i = 0ULL; i < pixelCount; i++)
-			data[i] = glm::u8vec3(other.data[i], other.data[i], other.data[i]);
+		forEachRange(pixelCount, policy, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++)
+				data[i] = glm::u8vec3(other.data[i], other.data[i], other.data[i]);
+		});
 
 		// Success
 		return true;
 	}
-	bool ImageRGB::copy(const ImageGrayAlpha& other, bool factorInAlpha) {
+	bool ImageRGB::copy(const ImageGrayAlpha& other, bool factorInAlpha, ExecutionPolicy policy) {
 		// Error check
 		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -1182,25 +1787,27 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		for (size_t i = 0ULL; i < pixelCount; i++) {
-			unsigned char gray = other.data[i].x;   // grayscale value
-			unsigned char alpha = other.data[i].y;  // alpha value
-
-			if (factorInAlpha) {
-				// Scale grayscale by alpha (normalized to 0�255)
-				unsigned char scaled = static_cast<unsigned char>((gray * alpha) / 255);
-				data[i] = glm::u8vec3(scaled, scaled, scaled);
+		forEachRange(pixelCount, policy, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++) {
+				unsigned char gray = other.data[i].x;   // grayscale value
+				unsigned char alpha = other.data[i].y;  // alpha value
+
+				if (factorInAlpha) {
+					// Scale grayscale by alpha (normalized to 0�255)
+					unsigned char scaled = static_cast<unsigned char>((gray * alpha) / 255);
+					data[i] = glm::u8vec3(scaled, scaled, scaled);
+				}
+				else {
+					// Just copy grayscale into ImageRGB
+					data[i] = glm::u8vec3(gray, gray, gray);
+				}
 			}
-			else {
-				// Just copy grayscale into ImageRGB
-				data[i] = glm::u8vec3(gray, gray, gray);
-			}
-		}
+		});
 
 		// Success
 		return true;
 	}
-	bool ImageRGB::copy(const ImageRGB& other) {
+	bool ImageRGB::copy(const ImageRGB& other, ExecutionPolicy policy) {
 		// Error check
 		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -1217,12 +1824,12 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		std::memcpy(data, other.data, dataSize);
+		copyBytes(data, other.data, dataSize, policy);
 
 		// Success
 		return true;
 	}
-	bool ImageRGB::copy(const ImageRGBA& other, bool factorInAlpha) {
+	bool ImageRGB::copy(const ImageRGBA& other, bool factorInAlpha, ExecutionPolicy policy) {
 		// Error check
 		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -1238,21 +1845,45 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		for (size_t i = 0ULL; i < pixelCount; i++) {
-			unsigned char r = other.data[i].r;
-			unsigned char g = other.data[i].g;
-			unsigned char b = other.data[i].b;
-			unsigned char a = other.data[i].a;
-
-			if (factorInAlpha) {
-				// Premultiply by alpha
-				r = static_cast<unsigned char>((r * a) / 255);
-				g = static_cast<unsigned char>((g * a) / 255);
-				b = static_cast<unsigned char>((b * a) / 255);
+		forEachRange(pixelCount, policy, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++) {
+				unsigned char r = other.data[i].r;
+				unsigned char g = other.data[i].g;
+				unsigned char b = other.data[i].b;
+				unsigned char a = other.data[i].a;
+
+				if (factorInAlpha) {
+					// Premultiply by alpha
+					r = static_cast<unsigned char>((r * a) / 255);
+					g = static_cast<unsigned char>((g * a) / 255);
+					b = static_cast<unsigned char>((b * a) / 255);
+				}
+
+				data[i] = glm::u8vec3(r, g, b);
 			}
+		});
+		// Success
+		return true;
+	}
+	bool ImageRGB::copy(const ImageRGB16& other, bool dither, ExecutionPolicy policy) {
+		// Error check
+		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return false;
+
+		// Release existing data
+		free();
+
+		// Allocate memory for copy operation
+		size_t pixelCount = other.pixelCount();
+		data = reinterpret_cast<glm::u8vec3*>(std::malloc(pixelCount * sizeof(glm::u8vec3)));
+		if (data == nullptr)
+			return false;
+		width = other.width;
+		height = other.height;
+
+		// Narrow data
+		narrowImage(reinterpret_cast<const unsigned short*>(other.data), reinterpret_cast<unsigned char*>(data), width, height, CHANNELS, dither, policy);
 
-			data[i] = glm::u8vec3(r, g, b);
-		}
 		// Success
 		return true;
 	}
@@ -1346,7 +1977,7 @@ namespace it {
 		// Success
 		return true;
 	}
-	void ImageRGB::fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u8vec3& color) {
+	void ImageRGB::fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u8vec3& color, ExecutionPolicy policy) {
 		// Error check
 		assert(data != nullptr);
 		assert(rectX >= 0 && "rectX < 0");
@@ -1356,12 +1987,14 @@ namespace it {
 		assert(rectX + rectWidth <= width && "rectX + rectWidth is out of image bounds");
 		assert(rectY + rectHeight <= height && "rectY + rectHeight is out of image bounds");
 
-		for (int currentY = rectY, yEnd = rectY + rectHeight; currentY < yEnd; ++currentY) {
-			for (int currentX = rectX, xEnd = rectX + rectWidth; currentX < xEnd; ++currentX) {
-				size_t index = static_cast<size_t>(currentY) * static_cast<size_t>(width) + static_cast<size_t>(currentX);
-				data[index] = color;
+		parallelForRows({ { rectX, rectY }, { rectWidth, rectHeight } }, [&](const ui::Rect& band) {
+			for (int currentY = band.top(), yEnd = band.bottom(); currentY < yEnd; ++currentY) {
+				for (int currentX = rectX, xEnd = rectX + rectWidth; currentX < xEnd; ++currentX) {
+					size_t index = static_cast<size_t>(currentY) * static_cast<size_t>(width) + static_cast<size_t>(currentX);
+					data[index] = color;
+				}
 			}
-		}
+		}, fillGrainRows(rectWidth * CHANNELS), policy);
 	}
 
 	// class ImageRGBA
@@ -1398,6 +2031,9 @@ namespace it {
 		this->width = width;
 		this->height = height;
 	}
+	ImageRGBA::ImageRGBA(glm::u8vec4* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		wrap(pixels, width, height, ownership, std::move(deleter), stride);
+	}
 	ImageRGBA::ImageRGBA(const std::filesystem::path& path) {
 		load(path);
 	}
@@ -1421,7 +2057,10 @@ namespace it {
 
 		width = other.width;
 		height = other.height;
-		std::copy(other.data, other.data + otherDataSize, data);
+		copyBytes(data, other.data, otherDataSize, ExecutionPolicy::PARALLEL);
+	}
+	ImageRGBA::ImageRGBA(const ImageRGBA16& other, bool dither) {
+		copy(other, dither);
 	}
 	ImageRGBA::ImageRGBA(ImageRGBA&& other) noexcept {
 		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
@@ -1430,10 +2069,14 @@ namespace it {
 		width = other.width;
 		height = other.height;
 		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
 
 		other.width = 0;
 		other.height = 0;
 		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
 	}
 	ImageRGBA::~ImageRGBA() {
 		free();
@@ -1475,13 +2118,19 @@ namespace it {
 		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return *this;
 
+		free();
+
 		width = other.width;
 		height = other.height;
 		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
 
 		other.width = 0;
 		other.height = 0;
 		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
 
 		return *this;
 	}
@@ -1520,8 +2169,12 @@ namespace it {
 		if (width <= 0 || height <= 0)
 			return nullptr;
 
-		size_t bufferSize = static_cast<size_t>(width * height * 4);
+		size_t bufferSize = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(glm::u8vec4);
 		data = reinterpret_cast<glm::u8vec4*>(std::malloc(bufferSize));
+		if (data == nullptr)
+			return nullptr;
+		this->width = width;
+		this->height = height;
 		return data;
 	}
 	bool ImageRGBA::isAllocated() const {
@@ -1533,10 +2186,37 @@ namespace it {
 	void ImageRGBA::free() {
 		width = 0;
 		height = 0;
-		if (data != nullptr) {
-			stbi_image_free(data);
-			data = nullptr;
-		}
+		releasePixels(data, deleter, borrowed);
+		data = nullptr;
+	}
+
+	// Functions | external memory
+	bool ImageRGBA::wrap(glm::u8vec4* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		// Error check
+		if (pixels == nullptr || pixels == data || width <= 0 || height <= 0)
+			return false;
+		if (stride != 0 && stride != static_cast<size_t>(width) * sizeof(glm::u8vec4))
+			return false;
+
+		free();
+
+		data = pixels;
+		this->width = width;
+		this->height = height;
+		this->deleter = std::move(deleter);
+		borrowed = ownership == PixelOwnership::BORROW;
+		return true;
+	}
+	glm::u8vec4* ImageRGBA::release(PixelDeleter& deleter) {
+		glm::u8vec4* pixels = data;
+		deleter = takeDeleter(this->deleter, borrowed);
+		width = 0;
+		height = 0;
+		data = nullptr;
+		return pixels;
+	}
+	bool ImageRGBA::ownsData() const {
+		return data != nullptr && !borrowed;
 	}
 
 	// Functions | file loading (allocates memory) / saving
@@ -1583,15 +2263,14 @@ namespace it {
 		free();
 
 		// Set vertical flip
-		stbi_set_flip_vertically_on_load(flipImageOnLoad);
+		stbi_set_flip_vertically_on_load_thread(flipImageOnLoad);
 
 		// Load image with one channel
-		int unusedChannelParameter{ 0 }; // Reason: CHANNELS returns 4, enforcing it to always be 4 channel
-		data = reinterpret_cast<glm::u8vec4*>(stbi_load_from_memory(fileInMemory, static_cast<int>(size), &width, &height, &unusedChannelParameter, CHANNELS));
+		data = reinterpret_cast<glm::u8vec4*>(loadNarrowed(fileInMemory, size, width, height, CHANNELS));
 
 		return data != nullptr;
 	}
-	bool ImageRGBA::copy(const ImageGray& other) {
+	bool ImageRGBA::copy(const ImageGray& other, ExecutionPolicy policy) {
 		// Error check
 		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -1608,13 +2287,15 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		for (size_t i = 0ULL; i < pixelCount; i++)
-			data[i] = glm::u8vec4(other.data[i], other.data[i], other.data[i], 255U);
+		forEachRange(pixelCount, policy, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++)
+				data[i] = glm::u8vec4(other.data[i], other.data[i], other.data[i], 255U);
+		});
 
 		// Success
 		return true;
 	}
-	bool ImageRGBA::copy(const ImageGrayAlpha& other) {
+	bool ImageRGBA::copy(const ImageGrayAlpha& other, ExecutionPolicy policy) {
 		// Error check
 		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -1631,13 +2312,15 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		for (size_t i = 0ULL; i < pixelCount; i++)
-			data[i] = glm::u8vec4(other.data[i][0], other.data[i][0], other.data[i][0], other.data[i][1]);
+		forEachRange(pixelCount, policy, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++)
+				data[i] = glm::u8vec4(other.data[i][0], other.data[i][0], other.data[i][0], other.data[i][1]);
+		});
 
 		// Success
 		return true;
 	}
-	bool ImageRGBA::copy(const ImageRGB& other) {
+	bool ImageRGBA::copy(const ImageRGB& other, ExecutionPolicy policy) {
 		// Error check
 		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -1654,13 +2337,15 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		for (size_t i = 0ULL; i < pixelCount; i++)
-			data[i] = glm::u8vec4(other.data[i].r, other.data[i].g, other.data[i].b, 255U);
+		forEachRange(pixelCount, policy, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++)
+				data[i] = glm::u8vec4(other.data[i].r, other.data[i].g, other.data[i].b, 255U);
+		});
 
 		// Success
 		return true;
 	}
-	bool ImageRGBA::copy(const ImageRGBA& other) {
+	bool ImageRGBA::copy(const ImageRGBA& other, ExecutionPolicy policy) {
 		// Error check
 		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
 			return false;
@@ -1677,25 +2362,1609 @@ namespace it {
 		height = other.height;
 
 		// Copy data
-		std::memcpy(data, other.data, dataSize);
+		copyBytes(data, other.data, dataSize, policy);
 
 		// Success
 		return true;
 	}
-	bool ImageRGBA::saveAsPNG(const std::filesystem::path& path) const {
-		const int STRIDE = width * CHANNELS;
-		return static_cast<bool>(stbi_write_png(path.string().c_str(), width, height, CHANNELS, data, STRIDE));
-	}
+	bool ImageRGBA::copy(const ImageRGBA16& other, bool dither, ExecutionPolicy policy) {
+		// Error check
+		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return false;
+
+		// Release existing data
+		free();
+
+		// Allocate memory for copy operation
+		size_t pixelCount = other.pixelCount();
+		data = reinterpret_cast<glm::u8vec4*>(std::malloc(pixelCount * sizeof(glm::u8vec4)));
+		if (data == nullptr)
+			return false;
+		width = other.width;
+		height = other.height;
+
+		// Narrow data
+		narrowImage(reinterpret_cast<const unsigned short*>(other.data), reinterpret_cast<unsigned char*>(data), width, height, CHANNELS, dither, policy);
+
+		// Success
+		return true;
+	}
+	bool ImageRGBA::saveAsPNG(const std::filesystem::path& path) const {
+		const int STRIDE = width * CHANNELS;
+		return static_cast<bool>(stbi_write_png(path.string().c_str(), width, height, CHANNELS, data, STRIDE));
+	}
 	bool ImageRGBA::saveAsJPEG(const std::filesystem::path& path, int quality) const {
 		return static_cast<bool>(stbi_write_jpg(path.string().c_str(), width, height, CHANNELS, data, quality));
 	}
-	bool ImageRGBA::saveAsBMP(const std::filesystem::path& path) const {
-		return static_cast<bool>(stbi_write_bmp(path.string().c_str(), width, height, CHANNELS, data));
+	bool ImageRGBA::saveAsBMP(const std::filesystem::path& path) const {
+		return static_cast<bool>(stbi_write_bmp(path.string().c_str(), width, height, CHANNELS, data));
+	}
+	bool ImageRGBA::saveAsTGA(const std::filesystem::path& path) const {
+		return static_cast<bool>(stbi_write_tga(path.string().c_str(), width, height, CHANNELS, data));
+	}
+	bool ImageRGBA::save(const std::filesystem::path& path, int quality) const {
+		auto ext = path.extension().string();
+		std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+		if (ext == ".png") {
+			return saveAsPNG(path);
+		}
+		else if (ext == ".jpg" || ext == ".jpeg") {
+			return saveAsJPEG(path, quality);
+		}
+		else if (ext == ".bmp") {
+			return saveAsBMP(path);
+		}
+		else if (ext == ".tga") {
+			return saveAsTGA(path);
+		}
+
+		// Unsupported extension
+		return false;
+	}
+
+	// Functions | pixel manipulation
+	size_t ImageRGBA::pixelCount() const {
+		return static_cast<size_t>(width) * static_cast<size_t>(height);
+	}
+	glm::u8vec4 ImageRGBA::pixelAt(int x, int y) const {
+		// Error check
+		assert(data != nullptr);
+		assert(x >= 0 && "rectX < 0");
+		assert(y >= 0 && "rectY < 0");
+		assert(x < width && " rectX >= rectWidth");
+		assert(y < height && "rectY >= rectHeight");
+		if (!data || x < 0 || x >= width || y < 0 || y >= height)
+			return glm::u8vec4(0u);
+
+		// Get pixel
+		size_t index = (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x));
+		return reinterpret_cast<glm::u8vec4*>(data)[index];
+	}
+	bool ImageRGBA::paintPixel(int x, int y, glm::u8vec4 pixel) {
+		// Error check
+		assert(data != nullptr);
+		assert(x >= 0 && "rectX < 0");
+		assert(y >= 0 && "rectY < 0");
+		assert(x < width && " rectX >= rectWidth");
+		assert(y < height && "rectY >= rectHeight");
+		if (data == nullptr || x < 0 || y < 0 || x >= width || y >= height)
+			return false;
+
+		// Set pixel
+		size_t index = static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x);
+		data[index] = pixel;
+
+		// Success
+		return true;
+	}
+	bool ImageRGBA::paintPixel(int x, int y, glm::vec4 pixel) {
+		// Error check
+		assert(data != nullptr);
+		assert(x >= 0 && "rectX < 0");
+		assert(y >= 0 && "rectY < 0");
+		assert(x < width && " rectX >= rectWidth");
+		assert(y < height && "rectY >= rectHeight");
+		if (data == nullptr || x < 0 || y < 0 || x >= width || y >= height)
+			return false;
+
+		// Set pixel
+		size_t index = static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x);
+		data[index] = glm::u8vec4(
+			static_cast<unsigned char>(std::clamp(pixel[0], 0.0f, 1.0f) * 255.0f),
+			static_cast<unsigned char>(std::clamp(pixel[1], 0.0f, 1.0f) * 255.0f),
+			static_cast<unsigned char>(std::clamp(pixel[2], 0.0f, 1.0f) * 255.0f),
+			static_cast<unsigned char>(std::clamp(pixel[3], 0.0f, 1.0f) * 255.0f)
+		);
+
+		// Success
+		return true;
+	}
+	void ImageRGBA::fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u8vec4& color, ExecutionPolicy policy) {
+		// Error check
+		assert(data != nullptr);
+		assert(rectX >= 0 && "rectX < 0");
+		assert(rectY >= 0 && "rectY < 0");
+		assert(rectX < width && "rectX >= width");
+		assert(rectY < height && "rectY >= height");
+		assert(rectX + rectWidth <= width && "rectX + rectWidth is out of image bounds");
+		assert(rectY + rectHeight <= height && "rectY + rectHeight is out of image bounds");
+
+		parallelForRows({ { rectX, rectY }, { rectWidth, rectHeight } }, [&](const ui::Rect& band) {
+			for (int currentY = band.top(), yEnd = band.bottom(); currentY < yEnd; ++currentY) {
+				for (int currentX = rectX, xEnd = rectX + rectWidth; currentX < xEnd; ++currentX) {
+					size_t index = static_cast<size_t>(currentY) * static_cast<size_t>(width) + static_cast<size_t>(currentX);
+					data[index] = color;
+				}
+			}
+		}, fillGrainRows(rectWidth * CHANNELS), policy);
+	}
+
+	// class ImageGray16
+
+	// class ImageGray16::RowView
+
+	// Object | public
+
+	// Operators | member access
+	unsigned short& ImageGray16::RowView::operator[](size_t x) {
+		assert(data != nullptr && "data == nullptr");
+		assert(width >= 0 && "rectX < 0 (rectWidth is a negative number)");
+		assert(x < static_cast<size_t>(width) && "rectX is out of bounds");
+		return data[x];
+	}
+	const unsigned short& ImageGray16::RowView::operator[](size_t x) const {
+		assert(data != nullptr && "data == nullptr");
+		assert(width >= 0 && "rectX < 0 (rectWidth is a negative number)");
+		assert(x < static_cast<size_t>(width) && "rectX is out of bounds");
+		return data[x];
+	}
+
+	// Object | public
+
+	// Constructor / Destructor
+	ImageGray16::ImageGray16(int width, int height) {
+		assert(width > 0 && "width must be greater than 0");
+		assert(height > 0 && "height must be greater than 0");
+
+		size_t bufferSize = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(unsigned short);
+		data = reinterpret_cast<unsigned short*>(std::malloc(bufferSize));
+		if (data == nullptr)
+			return;
+		this->width = width;
+		this->height = height;
+	}
+	ImageGray16::ImageGray16(unsigned short* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		wrap(pixels, width, height, ownership, std::move(deleter), stride);
+	}
+	ImageGray16::ImageGray16(const std::filesystem::path& path) {
+		load(path);
+	}
+	ImageGray16::ImageGray16(const ImageGray16& other) {
+		copy(other);
+	}
+	ImageGray16::ImageGray16(const ImageGray& other) {
+		copy(other);
+	}
+	ImageGray16::ImageGray16(ImageGray16&& other) noexcept {
+		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return;
+
+		width = other.width;
+		height = other.height;
+		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
+
+		other.width = 0;
+		other.height = 0;
+		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
+	}
+	ImageGray16::~ImageGray16() {
+		free();
+	}
+
+	// Operators | assignment
+	ImageGray16& ImageGray16::operator=(const ImageGray16& other) {
+		copy(other);
+		return *this;
+	}
+	ImageGray16& ImageGray16::operator=(ImageGray16&& other) noexcept {
+		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return *this;
+
+		free();
+
+		width = other.width;
+		height = other.height;
+		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
+
+		other.width = 0;
+		other.height = 0;
+		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
+
+		return *this;
+	}
+	ImageGray16& ImageGray16::operator=(const ImageGray& other) {
+		copy(other);
+		return *this;
+	}
+
+	// Operators | member access operator
+	ImageGray16::RowView ImageGray16::operator[](size_t y) {
+		assert(data != nullptr && "data == nullptr");
+		assert(y < static_cast<size_t>(height) && "y >= height");
+		return RowView{ data + y * width, width };
+	}
+	const ImageGray16::RowView ImageGray16::operator[](size_t y) const {
+		assert(data != nullptr && "data == nullptr");
+		assert(y < static_cast<size_t>(height) && "y >= height");
+		return RowView{ data + y * width, width };
+	}
+
+	// Getters
+	int ImageGray16::getWidth() const {
+		return width;
+	}
+	int ImageGray16::getHeight() const {
+		return height;
+	}
+	int ImageGray16::getChannels() const {
+		return CHANNELS;
+	}
+	unsigned short* ImageGray16::getData() const {
+		return data;
+	}
+
+	// Functions | allocation
+	unsigned short* ImageGray16::allocate(int width, int height) {
+		// Free previous data if any
+		free();
+
+		if (width <= 0 || height <= 0)
+			return nullptr;
+
+		size_t bufferSize = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(unsigned short);
+		data = reinterpret_cast<unsigned short*>(std::malloc(bufferSize));
+		if (data == nullptr)
+			return nullptr;
+		this->width = width;
+		this->height = height;
+		return data;
+	}
+	bool ImageGray16::isAllocated() const {
+		return data != nullptr;
+	}
+	size_t ImageGray16::dataSize() const {
+		return static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(unsigned short);
+	}
+	void ImageGray16::free() {
+		width = 0;
+		height = 0;
+		releasePixels(data, deleter, borrowed);
+		data = nullptr;
+	}
+
+	// Functions | external memory
+	bool ImageGray16::wrap(unsigned short* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		// Error check
+		if (pixels == nullptr || pixels == data || width <= 0 || height <= 0)
+			return false;
+		if (stride != 0 && stride != static_cast<size_t>(width) * sizeof(unsigned short))
+			return false;
+
+		free();
+
+		data = pixels;
+		this->width = width;
+		this->height = height;
+		this->deleter = std::move(deleter);
+		borrowed = ownership == PixelOwnership::BORROW;
+		return true;
+	}
+	unsigned short* ImageGray16::release(PixelDeleter& deleter) {
+		unsigned short* pixels = data;
+		deleter = takeDeleter(this->deleter, borrowed);
+		width = 0;
+		height = 0;
+		data = nullptr;
+		return pixels;
+	}
+	bool ImageGray16::ownsData() const {
+		return data != nullptr && !borrowed;
+	}
+
+	// Functions | file loading (allocated memory) / saving
+	bool ImageGray16::load(const std::filesystem::path& path, bool flipImageOnLoad) {
+		if (path.empty())
+			return false; // No path set
+
+		// Free previous data if any
+		free();
+
+		// Read file into memory
+		std::ifstream ifstream{ path, std::ios::binary };
+		if (!ifstream.is_open())
+			return false; // Failed to open file
+
+		ifstream.seekg(0, std::ios::end);
+		size_t fileSize{ static_cast<size_t>(ifstream.tellg()) };
+		ifstream.seekg(0, std::ios::beg);
+
+		unsigned char* fileData{ static_cast<unsigned char*>(std::malloc(fileSize)) };
+		if (fileData == nullptr)
+			return false; // Memory allocation failed
+
+		if (!ifstream.read(reinterpret_cast<char*>(fileData), fileSize)) {
+			std::free(fileData);
+			return false; // Failed to read file
+		}
+		ifstream.close();
+
+		// Load image from memory
+		bool success{ loadFromMemory(fileData, fileSize, flipImageOnLoad) };
+
+		// Free temporary memory
+		std::free(fileData);
+
+		return success;
+	}
+	bool ImageGray16::loadFromMemory(const unsigned char* fileInMemory, size_t size, bool flipImageOnLoad) {
+		// Error check
+		if (fileInMemory == nullptr || size == 0)
+			return false;
+
+		// Free previous data if any
+		free();
+
+		// Set vertical flip
+		stbi_set_flip_vertically_on_load_thread(flipImageOnLoad);
+
+		// Load image with one channel at 16 bits per channel (stb widens 8-bit sources)
+		int loadedWidth{ 0 };
+		int loadedHeight{ 0 };
+		int unusedChannelParameter{ 0 }; // Reason: CHANNELS returns 1, enforcing it to always be 1 channel
+		data = reinterpret_cast<unsigned short*>(stbi_load_16_from_memory(fileInMemory, static_cast<int>(size), &loadedWidth, &loadedHeight, &unusedChannelParameter, CHANNELS));
+		if (data == nullptr)
+			return false;
+		width = loadedWidth;
+		height = loadedHeight;
+
+		return true;
+	}
+	bool ImageGray16::copy(const ImageGray16& other, ExecutionPolicy policy) {
+		// Error check
+		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return false;
+
+		// Release existing data
+		free();
+
+		// Allocate memory for copy operation
+		size_t dataSize = other.dataSize();
+		data = reinterpret_cast<unsigned short*>(std::malloc(dataSize));
+		if (data == nullptr)
+			return false;
+		width = other.width;
+		height = other.height;
+
+		// Copy data
+		copyBytes(data, other.data, dataSize, policy);
+
+		// Success
+		return true;
+	}
+	bool ImageGray16::copy(const ImageGray& other, ExecutionPolicy policy) {
+		// Error check
+		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return false;
+
+		// Release existing data
+		free();
+
+		// Allocate memory for copy operation
+		size_t pixelCount = other.pixelCount();
+		data = reinterpret_cast<unsigned short*>(std::malloc(pixelCount * sizeof(unsigned short)));
+		if (data == nullptr)
+			return false;
+		width = other.width;
+		height = other.height;
+
+		// Widen data
+		forEachRange(pixelCount * CHANNELS, policy, [&](size_t begin, size_t end) {
+			widenSamples(reinterpret_cast<const unsigned char*>(other.data) + begin, reinterpret_cast<unsigned short*>(data) + begin, end - begin);
+		});
+
+		// Success
+		return true;
+	}
+	bool ImageGray16::saveAsPNG(const std::filesystem::path& path) const {
+		return writePNG16(path, width, height, CHANNELS, reinterpret_cast<const unsigned short*>(data));
+	}
+	bool ImageGray16::saveAsJPEG(const std::filesystem::path& path, int quality) const {
+		return ImageGray(*this).saveAsJPEG(path, quality);
+	}
+	bool ImageGray16::saveAsBMP(const std::filesystem::path& path) const {
+		return ImageGray(*this).saveAsBMP(path);
+	}
+	bool ImageGray16::saveAsTGA(const std::filesystem::path& path) const {
+		return ImageGray(*this).saveAsTGA(path);
+	}
+	bool ImageGray16::save(const std::filesystem::path& path, int quality) const {
+		auto ext = path.extension().string();
+		std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+		if (ext == ".png") {
+			return saveAsPNG(path);
+		}
+		else if (ext == ".jpg" || ext == ".jpeg") {
+			return saveAsJPEG(path, quality);
+		}
+		else if (ext == ".bmp") {
+			return saveAsBMP(path);
+		}
+		else if (ext == ".tga") {
+			return saveAsTGA(path);
+		}
+
+		// Unsupported extension
+		return false;
+	}
+
+	// Functions | pixel manipulation
+	size_t ImageGray16::pixelCount() const {
+		return static_cast<size_t>(width) * static_cast<size_t>(height);
+	}
+	unsigned short ImageGray16::pixelAt(int x, int y) const {
+		// Error check
+		assert(data != nullptr);
+		assert(x >= 0 && "x < 0");
+		assert(y >= 0 && "y < 0");
+		assert(x < width && "x >= width");
+		assert(y < height && "y >= height");
+		if (!data || x < 0 || x >= width || y < 0 || y >= height)
+			return 0U;
+
+		// Get pixel
+		size_t index = (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x));
+		return data[index];
+	}
+	bool ImageGray16::setPixel(int x, int y, unsigned short pixel) {
+		// Error check
+		assert(data != nullptr);
+		assert(x >= 0 && "x < 0");
+		assert(y >= 0 && "y < 0");
+		assert(x < width && "x >= width");
+		assert(y < height && "y >= height");
+		if (data == nullptr || x < 0 || y < 0 || x >= width || y >= height)
+			return false;
+
+		// Set pixel
+		size_t index = (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x));
+		data[index] = pixel;
+
+		// Success
+		return true;
+	}
+	bool ImageGray16::setPixel(int x, int y, float pixel) {
+		// Error check
+		assert(data != nullptr);
+		assert(x >= 0 && "x < 0");
+		assert(y >= 0 && "y < 0");
+		assert(x < width && "x >= width");
+		assert(y < height && "y >= height");
+		if (data == nullptr || x < 0 || y < 0 || x >= width || y >= height)
+			return false;
+
+		// Set pixel
+		size_t index = static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x);
+		data[index] = static_cast<unsigned short>(std::clamp(pixel, 0.0f, 1.0f) * 65535.0f);
+
+		// Success
+		return true;
+	}
+	void ImageGray16::fillRect(int rectX, int rectY, int rectWidth, int rectHeight, unsigned short color, ExecutionPolicy policy) {
+		// Error check
+		assert(data != nullptr);
+		assert(rectX >= 0 && "rectX < 0");
+		assert(rectY >= 0 && "rectY < 0");
+		assert(rectX < width && "rectX >= width");
+		assert(rectY < height && "rectY >= height");
+		assert(rectX + rectWidth <= width && "rectX + rectWidth is out of image bounds");
+		assert(rectY + rectHeight <= height && "rectY + rectHeight is out of image bounds");
+
+		parallelForRows({ { rectX, rectY }, { rectWidth, rectHeight } }, [&](const ui::Rect& band) {
+			for (int currentY = band.top(), yEnd = band.bottom(); currentY < yEnd; ++currentY) {
+				unsigned short* row = data + static_cast<size_t>(currentY) * static_cast<size_t>(width);
+				std::fill(row + rectX, row + rectX + rectWidth, color);
+			}
+		}, fillGrainRows(rectWidth * CHANNELS), policy);
+	}
+
+	// class ImageGrayAlpha16
+
+	// class ImageGrayAlpha16::RowView
+
+	// Object | public
+
+	// Operators | member access
+	glm::u16vec2& ImageGrayAlpha16::RowView::operator[](size_t x) {
+		assert(data != nullptr && "data == nullptr");
+		assert(width >= 0 && "rectX < 0 (rectWidth is a negative number)");
+		assert(x < static_cast<size_t>(width) && "rectX is out of bounds");
+		return data[x];
+	}
+	const glm::u16vec2& ImageGrayAlpha16::RowView::operator[](size_t x) const {
+		assert(data != nullptr && "data == nullptr");
+		assert(width >= 0 && "rectX < 0 (rectWidth is a negative number)");
+		assert(x < static_cast<size_t>(width) && "rectX is out of bounds");
+		return data[x];
+	}
+
+	// Object | public
+
+	// Constructor / Destructor
+	ImageGrayAlpha16::ImageGrayAlpha16(int width, int height) {
+		assert(width > 0 && "width must be greater than 0");
+		assert(height > 0 && "height must be greater than 0");
+
+		size_t bufferSize = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(glm::u16vec2);
+		data = reinterpret_cast<glm::u16vec2*>(std::malloc(bufferSize));
+		if (data == nullptr)
+			return;
+		this->width = width;
+		this->height = height;
+	}
+	ImageGrayAlpha16::ImageGrayAlpha16(glm::u16vec2* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		wrap(pixels, width, height, ownership, std::move(deleter), stride);
+	}
+	ImageGrayAlpha16::ImageGrayAlpha16(const std::filesystem::path& path) {
+		load(path);
+	}
+	ImageGrayAlpha16::ImageGrayAlpha16(const ImageGrayAlpha16& other) {
+		copy(other);
+	}
+	ImageGrayAlpha16::ImageGrayAlpha16(const ImageGrayAlpha& other) {
+		copy(other);
+	}
+	ImageGrayAlpha16::ImageGrayAlpha16(ImageGrayAlpha16&& other) noexcept {
+		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return;
+
+		width = other.width;
+		height = other.height;
+		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
+
+		other.width = 0;
+		other.height = 0;
+		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
+	}
+	ImageGrayAlpha16::~ImageGrayAlpha16() {
+		free();
+	}
+
+	// Operators | assignment
+	ImageGrayAlpha16& ImageGrayAlpha16::operator=(const ImageGrayAlpha16& other) {
+		copy(other);
+		return *this;
+	}
+	ImageGrayAlpha16& ImageGrayAlpha16::operator=(ImageGrayAlpha16&& other) noexcept {
+		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return *this;
+
+		free();
+
+		width = other.width;
+		height = other.height;
+		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
+
+		other.width = 0;
+		other.height = 0;
+		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
+
+		return *this;
+	}
+	ImageGrayAlpha16& ImageGrayAlpha16::operator=(const ImageGrayAlpha& other) {
+		copy(other);
+		return *this;
+	}
+
+	// Operators | member access operator
+	ImageGrayAlpha16::RowView ImageGrayAlpha16::operator[](size_t y) {
+		assert(data != nullptr && "data == nullptr");
+		assert(y < static_cast<size_t>(height) && "y >= height");
+		return RowView{ data + y * width, width };
+	}
+	const ImageGrayAlpha16::RowView ImageGrayAlpha16::operator[](size_t y) const {
+		assert(data != nullptr && "data == nullptr");
+		assert(y < static_cast<size_t>(height) && "y >= height");
+		return RowView{ data + y * width, width };
+	}
+
+	// Getters
+	int ImageGrayAlpha16::getWidth() const {
+		return width;
+	}
+	int ImageGrayAlpha16::getHeight() const {
+		return height;
+	}
+	int ImageGrayAlpha16::getChannels() const {
+		return CHANNELS;
+	}
+	glm::u16vec2* ImageGrayAlpha16::getData() const {
+		return data;
+	}
+
+	// Functions | allocation
+	glm::u16vec2* ImageGrayAlpha16::allocate(int width, int height) {
+		// Free previous data if any
+		free();
+
+		if (width <= 0 || height <= 0)
+			return nullptr;
+
+		size_t bufferSize = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(glm::u16vec2);
+		data = reinterpret_cast<glm::u16vec2*>(std::malloc(bufferSize));
+		if (data == nullptr)
+			return nullptr;
+		this->width = width;
+		this->height = height;
+		return data;
+	}
+	bool ImageGrayAlpha16::isAllocated() const {
+		return data != nullptr;
+	}
+	size_t ImageGrayAlpha16::dataSize() const {
+		return static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(glm::u16vec2);
+	}
+	void ImageGrayAlpha16::free() {
+		width = 0;
+		height = 0;
+		releasePixels(data, deleter, borrowed);
+		data = nullptr;
+	}
+
+	// Functions | external memory
+	bool ImageGrayAlpha16::wrap(glm::u16vec2* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		// Error check
+		if (pixels == nullptr || pixels == data || width <= 0 || height <= 0)
+			return false;
+		if (stride != 0 && stride != static_cast<size_t>(width) * sizeof(glm::u16vec2))
+			return false;
+
+		free();
+
+		data = pixels;
+		this->width = width;
+		this->height = height;
+		this->deleter = std::move(deleter);
+		borrowed = ownership == PixelOwnership::BORROW;
+		return true;
+	}
+	glm::u16vec2* ImageGrayAlpha16::release(PixelDeleter& deleter) {
+		glm::u16vec2* pixels = data;
+		deleter = takeDeleter(this->deleter, borrowed);
+		width = 0;
+		height = 0;
+		data = nullptr;
+		return pixels;
+	}
+	bool ImageGrayAlpha16::ownsData() const {
+		return data != nullptr && !borrowed;
+	}
+
+	// Functions | file loading (allocated memory) / saving
+	bool ImageGrayAlpha16::load(const std::filesystem::path& path, bool flipImageOnLoad) {
+		if (path.empty())
+			return false; // No path set
+
+		// Free previous data if any
+		free();
+
+		// Read file into memory
+		std::ifstream ifstream{ path, std::ios::binary };
+		if (!ifstream.is_open())
+			return false; // Failed to open file
+
+		ifstream.seekg(0, std::ios::end);
+		size_t fileSize{ static_cast<size_t>(ifstream.tellg()) };
+		ifstream.seekg(0, std::ios::beg);
+
+		unsigned char* fileData{ static_cast<unsigned char*>(std::malloc(fileSize)) };
+		if (fileData == nullptr)
+			return false; // Memory allocation failed
+
+		if (!ifstream.read(reinterpret_cast<char*>(fileData), fileSize)) {
+			std::free(fileData);
+			return false; // Failed to read file
+		}
+		ifstream.close();
+
+		// Load image from memory
+		bool success{ loadFromMemory(fileData, fileSize, flipImageOnLoad) };
+
+		// Free temporary memory
+		std::free(fileData);
+
+		return success;
+	}
+	bool ImageGrayAlpha16::loadFromMemory(const unsigned char* fileInMemory, size_t size, bool flipImageOnLoad) {
+		// Error check
+		if (fileInMemory == nullptr || size == 0)
+			return false;
+
+		// Free previous data if any
+		free();
+
+		// Set vertical flip
+		stbi_set_flip_vertically_on_load_thread(flipImageOnLoad);
+
+		// Load image with two channels at 16 bits per channel (stb widens 8-bit sources)
+		int loadedWidth{ 0 };
+		int loadedHeight{ 0 };
+		int unusedChannelParameter{ 0 }; // Reason: CHANNELS returns 2, enforcing it to always be 2 channel
+		data = reinterpret_cast<glm::u16vec2*>(stbi_load_16_from_memory(fileInMemory, static_cast<int>(size), &loadedWidth, &loadedHeight, &unusedChannelParameter, CHANNELS));
+		if (data == nullptr)
+			return false;
+		width = loadedWidth;
+		height = loadedHeight;
+
+		return true;
+	}
+	bool ImageGrayAlpha16::copy(const ImageGrayAlpha16& other, ExecutionPolicy policy) {
+		// Error check
+		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return false;
+
+		// Release existing data
+		free();
+
+		// Allocate memory for copy operation
+		size_t dataSize = other.dataSize();
+		data = reinterpret_cast<glm::u16vec2*>(std::malloc(dataSize));
+		if (data == nullptr)
+			return false;
+		width = other.width;
+		height = other.height;
+
+		// Copy data
+		copyBytes(data, other.data, dataSize, policy);
+
+		// Success
+		return true;
+	}
+	bool ImageGrayAlpha16::copy(const ImageGrayAlpha& other, ExecutionPolicy policy) {
+		// Error check
+		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return false;
+
+		// Release existing data
+		free();
+
+		// Allocate memory for copy operation
+		size_t pixelCount = other.pixelCount();
+		data = reinterpret_cast<glm::u16vec2*>(std::malloc(pixelCount * sizeof(glm::u16vec2)));
+		if (data == nullptr)
+			return false;
+		width = other.width;
+		height = other.height;
+
+		// Widen data
+		forEachRange(pixelCount * CHANNELS, policy, [&](size_t begin, size_t end) {
+			widenSamples(reinterpret_cast<const unsigned char*>(other.data) + begin, reinterpret_cast<unsigned short*>(data) + begin, end - begin);
+		});
+
+		// Success
+		return true;
+	}
+	bool ImageGrayAlpha16::saveAsPNG(const std::filesystem::path& path) const {
+		return writePNG16(path, width, height, CHANNELS, reinterpret_cast<const unsigned short*>(data));
+	}
+	bool ImageGrayAlpha16::saveAsJPEG(const std::filesystem::path& path, int quality) const {
+		return ImageGrayAlpha(*this).saveAsJPEG(path, quality);
+	}
+	bool ImageGrayAlpha16::saveAsBMP(const std::filesystem::path& path) const {
+		return ImageGrayAlpha(*this).saveAsBMP(path);
+	}
+	bool ImageGrayAlpha16::saveAsTGA(const std::filesystem::path& path) const {
+		return ImageGrayAlpha(*this).saveAsTGA(path);
+	}
+	bool ImageGrayAlpha16::save(const std::filesystem::path& path, int quality) const {
+		auto ext = path.extension().string();
+		std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+		if (ext == ".png") {
+			return saveAsPNG(path);
+		}
+		else if (ext == ".jpg" || ext == ".jpeg") {
+			return saveAsJPEG(path, quality);
+		}
+		else if (ext == ".bmp") {
+			return saveAsBMP(path);
+		}
+		else if (ext == ".tga") {
+			return saveAsTGA(path);
+		}
+
+		// Unsupported extension
+		return false;
+	}
+
+	// Functions | pixel manipulation
+	size_t ImageGrayAlpha16::pixelCount() const {
+		return static_cast<size_t>(width) * static_cast<size_t>(height);
+	}
+	glm::u16vec2 ImageGrayAlpha16::pixelAt(int x, int y) const {
+		// Error check
+		assert(data != nullptr);
+		assert(x >= 0 && "x < 0");
+		assert(y >= 0 && "y < 0");
+		assert(x < width && "x >= width");
+		assert(y < height && "y >= height");
+		if (!data || x < 0 || x >= width || y < 0 || y >= height)
+			return glm::u16vec2(0U);
+
+		// Get pixel
+		size_t index = (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x));
+		return data[index];
+	}
+	bool ImageGrayAlpha16::setPixel(int x, int y, glm::u16vec2 pixel) {
+		// Error check
+		assert(data != nullptr);
+		assert(x >= 0 && "x < 0");
+		assert(y >= 0 && "y < 0");
+		assert(x < width && "x >= width");
+		assert(y < height && "y >= height");
+		if (data == nullptr || x < 0 || y < 0 || x >= width || y >= height)
+			return false;
+
+		// Set pixel
+		size_t index = (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x));
+		data[index] = pixel;
+
+		// Success
+		return true;
+	}
+	bool ImageGrayAlpha16::setPixel(int x, int y, glm::vec2 pixel) {
+		// Error check
+		assert(data != nullptr);
+		assert(x >= 0 && "x < 0");
+		assert(y >= 0 && "y < 0");
+		assert(x < width && "x >= width");
+		assert(y < height && "y >= height");
+		if (data == nullptr || x < 0 || y < 0 || x >= width || y >= height)
+			return false;
+
+		// Set pixel
+		size_t index = static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x);
+		data[index] = glm::u16vec2(
+			static_cast<unsigned short>(std::clamp(pixel[0], 0.0f, 1.0f) * 65535.0f),
+			static_cast<unsigned short>(std::clamp(pixel[1], 0.0f, 1.0f) * 65535.0f)
+		);
+
+		// Success
+		return true;
+	}
+	void ImageGrayAlpha16::fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u16vec2& color, ExecutionPolicy policy) {
+		// Error check
+		assert(data != nullptr);
+		assert(rectX >= 0 && "rectX < 0");
+		assert(rectY >= 0 && "rectY < 0");
+		assert(rectX < width && "rectX >= width");
+		assert(rectY < height && "rectY >= height");
+		assert(rectX + rectWidth <= width && "rectX + rectWidth is out of image bounds");
+		assert(rectY + rectHeight <= height && "rectY + rectHeight is out of image bounds");
+
+		parallelForRows({ { rectX, rectY }, { rectWidth, rectHeight } }, [&](const ui::Rect& band) {
+			for (int currentY = band.top(), yEnd = band.bottom(); currentY < yEnd; ++currentY) {
+				glm::u16vec2* row = data + static_cast<size_t>(currentY) * static_cast<size_t>(width);
+				std::fill(row + rectX, row + rectX + rectWidth, color);
+			}
+		}, fillGrainRows(rectWidth * CHANNELS), policy);
+	}
+
+	// class ImageRGB16
+
+	// class ImageRGB16::RowView
+
+	// Object | public
+
+	// Operators | member access
+	glm::u16vec3& ImageRGB16::RowView::operator[](size_t x) {
+		assert(data != nullptr && "data == nullptr");
+		assert(width >= 0 && "rectX < 0 (rectWidth is a negative number)");
+		assert(x < static_cast<size_t>(width) && "rectX is out of bounds");
+		return data[x];
+	}
+	const glm::u16vec3& ImageRGB16::RowView::operator[](size_t x) const {
+		assert(data != nullptr && "data == nullptr");
+		assert(width >= 0 && "rectX < 0 (rectWidth is a negative number)");
+		assert(x < static_cast<size_t>(width) && "rectX is out of bounds");
+		return data[x];
+	}
+
+	// Object | public
+
+	// Constructor / Destructor
+	ImageRGB16::ImageRGB16(int width, int height) {
+		assert(width > 0 && "width must be greater than 0");
+		assert(height > 0 && "height must be greater than 0");
+
+		size_t bufferSize = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(glm::u16vec3);
+		data = reinterpret_cast<glm::u16vec3*>(std::malloc(bufferSize));
+		if (data == nullptr)
+			return;
+		this->width = width;
+		this->height = height;
+	}
+	ImageRGB16::ImageRGB16(glm::u16vec3* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		wrap(pixels, width, height, ownership, std::move(deleter), stride);
+	}
+	ImageRGB16::ImageRGB16(const std::filesystem::path& path) {
+		load(path);
+	}
+	ImageRGB16::ImageRGB16(const ImageRGB16& other) {
+		copy(other);
+	}
+	ImageRGB16::ImageRGB16(const ImageRGB& other) {
+		copy(other);
+	}
+	ImageRGB16::ImageRGB16(ImageRGB16&& other) noexcept {
+		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return;
+
+		width = other.width;
+		height = other.height;
+		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
+
+		other.width = 0;
+		other.height = 0;
+		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
+	}
+	ImageRGB16::~ImageRGB16() {
+		free();
+	}
+
+	// Operators | assignment
+	ImageRGB16& ImageRGB16::operator=(const ImageRGB16& other) {
+		copy(other);
+		return *this;
+	}
+	ImageRGB16& ImageRGB16::operator=(ImageRGB16&& other) noexcept {
+		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return *this;
+
+		free();
+
+		width = other.width;
+		height = other.height;
+		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
+
+		other.width = 0;
+		other.height = 0;
+		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
+
+		return *this;
+	}
+	ImageRGB16& ImageRGB16::operator=(const ImageRGB& other) {
+		copy(other);
+		return *this;
+	}
+
+	// Operators | member access operator
+	ImageRGB16::RowView ImageRGB16::operator[](size_t y) {
+		assert(data != nullptr && "data == nullptr");
+		assert(y < static_cast<size_t>(height) && "y >= height");
+		return RowView{ data + y * width, width };
+	}
+	const ImageRGB16::RowView ImageRGB16::operator[](size_t y) const {
+		assert(data != nullptr && "data == nullptr");
+		assert(y < static_cast<size_t>(height) && "y >= height");
+		return RowView{ data + y * width, width };
+	}
+
+	// Getters
+	int ImageRGB16::getWidth() const {
+		return width;
+	}
+	int ImageRGB16::getHeight() const {
+		return height;
+	}
+	int ImageRGB16::getChannels() const {
+		return CHANNELS;
+	}
+	glm::u16vec3* ImageRGB16::getData() const {
+		return data;
+	}
+
+	// Functions | allocation
+	glm::u16vec3* ImageRGB16::allocate(int width, int height) {
+		// Free previous data if any
+		free();
+
+		if (width <= 0 || height <= 0)
+			return nullptr;
+
+		size_t bufferSize = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(glm::u16vec3);
+		data = reinterpret_cast<glm::u16vec3*>(std::malloc(bufferSize));
+		if (data == nullptr)
+			return nullptr;
+		this->width = width;
+		this->height = height;
+		return data;
+	}
+	bool ImageRGB16::isAllocated() const {
+		return data != nullptr;
+	}
+	size_t ImageRGB16::dataSize() const {
+		return static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(glm::u16vec3);
+	}
+	void ImageRGB16::free() {
+		width = 0;
+		height = 0;
+		releasePixels(data, deleter, borrowed);
+		data = nullptr;
+	}
+
+	// Functions | external memory
+	bool ImageRGB16::wrap(glm::u16vec3* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		// Error check
+		if (pixels == nullptr || pixels == data || width <= 0 || height <= 0)
+			return false;
+		if (stride != 0 && stride != static_cast<size_t>(width) * sizeof(glm::u16vec3))
+			return false;
+
+		free();
+
+		data = pixels;
+		this->width = width;
+		this->height = height;
+		this->deleter = std::move(deleter);
+		borrowed = ownership == PixelOwnership::BORROW;
+		return true;
+	}
+	glm::u16vec3* ImageRGB16::release(PixelDeleter& deleter) {
+		glm::u16vec3* pixels = data;
+		deleter = takeDeleter(this->deleter, borrowed);
+		width = 0;
+		height = 0;
+		data = nullptr;
+		return pixels;
+	}
+	bool ImageRGB16::ownsData() const {
+		return data != nullptr && !borrowed;
+	}
+
+	// Functions | file loading (allocated memory) / saving
+	bool ImageRGB16::load(const std::filesystem::path& path, bool flipImageOnLoad) {
+		if (path.empty())
+			return false; // No path set
+
+		// Free previous data if any
+		free();
+
+		// Read file into memory
+		std::ifstream ifstream{ path, std::ios::binary };
+		if (!ifstream.is_open())
+			return false; // Failed to open file
+
+		ifstream.seekg(0, std::ios::end);
+		size_t fileSize{ static_cast<size_t>(ifstream.tellg()) };
+		ifstream.seekg(0, std::ios::beg);
+
+		unsigned char* fileData{ static_cast<unsigned char*>(std::malloc(fileSize)) };
+		if (fileData == nullptr)
+			return false; // Memory allocation failed
+
+		if (!ifstream.read(reinterpret_cast<char*>(fileData), fileSize)) {
+			std::free(fileData);
+			return false; // Failed to read file
+		}
+		ifstream.close();
+
+		// Load image from memory
+		bool success{ loadFromMemory(fileData, fileSize, flipImageOnLoad) };
+
+		// Free temporary memory
+		std::free(fileData);
+
+		return success;
+	}
+	bool ImageRGB16::loadFromMemory(const unsigned char* fileInMemory, size_t size, bool flipImageOnLoad) {
+		// Error check
+		if (fileInMemory == nullptr || size == 0)
+			return false;
+
+		// Free previous data if any
+		free();
+
+		// Set vertical flip
+		stbi_set_flip_vertically_on_load_thread(flipImageOnLoad);
+
+		// Load image with three channels at 16 bits per channel (stb widens 8-bit sources)
+		int loadedWidth{ 0 };
+		int loadedHeight{ 0 };
+		int unusedChannelParameter{ 0 }; // Reason: CHANNELS returns 3, enforcing it to always be 3 channel
+		data = reinterpret_cast<glm::u16vec3*>(stbi_load_16_from_memory(fileInMemory, static_cast<int>(size), &loadedWidth, &loadedHeight, &unusedChannelParameter, CHANNELS));
+		if (data == nullptr)
+			return false;
+		width = loadedWidth;
+		height = loadedHeight;
+
+		return true;
+	}
+	bool ImageRGB16::copy(const ImageRGB16& other, ExecutionPolicy policy) {
+		// Error check
+		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return false;
+
+		// Release existing data
+		free();
+
+		// Allocate memory for copy operation
+		size_t dataSize = other.dataSize();
+		data = reinterpret_cast<glm::u16vec3*>(std::malloc(dataSize));
+		if (data == nullptr)
+			return false;
+		width = other.width;
+		height = other.height;
+
+		// Copy data
+		copyBytes(data, other.data, dataSize, policy);
+
+		// Success
+		return true;
+	}
+	bool ImageRGB16::copy(const ImageRGB& other, ExecutionPolicy policy) {
+		// Error check
+		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return false;
+
+		// Release existing data
+		free();
+
+		// Allocate memory for copy operation
+		size_t pixelCount = other.getPixelCount();
+		data = reinterpret_cast<glm::u16vec3*>(std::malloc(pixelCount * sizeof(glm::u16vec3)));
+		if (data == nullptr)
+			return false;
+		width = other.width;
+		height = other.height;
+
+		// Widen data
+		forEachRange(pixelCount * CHANNELS, policy, [&](size_t begin, size_t end) {
+			widenSamples(reinterpret_cast<const unsigned char*>(other.data) + begin, reinterpret_cast<unsigned short*>(data) + begin, end - begin);
+		});
+
+		// Success
+		return true;
+	}
+	bool ImageRGB16::saveAsPNG(const std::filesystem::path& path) const {
+		return writePNG16(path, width, height, CHANNELS, reinterpret_cast<const unsigned short*>(data));
+	}
+	bool ImageRGB16::saveAsJPEG(const std::filesystem::path& path, int quality) const {
+		return ImageRGB(*this).saveAsJPEG(path, quality);
+	}
+	bool ImageRGB16::saveAsBMP(const std::filesystem::path& path) const {
+		return ImageRGB(*this).saveAsBMP(path);
+	}
+	bool ImageRGB16::saveAsTGA(const std::filesystem::path& path) const {
+		return ImageRGB(*this).saveAsTGA(path);
+	}
+	bool ImageRGB16::save(const std::filesystem::path& path, int quality) const {
+		auto ext = path.extension().string();
+		std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+		if (ext == ".png") {
+			return saveAsPNG(path);
+		}
+		else if (ext == ".jpg" || ext == ".jpeg") {
+			return saveAsJPEG(path, quality);
+		}
+		else if (ext == ".bmp") {
+			return saveAsBMP(path);
+		}
+		else if (ext == ".tga") {
+			return saveAsTGA(path);
+		}
+
+		// Unsupported extension
+		return false;
+	}
+
+	// Functions | pixel manipulation
+	size_t ImageRGB16::pixelCount() const {
+		return static_cast<size_t>(width) * static_cast<size_t>(height);
+	}
+	glm::u16vec3 ImageRGB16::pixelAt(int x, int y) const {
+		// Error check
+		assert(data != nullptr);
+		assert(x >= 0 && "x < 0");
+		assert(y >= 0 && "y < 0");
+		assert(x < width && "x >= width");
+		assert(y < height && "y >= height");
+		if (!data || x < 0 || x >= width || y < 0 || y >= height)
+			return glm::u16vec3(0U);
+
+		// Get pixel
+		size_t index = (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x));
+		return data[index];
+	}
+	bool ImageRGB16::setPixel(int x, int y, glm::u16vec3 pixel) {
+		// Error check
+		assert(data != nullptr);
+		assert(x >= 0 && "x < 0");
+		assert(y >= 0 && "y < 0");
+		assert(x < width && "x >= width");
+		assert(y < height && "y >= height");
+		if (data == nullptr || x < 0 || y < 0 || x >= width || y >= height)
+			return false;
+
+		// Set pixel
+		size_t index = (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x));
+		data[index] = pixel;
+
+		// Success
+		return true;
+	}
+	bool ImageRGB16::setPixel(int x, int y, glm::vec3 pixel) {
+		// Error check
+		assert(data != nullptr);
+		assert(x >= 0 && "x < 0");
+		assert(y >= 0 && "y < 0");
+		assert(x < width && "x >= width");
+		assert(y < height && "y >= height");
+		if (data == nullptr || x < 0 || y < 0 || x >= width || y >= height)
+			return false;
+
+		// Set pixel
+		size_t index = static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x);
+		data[index] = glm::u16vec3(
+			static_cast<unsigned short>(std::clamp(pixel[0], 0.0f, 1.0f) * 65535.0f),
+			static_cast<unsigned short>(std::clamp(pixel[1], 0.0f, 1.0f) * 65535.0f),
+			static_cast<unsigned short>(std::clamp(pixel[2], 0.0f, 1.0f) * 65535.0f)
+		);
+
+		// Success
+		return true;
+	}
+	void ImageRGB16::fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u16vec3& color, ExecutionPolicy policy) {
+		// Error check
+		assert(data != nullptr);
+		assert(rectX >= 0 && "rectX < 0");
+		assert(rectY >= 0 && "rectY < 0");
+		assert(rectX < width && "rectX >= width");
+		assert(rectY < height && "rectY >= height");
+		assert(rectX + rectWidth <= width && "rectX + rectWidth is out of image bounds");
+		assert(rectY + rectHeight <= height && "rectY + rectHeight is out of image bounds");
+
+		parallelForRows({ { rectX, rectY }, { rectWidth, rectHeight } }, [&](const ui::Rect& band) {
+			for (int currentY = band.top(), yEnd = band.bottom(); currentY < yEnd; ++currentY) {
+				glm::u16vec3* row = data + static_cast<size_t>(currentY) * static_cast<size_t>(width);
+				std::fill(row + rectX, row + rectX + rectWidth, color);
+			}
+		}, fillGrainRows(rectWidth * CHANNELS), policy);
+	}
+
+	// class ImageRGBA16
+
+	// class ImageRGBA16::RowView
+
+	// Object | public
+
+	// Operators | member access
+	glm::u16vec4& ImageRGBA16::RowView::operator[](size_t x) {
+		assert(data != nullptr && "data == nullptr");
+		assert(width >= 0 && "rectX < 0 (rectWidth is a negative number)");
+		assert(x < static_cast<size_t>(width) && "rectX is out of bounds");
+		return data[x];
+	}
+	const glm::u16vec4& ImageRGBA16::RowView::operator[](size_t x) const {
+		assert(data != nullptr && "data == nullptr");
+		assert(width >= 0 && "rectX < 0 (rectWidth is a negative number)");
+		assert(x < static_cast<size_t>(width) && "rectX is out of bounds");
+		return data[x];
+	}
+
+	// Object | public
+
+	// Constructor / Destructor
+	ImageRGBA16::ImageRGBA16(int width, int height) {
+		assert(width > 0 && "width must be greater than 0");
+		assert(height > 0 && "height must be greater than 0");
+
+		size_t bufferSize = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(glm::u16vec4);
+		data = reinterpret_cast<glm::u16vec4*>(std::malloc(bufferSize));
+		if (data == nullptr)
+			return;
+		this->width = width;
+		this->height = height;
+	}
+	ImageRGBA16::ImageRGBA16(glm::u16vec4* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		wrap(pixels, width, height, ownership, std::move(deleter), stride);
+	}
+	ImageRGBA16::ImageRGBA16(const std::filesystem::path& path) {
+		load(path);
+	}
+	ImageRGBA16::ImageRGBA16(const ImageRGBA16& other) {
+		copy(other);
+	}
+	ImageRGBA16::ImageRGBA16(const ImageRGBA& other) {
+		copy(other);
+	}
+	ImageRGBA16::ImageRGBA16(ImageRGBA16&& other) noexcept {
+		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return;
+
+		width = other.width;
+		height = other.height;
+		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
+
+		other.width = 0;
+		other.height = 0;
+		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
+	}
+	ImageRGBA16::~ImageRGBA16() {
+		free();
+	}
+
+	// Operators | assignment
+	ImageRGBA16& ImageRGBA16::operator=(const ImageRGBA16& other) {
+		copy(other);
+		return *this;
+	}
+	ImageRGBA16& ImageRGBA16::operator=(ImageRGBA16&& other) noexcept {
+		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return *this;
+
+		free();
+
+		width = other.width;
+		height = other.height;
+		data = other.data;
+		deleter = std::move(other.deleter);
+		borrowed = other.borrowed;
+
+		other.width = 0;
+		other.height = 0;
+		other.data = nullptr;
+		other.deleter = nullptr;
+		other.borrowed = false;
+
+		return *this;
+	}
+	ImageRGBA16& ImageRGBA16::operator=(const ImageRGBA& other) {
+		copy(other);
+		return *this;
+	}
+
+	// Operators | member access operator
+	ImageRGBA16::RowView ImageRGBA16::operator[](size_t y) {
+		assert(data != nullptr && "data == nullptr");
+		assert(y < static_cast<size_t>(height) && "y >= height");
+		return RowView{ data + y * width, width };
+	}
+	const ImageRGBA16::RowView ImageRGBA16::operator[](size_t y) const {
+		assert(data != nullptr && "data == nullptr");
+		assert(y < static_cast<size_t>(height) && "y >= height");
+		return RowView{ data + y * width, width };
+	}
+
+	// Getters
+	int ImageRGBA16::getWidth() const {
+		return width;
+	}
+	int ImageRGBA16::getHeight() const {
+		return height;
+	}
+	int ImageRGBA16::getChannels() const {
+		return CHANNELS;
+	}
+	glm::u16vec4* ImageRGBA16::getData() const {
+		return data;
+	}
+
+	// Functions | allocation
+	glm::u16vec4* ImageRGBA16::allocate(int width, int height) {
+		// Free previous data if any
+		free();
+
+		if (width <= 0 || height <= 0)
+			return nullptr;
+
+		size_t bufferSize = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(glm::u16vec4);
+		data = reinterpret_cast<glm::u16vec4*>(std::malloc(bufferSize));
+		if (data == nullptr)
+			return nullptr;
+		this->width = width;
+		this->height = height;
+		return data;
+	}
+	bool ImageRGBA16::isAllocated() const {
+		return data != nullptr;
+	}
+	size_t ImageRGBA16::dataSize() const {
+		return static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(glm::u16vec4);
+	}
+	void ImageRGBA16::free() {
+		width = 0;
+		height = 0;
+		releasePixels(data, deleter, borrowed);
+		data = nullptr;
+	}
+
+	// Functions | external memory
+	bool ImageRGBA16::wrap(glm::u16vec4* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter, size_t stride) {
+		// Error check
+		if (pixels == nullptr || pixels == data || width <= 0 || height <= 0)
+			return false;
+		if (stride != 0 && stride != static_cast<size_t>(width) * sizeof(glm::u16vec4))
+			return false;
+
+		free();
+
+		data = pixels;
+		this->width = width;
+		this->height = height;
+		this->deleter = std::move(deleter);
+		borrowed = ownership == PixelOwnership::BORROW;
+		return true;
+	}
+	glm::u16vec4* ImageRGBA16::release(PixelDeleter& deleter) {
+		glm::u16vec4* pixels = data;
+		deleter = takeDeleter(this->deleter, borrowed);
+		width = 0;
+		height = 0;
+		data = nullptr;
+		return pixels;
+	}
+	bool ImageRGBA16::ownsData() const {
+		return data != nullptr && !borrowed;
+	}
+
+	// Functions | file loading (allocated memory) / saving
+	bool ImageRGBA16::load(const std::filesystem::path& path, bool flipImageOnLoad) {
+		if (path.empty())
+			return false; // No path set
+
+		// Free previous data if any
+		free();
+
+		// Read file into memory
+		std::ifstream ifstream{ path, std::ios::binary };
+		if (!ifstream.is_open())
+			return false; // Failed to open file
+
+		ifstream.seekg(0, std::ios::end);
+		size_t fileSize{ static_cast<size_t>(ifstream.tellg()) };
+		ifstream.seekg(0, std::ios::beg);
+
+		unsigned char* fileData{ static_cast<unsigned char*>(std::malloc(fileSize)) };
+		if (fileData == nullptr)
+			return false; // Memory allocation failed
+
+		if (!ifstream.read(reinterpret_cast<char*>(fileData), fileSize)) {
+			std::free(fileData);
+			return false; // Failed to read file
+		}
+		ifstream.close();
+
+		// Load image from memory
+		bool success{ loadFromMemory(fileData, fileSize, flipImageOnLoad) };
+
+		// Free temporary memory
+		std::free(fileData);
+
+		return success;
+	}
+	bool ImageRGBA16::loadFromMemory(const unsigned char* fileInMemory, size_t size, bool flipImageOnLoad) {
+		// Error check
+		if (fileInMemory == nullptr || size == 0)
+			return false;
+
+		// Free previous data if any
+		free();
+
+		// Set vertical flip
+		stbi_set_flip_vertically_on_load_thread(flipImageOnLoad);
+
+		// Load image with four channels at 16 bits per channel (stb widens 8-bit sources)
+		int loadedWidth{ 0 };
+		int loadedHeight{ 0 };
+		int unusedChannelParameter{ 0 }; // Reason: CHANNELS returns 4, enforcing it to always be 4 channel
+		data = reinterpret_cast<glm::u16vec4*>(stbi_load_16_from_memory(fileInMemory, static_cast<int>(size), &loadedWidth, &loadedHeight, &unusedChannelParameter, CHANNELS));
+		if (data == nullptr)
+			return false;
+		width = loadedWidth;
+		height = loadedHeight;
+
+		return true;
 	}
-	bool ImageRGBA::saveAsTGA(const std::filesystem::path& path) const {
-		return static_cast<bool>(stbi_write_tga(path.string().c_str(), width, height, CHANNELS, data));
+	bool ImageRGBA16::copy(const ImageRGBA16& other, ExecutionPolicy policy) {
+		// Error check
+		if (this == &other || other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return false;
+
+		// Release existing data
+		free();
+
+		// Allocate memory for copy operation
+		size_t dataSize = other.dataSize();
+		data = reinterpret_cast<glm::u16vec4*>(std::malloc(dataSize));
+		if (data == nullptr)
+			return false;
+		width = other.width;
+		height = other.height;
+
+		// Copy data
+		copyBytes(data, other.data, dataSize, policy);
+
+		// Success
+		return true;
 	}
-	bool ImageRGBA::save(const std::filesystem::path& path, int quality) const {
+	bool ImageRGBA16::copy(const ImageRGBA& other, ExecutionPolicy policy) {
+		// Error check
+		if (other.width <= 0 || other.height <= 0 || other.data == nullptr)
+			return false;
+
+		// Release existing data
+		free();
+
+		// Allocate memory for copy operation
+		size_t pixelCount = other.pixelCount();
+		data = reinterpret_cast<glm::u16vec4*>(std::malloc(pixelCount * sizeof(glm::u16vec4)));
+		if (data == nullptr)
+			return false;
+		width = other.width;
+		height = other.height;
+
+		// Widen data
+		forEachRange(pixelCount * CHANNELS, policy, [&](size_t begin, size_t end) {
+			widenSamples(reinterpret_cast<const unsigned char*>(other.data) + begin, reinterpret_cast<unsigned short*>(data) + begin, end - begin);
+		});
+
+		// Success
+		return true;
+	}
+	bool ImageRGBA16::saveAsPNG(const std::filesystem::path& path) const {
+		return writePNG16(path, width, height, CHANNELS, reinterpret_cast<const unsigned short*>(data));
+	}
+	bool ImageRGBA16::saveAsJPEG(const std::filesystem::path& path, int quality) const {
+		return ImageRGBA(*this).saveAsJPEG(path, quality);
+	}
+	bool ImageRGBA16::saveAsBMP(const std::filesystem::path& path) const {
+		return ImageRGBA(*this).saveAsBMP(path);
+	}
+	bool ImageRGBA16::saveAsTGA(const std::filesystem::path& path) const {
+		return ImageRGBA(*this).saveAsTGA(path);
+	}
+	bool ImageRGBA16::save(const std::filesystem::path& path, int quality) const {
 		auto ext = path.extension().string();
 		std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
 
@@ -1717,63 +3986,63 @@ namespace it {
 	}
 
 	// Functions | pixel manipulation
-	size_t ImageRGBA::pixelCount() const {
+	size_t ImageRGBA16::pixelCount() const {
 		return static_cast<size_t>(width) * static_cast<size_t>(height);
 	}
-	glm::u8vec4 ImageRGBA::pixelAt(int x, int y) const {
+	glm::u16vec4 ImageRGBA16::pixelAt(int x, int y) const {
 		// Error check
 		assert(data != nullptr);
-		assert(x >= 0 && "rectX < 0");
-		assert(y >= 0 && "rectY < 0");
-		assert(x < width && " rectX >= rectWidth");
-		assert(y < height && "rectY >= rectHeight");
+		assert(x >= 0 && "x < 0");
+		assert(y >= 0 && "y < 0");
+		assert(x < width && "x >= width");
+		assert(y < height && "y >= height");
 		if (!data || x < 0 || x >= width || y < 0 || y >= height)
-			return glm::u8vec4(0u);
+			return glm::u16vec4(0U);
 
 		// Get pixel
 		size_t index = (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x));
-		return reinterpret_cast<glm::u8vec4*>(data)[index];
+		return data[index];
 	}
-	bool ImageRGBA::paintPixel(int x, int y, glm::u8vec4 pixel) {
+	bool ImageRGBA16::setPixel(int x, int y, glm::u16vec4 pixel) {
 		// Error check
 		assert(data != nullptr);
-		assert(x >= 0 && "rectX < 0");
-		assert(y >= 0 && "rectY < 0");
-		assert(x < width && " rectX >= rectWidth");
-		assert(y < height && "rectY >= rectHeight");
+		assert(x >= 0 && "x < 0");
+		assert(y >= 0 && "y < 0");
+		assert(x < width && "x >= width");
+		assert(y < height && "y >= height");
 		if (data == nullptr || x < 0 || y < 0 || x >= width || y >= height)
 			return false;
 
 		// Set pixel
-		size_t index = static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x);
+		size_t index = (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x));
 		data[index] = pixel;
 
 		// Success
 		return true;
 	}
-	bool ImageRGBA::paintPixel(int x, int y, glm::vec4 pixel) {
+	bool ImageRGBA16::setPixel(int x, int y, glm::vec4 pixel) {
 		// Error check
 		assert(data != nullptr);
-		assert(x >= 0 && "rectX < 0");
-		assert(y >= 0 && "rectY < 0");
-		assert(x < width && " rectX >= rectWidth");
-		assert(y < height && "rectY >= rectHeight");
+		assert(x >= 0 && "x < 0");
+		assert(y >= 0 && "y < 0");
+		assert(x < width && "x >= width");
+		assert(y < height && "y >= height");
 		if (data == nullptr || x < 0 || y < 0 || x >= width || y >= height)
 			return false;
 
 		// Set pixel
 		size_t index = static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x);
-		data[index] = glm::u8vec4(
-			static_cast<unsigned char>(std::clamp(pixel[0], 0.0f, 1.0f) * 255.0f),
-			static_cast<unsigned char>(std::clamp(pixel[1], 0.0f, 1.0f) * 255.0f),
-			static_cast<unsigned char>(std::clamp(pixel[2], 0.0f, 1.0f) * 255.0f),
-			static_cast<unsigned char>(std::clamp(pixel[3], 0.0f, 1.0f) * 255.0f)
+		data[index] = glm::u16vec4(
+			static_cast<unsigned short>(std::clamp(pixel[0], 0.0f, 1.0f) * 65535.0f),
+			static_cast<unsigned short>(std::clamp(pixel[1], 0.0f, 1.0f) * 65535.0f),
+			static_cast<unsigned short>(std::clamp(pixel[2], 0.0f, 1.0f) * 65535.0f),
+			static_cast<unsigned short>(std::clamp(pixel[3], 0.0f, 1.0f) * 65535.0f)
 		);
 
 		// Success
 		return true;
 	}
-	void ImageRGBA::fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u8vec4& color) {
+	void ImageRGBA16::fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u16vec4& color, ExecutionPolicy policy) {
 		// Error check
 		assert(data != nullptr);
 		assert(rectX >= 0 && "rectX < 0");
@@ -1783,42 +4052,222 @@ namespace it {
 		assert(rectX + rectWidth <= width && "rectX + rectWidth is out of image bounds");
 		assert(rectY + rectHeight <= height && "rectY + rectHeight is out of image bounds");
 
-		for (int currentY = rectY, yEnd = rectY + rectHeight; currentY < yEnd; ++currentY) {
-			for (int currentX = rectX, xEnd = rectX + rectWidth; currentX < xEnd; ++currentX) {
-				size_t index = static_cast<size_t>(currentY) * static_cast<size_t>(width) + static_cast<size_t>(currentX);
-				data[index] = color;
+		parallelForRows({ { rectX, rectY }, { rectWidth, rectHeight } }, [&](const ui::Rect& band) {
+			for (int currentY = band.top(), yEnd = band.bottom(); currentY < yEnd; ++currentY) {
+				glm::u16vec4* row = data + static_cast<size_t>(currentY) * static_cast<size_t>(width);
+				std::fill(row + rectX, row + rectX + rectWidth, color);
 			}
+		}, fillGrainRows(rectWidth * CHANNELS), policy);
+	}
+
+	// class ImageIndexed
+
+	// Constructor / Destructor
+	ImageIndexed::ImageIndexed(int width, int height) {
+		allocate(width, height);
+	}
+	ImageIndexed::ImageIndexed(const ImageIndexed& other) {
+		*this = other;
+	}
+	ImageIndexed::ImageIndexed(ImageIndexed&& other) noexcept {
+		*this = std::move(other);
+	}
+	ImageIndexed::~ImageIndexed() {
+		free();
+	}
+
+	// Operators | assignment
+	ImageIndexed& ImageIndexed::operator=(const ImageIndexed& other) {
+		if (this == &other)
+			return *this;
+
+		if (other.data == nullptr) {
+			free();
+			palette = other.palette;
+			return *this;
+		}
+		if (allocate(other.width, other.height) != nullptr) {
+			std::memcpy(data, other.data, other.dataSize());
+			palette = other.palette;
+		}
+
+		return *this;
+	}
+	ImageIndexed& ImageIndexed::operator=(ImageIndexed&& other) noexcept {
+		if (this == &other)
+			return *this;
+
+		free();
+
+		width = other.width;
+		height = other.height;
+		data = other.data;
+		palette = std::move(other.palette);
+
+		other.width = 0;
+		other.height = 0;
+		other.data = nullptr;
+		other.palette.clear();
+
+		return *this;
+	}
+
+	// Getters
+	int ImageIndexed::getWidth() const {
+		return width;
+	}
+	int ImageIndexed::getHeight() const {
+		return height;
+	}
+	unsigned char* ImageIndexed::getData() const {
+		return data;
+	}
+	const std::vector<glm::u8vec4>& ImageIndexed::getPalette() const {
+		return palette;
+	}
+
+	// Setters
+	bool ImageIndexed::setPalette(const std::vector<glm::u8vec4>& palette) {
+		if (palette.size() > static_cast<size_t>(MAXIMUM_PALETTE_SIZE))
+			return false;
+
+		this->palette = palette;
+		return true;
+	}
+
+	// Functions | allocation (the palette is kept)
+	unsigned char* ImageIndexed::allocate(int width, int height) {
+		if (data != nullptr) {
+			std::free(data);
+			data = nullptr;
+		}
+		this->width = 0;
+		this->height = 0;
+
+		if (width <= 0 || height <= 0)
+			return nullptr;
+
+		data = reinterpret_cast<unsigned char*>(std::malloc(static_cast<size_t>(width) * static_cast<size_t>(height)));
+		if (data == nullptr)
+			return nullptr;
+		this->width = width;
+		this->height = height;
+		return data;
+	}
+	bool ImageIndexed::isAllocated() const {
+		return data != nullptr;
+	}
+	size_t ImageIndexed::dataSize() const {
+		return static_cast<size_t>(width) * static_cast<size_t>(height);
+	}
+	void ImageIndexed::free() {
+		width = 0;
+		height = 0;
+		palette.clear();
+		if (data != nullptr) {
+			std::free(data);
+			data = nullptr;
 		}
 	}
 
+	// Functions
+	bool ImageIndexed::expand(ImageRGBA& destination, ExecutionPolicy policy) const {
+		// Error check
+		if (data == nullptr)
+			return false;
+		if ((destination.getWidth() != width || destination.getHeight() != height) && destination.allocate(width, height) == nullptr)
+			return false;
+
+		return expand(ImageViewRGBA(destination), policy);
+	}
+	bool ImageIndexed::expand(const ImageViewRGBA& destination, ExecutionPolicy policy) const {
+		// Error check
+		if (data == nullptr || !destination.hasData())
+			return false;
+		if (destination.width != width || destination.height != height)
+			return false;
+
+		std::array<unsigned int, 256> table{};
+		for (size_t i = 0ULL; i < palette.size(); i++)
+			std::memcpy(&table[i], &palette[i], 4ULL);
+
+		parallelFor(0, height, [&](int rowBegin, int rowEnd) {
+			for (int y = rowBegin; y < rowEnd; y++)
+				expandIndices(data + static_cast<size_t>(y) * static_cast<size_t>(width), destination.row(y), width, table, palette.size());
+		}, fillGrainRows(width * 4), policy);
+		return true;
+	}
+	bool ImageIndexed::saveAsPNG(const std::filesystem::path& path) const {
+		return writePNG8(path, width, height, data, palette);
+	}
+
+	// Functions | pixel manipulation
+	size_t ImageIndexed::pixelCount() const {
+		return static_cast<size_t>(width) * static_cast<size_t>(height);
+	}
+	unsigned char ImageIndexed::indexAt(int x, int y) const {
+		// Error check
+		assert(data != nullptr);
+		assert(x >= 0 && x < width && "x is out of range");
+		assert(y >= 0 && y < height && "y is out of range");
+		if (!data || x < 0 || x >= width || y < 0 || y >= height)
+			return 0U;
+
+		return data[static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x)];
+	}
+	glm::u8vec4 ImageIndexed::pixelAt(int x, int y) const {
+		const unsigned char index = indexAt(x, y);
+		return index < palette.size() ? palette[index] : glm::u8vec4(0);
+	}
+	bool ImageIndexed::setIndex(int x, int y, unsigned char index) {
+		if (!data || x < 0 || x >= width || y < 0 || y >= height)
+			return false;
+
+		data[static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x)] = index;
+		return true;
+	}
+
 	// struct ImageView
 
 	// Object | public
 
+	// Constructors | external pixels
+	ImageView::ImageView(unsigned char* data, int width, int height, int channels, size_t stride) {
+		this->width = width;
+		this->height = height;
+		this->channels = channels;
+		this->data = data;
+		this->stride = stride == 0ULL ? static_cast<size_t>(width) * static_cast<size_t>(channels) : stride;
+	}
+
 	// Constructors | Copy / conversions
 	ImageView::ImageView(const ImageGray& other) {
 		width = other.getWidth();
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = other.getData();
+		stride = static_cast<size_t>(width) * static_cast<size_t>(channels);
 	}
 	ImageView::ImageView(const ImageGrayAlpha& other) {
 		width = other.getWidth();
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = reinterpret_cast<unsigned char*>(other.getData());
+		stride = static_cast<size_t>(width) * static_cast<size_t>(channels);
 	}
 	ImageView::ImageView(const ImageRGB& other) {
 		width = other.getWidth();
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = reinterpret_cast<unsigned char*>(other.getData());
+		stride = static_cast<size_t>(width) * static_cast<size_t>(channels);
 	}
 	ImageView::ImageView(const ImageRGBA& other) {
 		width = other.getWidth();
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = reinterpret_cast<unsigned char*>(other.getData());
+		stride = static_cast<size_t>(width) * static_cast<size_t>(channels);
 	}
 
 	// Operators | assignment
@@ -1827,6 +4276,7 @@ namespace it {
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = other.getData();
+		stride = static_cast<size_t>(width) * static_cast<size_t>(channels);
 		return *this;
 	}
 	ImageView& ImageView::operator=(const ImageGrayAlpha& other) {
@@ -1834,6 +4284,7 @@ namespace it {
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = reinterpret_cast<unsigned char*>(other.getData());
+		stride = static_cast<size_t>(width) * static_cast<size_t>(channels);
 		return *this;
 	}
 	ImageView& ImageView::operator=(const ImageRGB& other) {
@@ -1841,6 +4292,7 @@ namespace it {
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = reinterpret_cast<unsigned char*>(other.getData());
+		stride = static_cast<size_t>(width) * static_cast<size_t>(channels);
 		return *this;
 	}
 	ImageView& ImageView::operator=(const ImageRGBA& other) {
@@ -1848,6 +4300,7 @@ namespace it {
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = reinterpret_cast<unsigned char*>(other.getData());
+		stride = static_cast<size_t>(width) * static_cast<size_t>(channels);
 		return *this;
 	}
 
@@ -1868,22 +4321,46 @@ namespace it {
 		if (data == nullptr || x < 0 || y < 0 || x >= width || y >= height)
 			return nullptr;
 
-		return data + (width * y + x) * channels;
+		return row(y) + static_cast<size_t>(x) * static_cast<size_t>(channels);
 	}
 	bool ImageView::hasData() const {
 		return data != nullptr;
 	}
+	unsigned char* ImageView::row(int y) const {
+		assert(data != nullptr);
+		assert(y >= 0 && y < height && "y is out of range");
+		return data + static_cast<size_t>(y) * stride;
+	}
+	ImageView ImageView::subView(const ui::Rect& rect) const {
+		const ui::Rect clipped = rect.normalized().intersected({ { 0, 0 }, { width, height } });
+		if (data == nullptr || !clipped.isValid())
+			return ImageView(nullptr, 0, 0, channels);
+		return ImageView(row(clipped.top()) + static_cast<size_t>(clipped.left()) * static_cast<size_t>(channels), clipped.width(), clipped.height(), channels, stride);
+	}
+	bool ImageView::isContiguous() const {
+		return stride == static_cast<size_t>(width) * static_cast<size_t>(channels);
+	}
 
 	// struct ImageViewGray
 
 	// Object | public
 
+	// Constructors | external pixels
+	ImageViewGray::ImageViewGray(unsigned char* data, int width, int height, size_t stride) {
+		this->width = width;
+		this->height = height;
+		channels = 1;
+		this->data = data;
+		this->stride = stride == 0ULL ? static_cast<size_t>(width) * sizeof(unsigned char) : stride;
+	}
+
 	// Constructors | Copy / conversions
 	ImageViewGray::ImageViewGray(const ImageGray& other) {
 		width = other.getWidth();
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = other.getData();
+		stride = static_cast<size_t>(width) * sizeof(unsigned char);
 	}
 
 	// Operators | conversions
@@ -1892,6 +4369,7 @@ namespace it {
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = other.getData();
+		stride = static_cast<size_t>(width) * sizeof(unsigned char);
 		return *this;
 	}
 
@@ -1913,23 +4391,46 @@ namespace it {
 			return 0U;
 
 		// Get pixel
-		size_t index = (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x));
-		return data[index];
+		return row(y)[x];
 	}
 	bool ImageViewGray::hasData() const {
 		return data != nullptr;
 	}
+	unsigned char* ImageViewGray::row(int y) const {
+		assert(data != nullptr);
+		assert(y >= 0 && y < height && "y is out of range");
+		return data + static_cast<size_t>(y) * stride;
+	}
+	ImageViewGray ImageViewGray::subView(const ui::Rect& rect) const {
+		const ui::Rect clipped = rect.normalized().intersected({ { 0, 0 }, { width, height } });
+		if (data == nullptr || !clipped.isValid())
+			return ImageViewGray(nullptr, 0, 0);
+		return ImageViewGray(row(clipped.top()) + static_cast<size_t>(clipped.left()), clipped.width(), clipped.height(), stride);
+	}
+	bool ImageViewGray::isContiguous() const {
+		return stride == static_cast<size_t>(width) * sizeof(unsigned char);
+	}
 
 	// struct ImageViewGrayAlpha
 
 	// Object | public
 
+	// Constructors | external pixels
+	ImageViewGrayAlpha::ImageViewGrayAlpha(glm::u8vec2* data, int width, int height, size_t stride) {
+		this->width = width;
+		this->height = height;
+		channels = 2;
+		this->data = data;
+		this->stride = stride == 0ULL ? static_cast<size_t>(width) * sizeof(glm::u8vec2) : stride;
+	}
+
 	// Constructors | Copy / conversions
 	ImageViewGrayAlpha::ImageViewGrayAlpha(const ImageGrayAlpha& other) {
 		width = other.getWidth();
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = other.getData();
+		stride = static_cast<size_t>(width) * sizeof(glm::u8vec2);
 	}
 
 	// Operators | conversions
@@ -1938,6 +4439,7 @@ namespace it {
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = other.getData();
+		stride = static_cast<size_t>(width) * sizeof(glm::u8vec2);
 		return *this;
 	}
 
@@ -1959,23 +4461,46 @@ namespace it {
 			return glm::u8vec2(0u);
 
 		// Get pixel
-		size_t index = (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x));
-		return data[index];
+		return row(y)[x];
 	}
 	bool ImageViewGrayAlpha::hasData() const {
 		return data != nullptr;
 	}
+	glm::u8vec2* ImageViewGrayAlpha::row(int y) const {
+		assert(data != nullptr);
+		assert(y >= 0 && y < height && "y is out of range");
+		return reinterpret_cast<glm::u8vec2*>(reinterpret_cast<unsigned char*>(data) + static_cast<size_t>(y) * stride);
+	}
+	ImageViewGrayAlpha ImageViewGrayAlpha::subView(const ui::Rect& rect) const {
+		const ui::Rect clipped = rect.normalized().intersected({ { 0, 0 }, { width, height } });
+		if (data == nullptr || !clipped.isValid())
+			return ImageViewGrayAlpha(nullptr, 0, 0);
+		return ImageViewGrayAlpha(row(clipped.top()) + static_cast<size_t>(clipped.left()), clipped.width(), clipped.height(), stride);
+	}
+	bool ImageViewGrayAlpha::isContiguous() const {
+		return stride == static_cast<size_t>(width) * sizeof(glm::u8vec2);
+	}
 
 	// struct ImageViewGray
 
 	// Object | public
 
+	// Constructors | external pixels
+	ImageViewRGB::ImageViewRGB(glm::u8vec3* data, int width, int height, size_t stride) {
+		this->width = width;
+		this->height = height;
+		channels = 3;
+		this->data = data;
+		this->stride = stride == 0ULL ? static_cast<size_t>(width) * sizeof(glm::u8vec3) : stride;
+	}
+
 	// Constructors | Copy / conversions
 	ImageViewRGB::ImageViewRGB(const ImageRGB& other) {
 		width = other.getWidth();
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = other.getData();
+		stride = static_cast<size_t>(width) * sizeof(glm::u8vec3);
 	}
 
 	// Operators | conversions
@@ -1984,6 +4509,7 @@ namespace it {
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = other.getData();
+		stride = static_cast<size_t>(width) * sizeof(glm::u8vec3);
 		return *this;
 	}
 
@@ -2005,23 +4531,46 @@ namespace it {
 			return glm::u8vec3(0u);
 
 		// Get pixel
-		size_t index = (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x));
-		return data[index];
+		return row(y)[x];
 	}
 	bool ImageViewRGB::hasData() const {
 		return data != nullptr;
 	}
+	glm::u8vec3* ImageViewRGB::row(int y) const {
+		assert(data != nullptr);
+		assert(y >= 0 && y < height && "y is out of range");
+		return reinterpret_cast<glm::u8vec3*>(reinterpret_cast<unsigned char*>(data) + static_cast<size_t>(y) * stride);
+	}
+	ImageViewRGB ImageViewRGB::subView(const ui::Rect& rect) const {
+		const ui::Rect clipped = rect.normalized().intersected({ { 0, 0 }, { width, height } });
+		if (data == nullptr || !clipped.isValid())
+			return ImageViewRGB(nullptr, 0, 0);
+		return ImageViewRGB(row(clipped.top()) + static_cast<size_t>(clipped.left()), clipped.width(), clipped.height(), stride);
+	}
+	bool ImageViewRGB::isContiguous() const {
+		return stride == static_cast<size_t>(width) * sizeof(glm::u8vec3);
+	}
 
 	// struct ImageViewGray
 
 	// Object | public
 
+	// Constructors | external pixels
+	ImageViewRGBA::ImageViewRGBA(glm::u8vec4* data, int width, int height, size_t stride) {
+		this->width = width;
+		this->height = height;
+		channels = 4;
+		this->data = data;
+		this->stride = stride == 0ULL ? static_cast<size_t>(width) * sizeof(glm::u8vec4) : stride;
+	}
+
 	// Constructors | Copy / conversions
 	ImageViewRGBA::ImageViewRGBA(const ImageRGBA& other) {
 		width = other.getWidth();
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = other.getData();
+		stride = static_cast<size_t>(width) * sizeof(glm::u8vec4);
 	}
 
 	// Operators | conversions
@@ -2030,6 +4579,7 @@ namespace it {
 		height = other.getHeight();
 		channels = other.getChannels();
 		data = other.getData();
+		stride = static_cast<size_t>(width) * sizeof(glm::u8vec4);
 		return *this;
 	}
 
@@ -2051,10 +4601,23 @@ namespace it {
 			return glm::u8vec4(0U);
 
 		// Get pixel
-		size_t index = (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x));
-		return data[index];
+		return row(y)[x];
 	}
 	bool ImageViewRGBA::hasData() const {
 		return data != nullptr;
 	}
+	glm::u8vec4* ImageViewRGBA::row(int y) const {
+		assert(data != nullptr);
+		assert(y >= 0 && y < height && "y is out of range");
+		return reinterpret_cast<glm::u8vec4*>(reinterpret_cast<unsigned char*>(data) + static_cast<size_t>(y) * stride);
+	}
+	ImageViewRGBA ImageViewRGBA::subView(const ui::Rect& rect) const {
+		const ui::Rect clipped = rect.normalized().intersected({ { 0, 0 }, { width, height } });
+		if (data == nullptr || !clipped.isValid())
+			return ImageViewRGBA(nullptr, 0, 0);
+		return ImageViewRGBA(row(clipped.top()) + static_cast<size_t>(clipped.left()), clipped.width(), clipped.height(), stride);
+	}
+	bool ImageViewRGBA::isContiguous() const {
+		return stride == static_cast<size_t>(width) * sizeof(glm::u8vec4);
+	}
 }
@@ -2,6 +2,13 @@
 
 // Dependencies | std
 #include <filesystem>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+// Dependencies | core
+#include <core/Parallel.h>
+#include <core/Rect.h>
 
 // Dependencies | glm
 #include <glm/vec2.hpp>
@@ -14,6 +21,20 @@ namespace it {
 	class ImageGrayAlpha;
 	class ImageRGB;
 	class ImageRGBA;
+	class ImageGray16;
+	class ImageGrayAlpha16;
+	class ImageRGB16;
+	class ImageRGBA16;
+	struct ImageViewRGBA;
+	template<typename Derived>
+	struct PixelExpression;
+
+	// Concepts
+	// One of the 8 image classes (views excluded)
+	template<typename T>
+	concept IsImage = std::is_same_v<T, ImageGray> || std::is_same_v<T, ImageGrayAlpha> || std::is_same_v<T, ImageRGB> ||
+		std::is_same_v<T, ImageRGBA> || std::is_same_v<T, ImageGray16> || std::is_same_v<T, ImageGrayAlpha16> ||
+		std::is_same_v<T, ImageRGB16> || std::is_same_v<T, ImageRGBA16>;
 
 	// Enums
 	enum class DynamicRange {
@@ -33,6 +54,35 @@ namespace it {
 		PIC,
 		PNM
 	};
+	enum class BitDepth {
+		UNKNOWN = -1,
+		BITS_8,
+		BITS_16
+	};
+	// How an image class takes pixel memory it did not allocate (camera buffers, shared memory, GPU readback). ADOPT
+	// takes ownership: the deleter releases the pixels once the image frees them (std::free when empty). BORROW leaves
+	// them to the caller; they must outlive the image until it is freed or reallocated. Image classes keep tightly
+	// packed rows, so a stride other than width times the pixel size is refused; views wrap strided memory instead.
+	// wrap() leaves the pixels with the caller when it fails, and release() hands them back out with the deleter that
+	// frees them (a no-op for borrowed pixels).
+	enum class PixelOwnership {
+		ADOPT,
+		BORROW
+	};
+
+	// Types
+	using PixelDeleter = std::function<void(void*)>;
+
+	// Functions | file inspection (reads the header only, does not decode)
+	BitDepth bitDepthOf(const std::filesystem::path& path);
+	BitDepth bitDepthOfMemory(const unsigned char* fileInMemory, size_t size);
+
+	// Functions | batches (one file per image, decoded / encoded concurrently; return whether every file succeeded)
+	// Image is any of the 8 image classes; images is resized to paths and failed entries stay empty
+	template<typename Image>
+	bool loadImages(const std::vector<std::filesystem::path>& paths, std::vector<Image>& images, bool flipImagesOnLoad = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	template<typename Image>
+	bool saveImages(const std::vector<Image>& images, const std::vector<std::filesystem::path>& paths, int quality = 90, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
 
 	// Classes
 	class ImageGray {
@@ -40,6 +90,7 @@ namespace it {
 		friend class ImageGrayAlpha;
 		friend class ImageRGB;
 		friend class ImageRGBA;
+		friend class ImageGray16;
 
 		// Static
 		public:
@@ -65,16 +116,20 @@ namespace it {
 			int width{ 0 };
 			int height{ 0 };
 			unsigned char* data{ nullptr };
+			PixelDeleter deleter{};	// Empty for pixels from malloc or stb_image
+			bool borrowed{ false };
 
 		public:
 			// Constructor / Destructor
 			ImageGray() = default;
 			ImageGray(int width, int height);
+			ImageGray(unsigned char* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0); // See wrap()
 			ImageGray(const std::filesystem::path& path);
 			ImageGray(const ImageGray& other);
 			ImageGray(const ImageGrayAlpha& other, bool factorInAlpha = false);
 			ImageGray(const ImageRGB& other);
 			ImageGray(const ImageRGBA& other, bool factorInAlpha = false);
+			ImageGray(const ImageGray16& other, bool dither = false);
 			ImageGray(ImageGray&& other) noexcept;
 			~ImageGray();
 
@@ -88,6 +143,10 @@ namespace it {
 			ImageGray& operator=(const ImageRGBA& other);
 			ImageGray& operator=(ImageRGBA&& other) noexcept;
 
+			// Operators | expressions (defined in media/Expression.h)
+			template<typename Derived>
+			ImageGray& operator=(const PixelExpression<Derived>& expression);
+
 			// Operators | member access
 			RowView operator[](size_t y);
 			const RowView operator[](size_t y) const;
@@ -104,13 +163,19 @@ namespace it {
 			size_t dataSize() const;
 			void free();
 
+			// Functions | external memory (see PixelOwnership)
+			bool wrap(unsigned char* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0);
+			unsigned char* release(PixelDeleter& deleter); // Leaves the image empty
+			bool ownsData() const;
+
 			// Functions | file loading (allocates memory) / saving
 			bool load(const std::filesystem::path& path, bool flipImageOnLoad = false);
 			bool loadFromMemory(const unsigned char* fileInMemory, size_t size, bool flipImageOnLoad = false);
-			bool copy(const ImageGray& other);
-			bool copy(const ImageGrayAlpha& other, bool factorInAlpha = false);
-			bool copy(const ImageRGB& other);
-			bool copy(const ImageRGBA& other, bool factorInAlpha = false);
+			bool copy(const ImageGray& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageGrayAlpha& other, bool factorInAlpha = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageRGB& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageRGBA& other, bool factorInAlpha = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageGray16& other, bool dither = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
 			bool saveAsPNG(const std::filesystem::path& path) const;
 			bool saveAsJPEG(const std::filesystem::path& path, int quality = 90) const;
 			bool saveAsBMP(const std::filesystem::path& path) const;
@@ -122,13 +187,14 @@ namespace it {
 			unsigned char pixelAt(int x, int y) const;
 			bool setPixel(int x, int y, unsigned char pixel);
 			bool setPixel(int x, int y, float pixel);
-			void fillRect(int x, int y, int width, int height, unsigned char color);
+			void fillRect(int rectX, int rectY, int rectWidth, int rectHeight, unsigned char color, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
 	};
 	class ImageGrayAlpha {
 		// Friends
 		friend class ImageGray;
 		friend class ImageRGB;
 		friend class ImageRGBA;
+		friend class ImageGrayAlpha16;
 
 		// Static
 		public:
@@ -154,16 +220,20 @@ namespace it {
 			int width{ 0 };
 			int height{ 0 };
 			glm::u8vec2* data{ nullptr };
+			PixelDeleter deleter{};	// Empty for pixels from malloc or stb_image
+			bool borrowed{ false };
 
 		public:
 			// Constructor / Destructor
 			ImageGrayAlpha() = default;
 			ImageGrayAlpha(int width, int height);
+			ImageGrayAlpha(glm::u8vec2* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0); // See wrap()
 			ImageGrayAlpha(const std::filesystem::path& path);
 			ImageGrayAlpha(const ImageGray& other);
 			ImageGrayAlpha(const ImageGrayAlpha& other);
 			ImageGrayAlpha(const ImageRGB& other);
 			ImageGrayAlpha(const ImageRGBA& other);
+			ImageGrayAlpha(const ImageGrayAlpha16& other, bool dither = false);
 			ImageGrayAlpha(ImageGrayAlpha&& other) noexcept;
 			~ImageGrayAlpha();
 
@@ -177,6 +247,10 @@ namespace it {
 			ImageGrayAlpha& operator=(const ImageRGBA& other);
 			ImageGrayAlpha& operator=(ImageRGBA&& other) noexcept;
 
+			// Operators | expressions (defined in media/Expression.h)
+			template<typename Derived>
+			ImageGrayAlpha& operator=(const PixelExpression<Derived>& expression);
+
 			// Operators | member access
 			RowView operator[](size_t y);
 			const RowView operator[](size_t y) const;
@@ -193,13 +267,19 @@ namespace it {
 			size_t dataSize() const;
 			void free();
 
+			// Functions | external memory (see PixelOwnership)
+			bool wrap(glm::u8vec2* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0);
+			glm::u8vec2* release(PixelDeleter& deleter); // Leaves the image empty
+			bool ownsData() const;
+
 			// Functions | file loading / saving
 			bool load(const std::filesystem::path& path, bool flipImageOnLoad = false);
 			bool loadFromMemory(const unsigned char* fileInMemory, size_t size, bool flipImageOnLoad = false);
-			bool copy(const ImageGray& other);
-			bool copy(const ImageGrayAlpha& other);
-			bool copy(const ImageRGB& other);
-			bool copy(const ImageRGBA& other);
+			bool copy(const ImageGray& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageGrayAlpha& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageRGB& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageRGBA& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageGrayAlpha16& other, bool dither = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
 			bool saveAsPNG(const std::filesystem::path& path) const;
 			bool saveAsJPEG(const std::filesystem::path& path, int quality = 90) const;
 			bool saveAsBMP(const std::filesystem::path& path) const;
@@ -211,13 +291,14 @@ namespace it {
 			glm::u8vec2 pixeAt(int x, int y) const;
 			bool paintPixel(int x, int y, glm::u8vec2 pixel);
 			bool paintPixel(int x, int y, glm::vec2 pixel);
-			void fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u8vec2& color);
+			void fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u8vec2& color, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
 	};
 	class ImageRGB {
 		// Friends
 		friend class ImageGray;
 		friend class ImageGrayAlpha;
 		friend class ImageRGBA;
+		friend class ImageRGB16;
 
 		// Static
 		public:
@@ -243,16 +324,20 @@ namespace it {
 			int width{ 0 };
 			int height{ 0 };
 			glm::u8vec3* data{ nullptr };
+			PixelDeleter deleter{};	// Empty for pixels from malloc or stb_image
+			bool borrowed{ false };
 
 		public:
 			// Constructor / Destructor
 			ImageRGB() = default;
 			ImageRGB(int width, int height);
+			ImageRGB(glm::u8vec3* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0); // See wrap()
 			ImageRGB(const std::filesystem::path& path);
 			ImageRGB(const ImageGray& other);
 			ImageRGB(const ImageGrayAlpha& other, bool factorInAlpha = false);
 			ImageRGB(const ImageRGB& other);
 			ImageRGB(const ImageRGBA& other, bool factorInAlpha = false);
+			ImageRGB(const ImageRGB16& other, bool dither = false);
 			ImageRGB(ImageRGB&& other) noexcept;
 			~ImageRGB();
 
@@ -266,6 +351,10 @@ namespace it {
 			ImageRGB& operator=(const ImageRGBA& other);
 			ImageRGB& operator=(ImageRGBA&& other) noexcept;
 
+			// Operators | expressions (defined in media/Expression.h)
+			template<typename Derived>
+			ImageRGB& operator=(const PixelExpression<Derived>& expression);
+
 			// Operators | member access
 			RowView operator[](size_t y);
 			const RowView operator[](size_t y) const;
@@ -281,14 +370,20 @@ namespace it {
 			bool isAllocated() const;
 			size_t dataSize() const;
 			void free();
+
+			// Functions | external memory (see PixelOwnership)
+			bool wrap(glm::u8vec3* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0);
+			glm::u8vec3* release(PixelDeleter& deleter); // Leaves the image empty
+			bool ownsData() const;
 			
 			// Functions | file loading (allocates memory) / saving
 			bool load(const std::filesystem::path& path, bool flipImageOnLoad = false);
 			bool loadFromMemory(const unsigned char* fileInMemory, size_t size, bool flipImageOnLoad = false);
-			bool copy(const ImageGray& other);
-			bool copy(const ImageGrayAlpha& other, bool factorInAlpha = false);
-			bool copy(const ImageRGB& other);
-			bool copy(const ImageRGBA& other, bool factorInAlpha = false);
+			bool copy(const ImageGray& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageGrayAlpha& other, bool factorInAlpha = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageRGB& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageRGBA& other, bool factorInAlpha = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageRGB16& other, bool dither = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
 			bool saveAsPNG(const std::filesystem::path& path) const;
 			bool saveAsJPEG(const std::filesystem::path& path, int quality = 90) const;
 			bool saveAsBMP(const std::filesystem::path& path) const;
@@ -300,13 +395,14 @@ namespace it {
 			glm::u8vec3 getPixel(int x, int y) const;
 			bool setPixel(int x, int y, glm::u8vec3 pixel);
 			bool setPixel(int x, int y, glm::vec3 pixel);
-			void fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u8vec3& color);
+			void fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u8vec3& color, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
 	};
 	class ImageRGBA {
 		// Friends
 		friend class ImageGray;
 		friend class ImageGrayAlpha;
 		friend class ImageRGB;
+		friend class ImageRGBA16;
 
 		// class
 		struct RowView {
@@ -332,16 +428,20 @@ namespace it {
 			int width{ 0 };
 			int height{ 0 };
 			glm::u8vec4* data{ nullptr };
+			PixelDeleter deleter{};	// Empty for pixels from malloc or stb_image
+			bool borrowed{ false };
 
 		public:
 			// Constructor / Destructor
 			ImageRGBA() = default;
 			ImageRGBA(int width, int height);
+			ImageRGBA(glm::u8vec4* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0); // See wrap()
 			ImageRGBA(const std::filesystem::path& path);
 			ImageRGBA(const ImageGray& other);
 			ImageRGBA(const ImageGrayAlpha& other);
 			ImageRGBA(const ImageRGB& other);
 			ImageRGBA(const ImageRGBA& other);
+			ImageRGBA(const ImageRGBA16& other, bool dither = false);
 			ImageRGBA(ImageRGBA&& other) noexcept;
 			~ImageRGBA();
 
@@ -355,6 +455,10 @@ namespace it {
 			ImageRGBA& operator=(const ImageRGBA& other);
 			ImageRGBA& operator=(ImageRGBA&& other) noexcept;
 
+			// Operators | expressions (defined in media/Expression.h)
+			template<typename Derived>
+			ImageRGBA& operator=(const PixelExpression<Derived>& expression);
+
 			// Operators | member access
 			RowView operator[](size_t y);
 			const RowView operator[](size_t y) const;
@@ -371,13 +475,19 @@ namespace it {
 			size_t dataSize() const;
 			void free();
 
+			// Functions | external memory (see PixelOwnership)
+			bool wrap(glm::u8vec4* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0);
+			glm::u8vec4* release(PixelDeleter& deleter); // Leaves the image empty
+			bool ownsData() const;
+
 			// Functions
 			bool load(const std::filesystem::path& path, bool flipImageOnLoad = false);
 			bool loadFromMemory(const unsigned char* fileInMemory, size_t size, bool flipImageOnLoad = false);
-			bool copy(const ImageGray& other);
-			bool copy(const ImageGrayAlpha& other);
-			bool copy(const ImageRGB& other);
-			bool copy(const ImageRGBA& other);
+			bool copy(const ImageGray& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageGrayAlpha& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageRGB& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageRGBA& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageRGBA16& other, bool dither = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
 			bool saveAsPNG(const std::filesystem::path& path) const;
 			bool saveAsJPEG(const std::filesystem::path& path, int quality = 90) const;
 			bool saveAsBMP(const std::filesystem::path& path) const;
@@ -389,7 +499,425 @@ namespace it {
 			glm::u8vec4 pixelAt(int x, int y) const;
 			bool paintPixel(int x, int y, glm::u8vec4 pixel);
 			bool paintPixel(int x, int y, glm::vec4 pixel);
-			void fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u8vec4& color);
+			void fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u8vec4& color, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	};
+
+	class ImageGray16 {
+		// Friends
+		friend class ImageGrayAlpha16;
+		friend class ImageRGB16;
+		friend class ImageRGBA16;
+		friend class ImageGray;
+
+		// Static
+		public:
+			// Properties
+			static const int CHANNELS{ 1 };
+
+			// class
+			struct RowView {
+				// Object
+
+				// Properties
+				unsigned short* data{ nullptr };
+				int width{ 0 };
+
+				// Operators | member access
+				unsigned short& operator[](size_t y);
+				const unsigned short& operator[](size_t y) const;
+			};
+
+		// Object
+		private:
+			// Properties
+			int width{ 0 };
+			int height{ 0 };
+			unsigned short* data{ nullptr };
+			PixelDeleter deleter{};	// Empty for pixels from malloc or stb_image
+			bool borrowed{ false };
+
+		public:
+			// Constructor / Destructor
+			ImageGray16() = default;
+			ImageGray16(int width, int height);
+			ImageGray16(unsigned short* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0); // See wrap()
+			ImageGray16(const std::filesystem::path& path);
+			ImageGray16(const ImageGray16& other);
+			ImageGray16(const ImageGray& other);
+			ImageGray16(ImageGray16&& other) noexcept;
+			~ImageGray16();
+
+			// Operators | assignment
+			ImageGray16& operator=(const ImageGray16& other);
+			ImageGray16& operator=(ImageGray16&& other) noexcept;
+			ImageGray16& operator=(const ImageGray& other);
+
+			// Operators | member access
+			RowView operator[](size_t y);
+			const RowView operator[](size_t y) const;
+
+			// Getters
+			int getWidth() const;
+			int getHeight() const;
+			int getChannels() const;
+			unsigned short* getData() const;
+
+			// Functions | allocation / deallocation
+			unsigned short* allocate(int width, int height);
+			bool isAllocated() const;
+			size_t dataSize() const;
+			void free();
+
+			// Functions | external memory (see PixelOwnership)
+			bool wrap(unsigned short* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0);
+			unsigned short* release(PixelDeleter& deleter); // Leaves the image empty
+			bool ownsData() const;
+
+			// Functions | file loading (allocates memory) / saving
+			// 8-bit sources are widened on load (v * 257); JPEG, BMP and TGA are narrowed to 8 bits on save
+			bool load(const std::filesystem::path& path, bool flipImageOnLoad = false);
+			bool loadFromMemory(const unsigned char* fileInMemory, size_t size, bool flipImageOnLoad = false);
+			bool copy(const ImageGray16& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageGray& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool saveAsPNG(const std::filesystem::path& path) const;
+			bool saveAsJPEG(const std::filesystem::path& path, int quality = 90) const;
+			bool saveAsBMP(const std::filesystem::path& path) const;
+			bool saveAsTGA(const std::filesystem::path& path) const;
+			bool save(const std::filesystem::path& path, int quality = 90) const;
+
+			// Functions | pixel manipulation
+			size_t pixelCount() const;
+			unsigned short pixelAt(int x, int y) const;
+			bool setPixel(int x, int y, unsigned short pixel);
+			bool setPixel(int x, int y, float pixel);
+			void fillRect(int rectX, int rectY, int rectWidth, int rectHeight, unsigned short color, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	};
+	class ImageGrayAlpha16 {
+		// Friends
+		friend class ImageGray16;
+		friend class ImageRGB16;
+		friend class ImageRGBA16;
+		friend class ImageGrayAlpha;
+
+		// Static
+		public:
+			// Properties
+			static const int CHANNELS{ 2 };
+
+			// class
+			struct RowView {
+				// Object
+
+				// Properties
+				glm::u16vec2* data{ nullptr };
+				int width{ 0 };
+
+				// Operators | member access
+				glm::u16vec2& operator[](size_t y);
+				const glm::u16vec2& operator[](size_t y) const;
+			};
+
+		// Object
+		private:
+			// Properties
+			int width{ 0 };
+			int height{ 0 };
+			glm::u16vec2* data{ nullptr };
+			PixelDeleter deleter{};	// Empty for pixels from malloc or stb_image
+			bool borrowed{ false };
+
+		public:
+			// Constructor / Destructor
+			ImageGrayAlpha16() = default;
+			ImageGrayAlpha16(int width, int height);
+			ImageGrayAlpha16(glm::u16vec2* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0); // See wrap()
+			ImageGrayAlpha16(const std::filesystem::path& path);
+			ImageGrayAlpha16(const ImageGrayAlpha16& other);
+			ImageGrayAlpha16(const ImageGrayAlpha& other);
+			ImageGrayAlpha16(ImageGrayAlpha16&& other) noexcept;
+			~ImageGrayAlpha16();
+
+			// Operators | assignment
+			ImageGrayAlpha16& operator=(const ImageGrayAlpha16& other);
+			ImageGrayAlpha16& operator=(ImageGrayAlpha16&& other) noexcept;
+			ImageGrayAlpha16& operator=(const ImageGrayAlpha& other);
+
+			// Operators | member access
+			RowView operator[](size_t y);
+			const RowView operator[](size_t y) const;
+
+			// Getters
+			int getWidth() const;
+			int getHeight() const;
+			int getChannels() const;
+			glm::u16vec2* getData() const;
+
+			// Functions | allocation / deallocation
+			glm::u16vec2* allocate(int width, int height);
+			bool isAllocated() const;
+			size_t dataSize() const;
+			void free();
+
+			// Functions | external memory (see PixelOwnership)
+			bool wrap(glm::u16vec2* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0);
+			glm::u16vec2* release(PixelDeleter& deleter); // Leaves the image empty
+			bool ownsData() const;
+
+			// Functions | file loading (allocates memory) / saving
+			// 8-bit sources are widened on load (v * 257); JPEG, BMP and TGA are narrowed to 8 bits on save
+			bool load(const std::filesystem::path& path, bool flipImageOnLoad = false);
+			bool loadFromMemory(const unsigned char* fileInMemory, size_t size, bool flipImageOnLoad = false);
+			bool copy(const ImageGrayAlpha16& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageGrayAlpha& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool saveAsPNG(const std::filesystem::path& path) const;
+			bool saveAsJPEG(const std::filesystem::path& path, int quality = 90) const;
+			bool saveAsBMP(const std::filesystem::path& path) const;
+			bool saveAsTGA(const std::filesystem::path& path) const;
+			bool save(const std::filesystem::path& path, int quality = 90) const;
+
+			// Functions | pixel manipulation
+			size_t pixelCount() const;
+			glm::u16vec2 pixelAt(int x, int y) const;
+			bool setPixel(int x, int y, glm::u16vec2 pixel);
+			bool setPixel(int x, int y, glm::vec2 pixel);
+			void fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u16vec2& color, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	};
+	class ImageRGB16 {
+		// Friends
+		friend class ImageGray16;
+		friend class ImageGrayAlpha16;
+		friend class ImageRGBA16;
+		friend class ImageRGB;
+
+		// Static
+		public:
+			// Properties
+			static const int CHANNELS{ 3 };
+
+			// class
+			struct RowView {
+				// Object
+
+				// Properties
+				glm::u16vec3* data{ nullptr };
+				int width{ 0 };
+
+				// Operators | member access
+				glm::u16vec3& operator[](size_t y);
+				const glm::u16vec3& operator[](size_t y) const;
+			};
+
+		// Object
+		private:
+			// Properties
+			int width{ 0 };
+			int height{ 0 };
+			glm::u16vec3* data{ nullptr };
+			PixelDeleter deleter{};	// Empty for pixels from malloc or stb_image
+			bool borrowed{ false };
+
+		public:
+			// Constructor / Destructor
+			ImageRGB16() = default;
+			ImageRGB16(int width, int height);
+			ImageRGB16(glm::u16vec3* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0); // See wrap()
+			ImageRGB16(const std::filesystem::path& path);
+			ImageRGB16(const ImageRGB16& other);
+			ImageRGB16(const ImageRGB& other);
+			ImageRGB16(ImageRGB16&& other) noexcept;
+			~ImageRGB16();
+
+			// Operators | assignment
+			ImageRGB16& operator=(const ImageRGB16& other);
+			ImageRGB16& operator=(ImageRGB16&& other) noexcept;
+			ImageRGB16& operator=(const ImageRGB& other);
+
+			// Operators | member access
+			RowView operator[](size_t y);
+			const RowView operator[](size_t y) const;
+
+			// Getters
+			int getWidth() const;
+			int getHeight() const;
+			int getChannels() const;
+			glm::u16vec3* getData() const;
+
+			// Functions | allocation / deallocation
+			glm::u16vec3* allocate(int width, int height);
+			bool isAllocated() const;
+			size_t dataSize() const;
+			void free();
+
+			// Functions | external memory (see PixelOwnership)
+			bool wrap(glm::u16vec3* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0);
+			glm::u16vec3* release(PixelDeleter& deleter); // Leaves the image empty
+			bool ownsData() const;
+
+			// Functions | file loading (allocates memory) / saving
+			// 8-bit sources are widened on load (v * 257); JPEG, BMP and TGA are narrowed to 8 bits on save
+			bool load(const std::filesystem::path& path, bool flipImageOnLoad = false);
+			bool loadFromMemory(const unsigned char* fileInMemory, size_t size, bool flipImageOnLoad = false);
+			bool copy(const ImageRGB16& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageRGB& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool saveAsPNG(const std::filesystem::path& path) const;
+			bool saveAsJPEG(const std::filesystem::path& path, int quality = 90) const;
+			bool saveAsBMP(const std::filesystem::path& path) const;
+			bool saveAsTGA(const std::filesystem::path& path) const;
+			bool save(const std::filesystem::path& path, int quality = 90) const;
+
+			// Functions | pixel manipulation
+			size_t pixelCount() const;
+			glm::u16vec3 pixelAt(int x, int y) const;
+			bool setPixel(int x, int y, glm::u16vec3 pixel);
+			bool setPixel(int x, int y, glm::vec3 pixel);
+			void fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u16vec3& color, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	};
+	class ImageRGBA16 {
+		// Friends
+		friend class ImageGray16;
+		friend class ImageGrayAlpha16;
+		friend class ImageRGB16;
+		friend class ImageRGBA;
+
+		// Static
+		public:
+			// Properties
+			static const int CHANNELS{ 4 };
+
+			// class
+			struct RowView {
+				// Object
+
+				// Properties
+				glm::u16vec4* data{ nullptr };
+				int width{ 0 };
+
+				// Operators | member access
+				glm::u16vec4& operator[](size_t y);
+				const glm::u16vec4& operator[](size_t y) const;
+			};
+
+		// Object
+		private:
+			// Properties
+			int width{ 0 };
+			int height{ 0 };
+			glm::u16vec4* data{ nullptr };
+			PixelDeleter deleter{};	// Empty for pixels from malloc or stb_image
+			bool borrowed{ false };
+
+		public:
+			// Constructor / Destructor
+			ImageRGBA16() = default;
+			ImageRGBA16(int width, int height);
+			ImageRGBA16(glm::u16vec4* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0); // See wrap()
+			ImageRGBA16(const std::filesystem::path& path);
+			ImageRGBA16(const ImageRGBA16& other);
+			ImageRGBA16(const ImageRGBA& other);
+			ImageRGBA16(ImageRGBA16&& other) noexcept;
+			~ImageRGBA16();
+
+			// Operators | assignment
+			ImageRGBA16& operator=(const ImageRGBA16& other);
+			ImageRGBA16& operator=(ImageRGBA16&& other) noexcept;
+			ImageRGBA16& operator=(const ImageRGBA& other);
+
+			// Operators | member access
+			RowView operator[](size_t y);
+			const RowView operator[](size_t y) const;
+
+			// Getters
+			int getWidth() const;
+			int getHeight() const;
+			int getChannels() const;
+			glm::u16vec4* getData() const;
+
+			// Functions | allocation / deallocation
+			glm::u16vec4* allocate(int width, int height);
+			bool isAllocated() const;
+			size_t dataSize() const;
+			void free();
+
+			// Functions | external memory (see PixelOwnership)
+			bool wrap(glm::u16vec4* pixels, int width, int height, PixelOwnership ownership, PixelDeleter deleter = {}, size_t stride = 0);
+			glm::u16vec4* release(PixelDeleter& deleter); // Leaves the image empty
+			bool ownsData() const;
+
+			// Functions | file loading (allocates memory) / saving
+			// 8-bit sources are widened on load (v * 257); JPEG, BMP and TGA are narrowed to 8 bits on save
+			bool load(const std::filesystem::path& path, bool flipImageOnLoad = false);
+			bool loadFromMemory(const unsigned char* fileInMemory, size_t size, bool flipImageOnLoad = false);
+			bool copy(const ImageRGBA16& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool copy(const ImageRGBA& other, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+			bool saveAsPNG(const std::filesystem::path& path) const;
+			bool saveAsJPEG(const std::filesystem::path& path, int quality = 90) const;
+			bool saveAsBMP(const std::filesystem::path& path) const;
+			bool saveAsTGA(const std::filesystem::path& path) const;
+			bool save(const std::filesystem::path& path, int quality = 90) const;
+
+			// Functions | pixel manipulation
+			size_t pixelCount() const;
+			glm::u16vec4 pixelAt(int x, int y) const;
+			bool setPixel(int x, int y, glm::u16vec4 pixel);
+			bool setPixel(int x, int y, glm::vec4 pixel);
+			void fillRect(int rectX, int rectY, int rectWidth, int rectHeight, const glm::u16vec4& color, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	};
+
+	// Palette image: one index byte per pixel into at most 256 RGBA colors (media/Quantization.h builds them from RGB
+	// and RGBA images)
+	class ImageIndexed {
+		// Static
+		public:
+			// Properties
+			static const int MAXIMUM_PALETTE_SIZE{ 256 };
+
+		// Object
+		private:
+			// Properties
+			int width{ 0 };
+			int height{ 0 };
+			unsigned char* data{ nullptr };
+			std::vector<glm::u8vec4> palette{};
+
+		public:
+			// Constructor / Destructor
+			ImageIndexed() = default;
+			ImageIndexed(int width, int height);
+			ImageIndexed(const ImageIndexed& other);
+			ImageIndexed(ImageIndexed&& other) noexcept;
+			~ImageIndexed();
+
+			// Operators | assignment
+			ImageIndexed& operator=(const ImageIndexed& other);
+			ImageIndexed& operator=(ImageIndexed&& other) noexcept;
+
+			// Getters
+			int getWidth() const;
+			int getHeight() const;
+			unsigned char* getData() const;
+			const std::vector<glm::u8vec4>& getPalette() const;
+
+			// Setters
+			bool setPalette(const std::vector<glm::u8vec4>& palette); // At most MAXIMUM_PALETTE_SIZE colors
+
+			// Functions | allocation / deallocation
+			unsigned char* allocate(int width, int height);
+			bool isAllocated() const;
+			size_t dataSize() const; // Of the indices
+			void free(); // Clears the palette as well
+
+			// Functions
+			// Looks every index up in the palette (indices past it give transparent black): 16 pixels per SSSE3 shuffle
+			// for palettes of up to 16 colors, 8 per AVX2 gather otherwise
+			bool expand(ImageRGBA& destination, ExecutionPolicy policy = ExecutionPolicy::PARALLEL) const;
+			bool expand(const ImageViewRGBA& destination, ExecutionPolicy policy = ExecutionPolicy::PARALLEL) const; // Same size
+			bool saveAsPNG(const std::filesystem::path& path) const; // 8-bit palette PNG, with tRNS when colors are translucent
+
+			// Functions | pixel manipulation
+			size_t pixelCount() const;
+			unsigned char indexAt(int x, int y) const;
+			glm::u8vec4 pixelAt(int x, int y) const;
+			bool setIndex(int x, int y, unsigned char index);
 	};
 
 	struct ImageView {
@@ -398,6 +926,10 @@ namespace it {
 		int height{ 0 };
 		int channels{ 0 };
 		unsigned char* data{ nullptr };
+		size_t stride{ 0 }; // Bytes from the start of one row to the next
+
+		// Constructors | external pixels (a stride of 0 means tightly packed rows)
+		ImageView(unsigned char* data, int width, int height, int channels, size_t stride = 0);
 
 		// Constructors | copy / conversions
 		ImageView(const ImageGray& othger);
@@ -416,6 +948,9 @@ namespace it {
 		size_t dataSize() const;
 		unsigned char* pixelAt(int x, int y) const;
 		bool hasData() const;
+		unsigned char* row(int y) const;
+		ImageView subView(const ui::Rect& rect) const; // Clipped to the view, shares its pixels
+		bool isContiguous() const;
 	};
 
 	struct ImageViewGray {
@@ -424,6 +959,10 @@ namespace it {
 		int height{ 0 };
 		int channels{ 0 };
 		unsigned char* data{ nullptr };
+		size_t stride{ 0 }; // Bytes from the start of one row to the next
+
+		// Constructors | external pixels (a stride of 0 means tightly packed rows)
+		ImageViewGray(unsigned char* data, int width, int height, size_t stride = 0);
 
 		// Constructors | copy / conversions
 		ImageViewGray(const ImageGray& othger);
@@ -431,11 +970,18 @@ namespace it {
 		// Operators | onversions
 		ImageViewGray& operator=(const ImageGray& other);
 
+		// Operators | expressions (defined in media/Expression.h)
+		template<typename Derived>
+		ImageViewGray& operator=(const PixelExpression<Derived>& expression);
+
 		// Functions
 		size_t pixelCount() const;
 		size_t dataSize() const;
 		unsigned char pixelAt(int x, int y) const;
 		bool hasData() const;
+		unsigned char* row(int y) const;
+		ImageViewGray subView(const ui::Rect& rect) const; // Clipped to the view, shares its pixels
+		bool isContiguous() const;
 	};
 
 	struct ImageViewGrayAlpha {
@@ -444,6 +990,10 @@ namespace it {
 		int height{ 0 };
 		int channels{ 0 };
 		glm::u8vec2* data{ nullptr };
+		size_t stride{ 0 }; // Bytes from the start of one row to the next
+
+		// Constructors | external pixels (a stride of 0 means tightly packed rows)
+		ImageViewGrayAlpha(glm::u8vec2* data, int width, int height, size_t stride = 0);
 
 		// Constructors | copy / conversions
 		ImageViewGrayAlpha(const ImageGrayAlpha& other);
@@ -451,11 +1001,18 @@ namespace it {
 		// Operators | onversions
 		ImageViewGrayAlpha& operator=(const ImageGrayAlpha& other);
 
+		// Operators | expressions (defined in media/Expression.h)
+		template<typename Derived>
+		ImageViewGrayAlpha& operator=(const PixelExpression<Derived>& expression);
+
 		// Functions
 		size_t pixelCount() const;
 		size_t dataSize() const;
 		glm::u8vec2 pixelAt(int x, int y) const;
 		bool hasData() const;
+		glm::u8vec2* row(int y) const;
+		ImageViewGrayAlpha subView(const ui::Rect& rect) const; // Clipped to the view, shares its pixels
+		bool isContiguous() const;
 	};
 
 	struct ImageViewRGB {
@@ -464,6 +1021,10 @@ namespace it {
 		int height{ 0 };
 		int channels{ 0 };
 		glm::u8vec3* data{ nullptr };
+		size_t stride{ 0 }; // Bytes from the start of one row to the next
+
+		// Constructors | external pixels (a stride of 0 means tightly packed rows)
+		ImageViewRGB(glm::u8vec3* data, int width, int height, size_t stride = 0);
 
 		// Constructors | copy / conversions
 		ImageViewRGB(const ImageRGB& othger);
@@ -471,11 +1032,18 @@ namespace it {
 		// Operators | onversions
 		ImageViewRGB& operator=(const ImageRGB& other);
 
+		// Operators | expressions (defined in media/Expression.h)
+		template<typename Derived>
+		ImageViewRGB& operator=(const PixelExpression<Derived>& expression);
+
 		// Functions
 		size_t pixelCount() const;
 		size_t dataSize() const;
 		glm::u8vec3 pixelAt(int x, int y) const;
 		bool hasData() const;
+		glm::u8vec3* row(int y) const;
+		ImageViewRGB subView(const ui::Rect& rect) const; // Clipped to the view, shares its pixels
+		bool isContiguous() const;
 	};
 
 	struct ImageViewRGBA {
@@ -484,6 +1052,10 @@ namespace it {
 		int height{ 0 };
 		int channels{ 0 };
 		glm::u8vec4* data{ nullptr };
+		size_t stride{ 0 }; // Bytes from the start of one row to the next
+
+		// Constructors | external pixels (a stride of 0 means tightly packed rows)
+		ImageViewRGBA(glm::u8vec4* data, int width, int height, size_t stride = 0);
 
 		// Constructors | copy / conversions
 		ImageViewRGBA(const ImageRGBA& othger);
@@ -491,10 +1063,17 @@ namespace it {
 		// Operators | onversions
 		ImageViewRGBA& operator=(const ImageRGBA& other);
 
+		// Operators | expressions (defined in media/Expression.h)
+		template<typename Derived>
+		ImageViewRGBA& operator=(const PixelExpression<Derived>& expression);
+
 		// Functions
 		size_t pixelCount() const;
 		size_t dataSize() const;
 		glm::u8vec4 pixelAt(int x, int y) const;
 		bool hasData() const;
+		glm::u8vec4* row(int y) const;
+		ImageViewRGBA subView(const ui::Rect& rect) const; // Clipped to the view, shares its pixels
+		bool isContiguous() const;
 	};
 }
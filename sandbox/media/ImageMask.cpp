@@ -0,0 +1,480 @@
+#include "ImageMask.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+// Dependencies | core
+#include <core/Parallel.h>
+#include <core/Simd.h>
+
+// Dependencies | media
+#include <media/Blend.h>
+
+namespace it {
+	namespace {
+		constexpr int WORD_BITS{ 64 };
+		constexpr std::uint64_t ALL_SET{ ~std::uint64_t{ 0 } };
+		// Pixels per parallel range
+		constexpr int PARALLEL_GRAIN{ 65536 };
+
+		int rowGrain(int width) {
+			return std::max(1, PARALLEL_GRAIN / std::max(1, width));
+		}
+
+		// Bits [first, last) of one word
+		std::uint64_t bitRange(int first, int last) {
+			const std::uint64_t upper = last >= WORD_BITS ? ALL_SET : (std::uint64_t{ 1 } << last) - 1U;
+			return upper & (ALL_SET << first);
+		}
+		// Valid bits of the last word of a row
+		std::uint64_t lastWordBits(int width) {
+			const int used = width % WORD_BITS;
+			return used == 0 ? ALL_SET : bitRange(0, used);
+		}
+
+		// Bits of 64 samples at or above the threshold; STRIDE is the distance between samples and OFFSET the sample
+		// compared within each pixel
+		template<int STRIDE, int OFFSET>
+		std::uint64_t thresholdWord(const unsigned char* pixels, int count, unsigned char threshold) {
+			std::uint64_t bits = 0;
+			int x = 0;
+#if defined(IT_SIMD_SSE2)
+			const __m128i THRESHOLD = _mm_set1_epi8(static_cast<char>(threshold));
+			for (; x + 16 <= count; x += 16) {
+				const unsigned char* group = pixels + static_cast<size_t>(x) * STRIDE;
+				__m128i samples;
+				if constexpr (STRIDE == 1) {
+					samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+				} else if constexpr (STRIDE == 2) {
+					const __m128i first = _mm_srli_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group)), 8 * OFFSET);
+					const __m128i second = _mm_srli_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group + 16)), 8 * OFFSET);
+					samples = _mm_packus_epi16(_mm_and_si128(first, _mm_set1_epi16(0xFF)), _mm_and_si128(second, _mm_set1_epi16(0xFF)));
+				} else {
+					__m128i quarters[4];
+					for (int quarter = 0; quarter < 4; quarter++)
+						quarters[quarter] = _mm_and_si128(_mm_srli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group + 16 * quarter)), 8 * OFFSET), _mm_set1_epi32(0xFF));
+					samples = _mm_packus_epi16(_mm_packs_epi32(quarters[0], quarters[1]), _mm_packs_epi32(quarters[2], quarters[3]));
+				}
+				// samples >= threshold <=> max(samples, threshold) == samples
+				const int lanes = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(samples, THRESHOLD), samples));
+				bits |= static_cast<std::uint64_t>(static_cast<unsigned int>(lanes)) << x;
+			}
+#endif
+			for (; x < count; x++)
+				if (pixels[static_cast<size_t>(x) * STRIDE + OFFSET] >= threshold)
+					bits |= std::uint64_t{ 1 } << x;
+			return bits;
+		}
+
+		template<int STRIDE, int OFFSET>
+		bool thresholdRows(const unsigned char* data, size_t stride, int width, int height, ImageMask& mask, unsigned char threshold) {
+			// Error check
+			if (data == nullptr || width <= 0 || height <= 0)
+				return false;
+			if (mask.allocate(width, height) == nullptr)
+				return false;
+
+			parallelFor(0, height, [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd; y++) {
+					const unsigned char* pixels = data + static_cast<size_t>(y) * stride;
+					std::uint64_t* words = mask.row(y);
+					for (int word = 0; word < mask.getWordsPerRow(); word++) {
+						const int x = word * WORD_BITS;
+						words[word] = thresholdWord<STRIDE, OFFSET>(pixels + static_cast<size_t>(x) * STRIDE, std::min(WORD_BITS, width - x), threshold);
+					}
+				}
+			}, rowGrain(width));
+			return true;
+		}
+
+		enum class Logic {
+			AND,
+			OR,
+			XOR,
+			NOT // Of the first mask
+		};
+
+		template<Logic LOGIC>
+		std::uint64_t apply(std::uint64_t first, std::uint64_t second) {
+			if constexpr (LOGIC == Logic::AND)
+				return first & second;
+			else if constexpr (LOGIC == Logic::OR)
+				return first | second;
+			else if constexpr (LOGIC == Logic::XOR)
+				return first ^ second;
+			else
+				return ~first;
+		}
+#if defined(IT_SIMD_SSE2)
+		template<Logic LOGIC>
+		__m128i apply(__m128i first, __m128i second) {
+			if constexpr (LOGIC == Logic::AND)
+				return _mm_and_si128(first, second);
+			else if constexpr (LOGIC == Logic::OR)
+				return _mm_or_si128(first, second);
+			else if constexpr (LOGIC == Logic::XOR)
+				return _mm_xor_si128(first, second);
+			else
+				return _mm_xor_si128(first, _mm_set1_epi32(-1));
+		}
+#endif
+
+		// Whole rows at once, two words per SSE2 register
+		template<Logic LOGIC>
+		bool combineMasks(const ImageMask& first, const ImageMask& second, ImageMask& destination) {
+			// Error check
+			if (!first.isAllocated() || !second.isAllocated())
+				return false;
+			if (first.getWidth() != second.getWidth() || first.getHeight() != second.getHeight())
+				return false;
+			if (&destination != &first && &destination != &second && destination.allocate(first.getWidth(), first.getHeight()) == nullptr)
+				return false;
+
+			const int words = first.getWordsPerRow();
+			const std::uint64_t lastBits = lastWordBits(first.getWidth());
+			parallelFor(0, first.getHeight(), [&](int rowBegin, int rowEnd) {
+				const size_t count = static_cast<size_t>(rowEnd - rowBegin) * static_cast<size_t>(words);
+				const std::uint64_t* a = first.row(rowBegin);
+				const std::uint64_t* b = second.row(rowBegin);
+				std::uint64_t* result = destination.row(rowBegin);
+				size_t i = 0;
+#if defined(IT_SIMD_SSE2)
+				for (; i + 2 <= count; i += 2) {
+					const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+					const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(result + i), apply<LOGIC>(left, right));
+				}
+#endif
+				for (; i < count; i++)
+					result[i] = apply<LOGIC>(a[i], b[i]);
+
+				// Not sets the bits past the width
+				if constexpr (LOGIC == Logic::NOT)
+					for (int y = rowBegin; y < rowEnd; y++)
+						destination.row(y)[words - 1] &= lastBits;
+			}, rowGrain(first.getWidth()));
+			return true;
+		}
+
+		// Calls body(x, count) for every run of set pixels in [left, right) of a mask row
+		template<typename Body>
+		void forEachRun(const std::uint64_t* words, int left, int right, Body&& body) {
+			int x = left;
+			while (x < right) {
+				const std::uint64_t bits = words[x / WORD_BITS] >> (x % WORD_BITS);
+				if (bits == 0) {
+					x = (x / WORD_BITS + 1) * WORD_BITS;
+					continue;
+				}
+				x += std::countr_zero(bits);
+				if (x >= right)
+					break;
+
+				// The bits past the width are clear, so no run leaves the row
+				int end = x;
+				for (;;) {
+					const int offset = end % WORD_BITS;
+					const int ones = std::countr_one(words[end / WORD_BITS] >> offset);
+					end += ones;
+					if (ones < WORD_BITS - offset || end >= right)
+						break;
+				}
+				end = std::min(end, right);
+				body(x, end - x);
+				x = end;
+			}
+		}
+
+		template<typename View, typename Pixel>
+		bool fillMasked(const View& image, const ui::Rect& rect, const Pixel& color, const ImageMask& clip) {
+			// Error check
+			if (!image.hasData() || !clip.isAllocated())
+				return false;
+			if (clip.getWidth() != image.width || clip.getHeight() != image.height)
+				return false;
+
+			const ui::Rect area = rect.intersected({ { 0, 0 }, { image.width, image.height } });
+			if (!area.isValid())
+				return true;
+
+			parallelFor(area.top(), area.bottom(), [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd; y++) {
+					Pixel* pixels = image.row(y);
+					forEachRun(clip.row(y), area.left(), area.right(), [&](int x, int count) {
+						std::fill(pixels + x, pixels + x + count, color);
+					});
+				}
+			}, rowGrain(area.width()));
+			return true;
+		}
+
+		template<typename View>
+		bool blendMasked(const View& foreground, const View& image, const ImageMask& clip, glm::ivec2 position) {
+			// Error check
+			if (!foreground.hasData() || !image.hasData() || !clip.isAllocated())
+				return false;
+			if (clip.getWidth() != image.width || clip.getHeight() != image.height)
+				return false;
+
+			const ui::Rect area = ui::Rect{ position, { foreground.width, foreground.height } }.intersected({ { 0, 0 }, { image.width, image.height } });
+			if (!area.isValid())
+				return true;
+
+			const int channels = static_cast<int>(sizeof(*image.data));
+			parallelFor(area.top(), area.bottom(), [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd; y++) {
+					const unsigned char* source = reinterpret_cast<const unsigned char*>(foreground.row(y - position.y));
+					unsigned char* destination = reinterpret_cast<unsigned char*>(image.row(y));
+					forEachRun(clip.row(y), area.left(), area.right(), [&](int x, int count) {
+						unsigned char* pixels = destination + static_cast<size_t>(x) * channels;
+						blendOver(pixels, source + static_cast<size_t>(x - position.x) * channels, pixels, count, channels);
+					});
+				}
+			}, rowGrain(area.width()));
+			return true;
+		}
+	}
+
+	// class ImageMask
+
+	// Constructor / Destructor
+	ImageMask::ImageMask(int width, int height) {
+		allocate(width, height);
+	}
+	ImageMask::ImageMask(const ImageMask& other) {
+		*this = other;
+	}
+	ImageMask::ImageMask(ImageMask&& other) noexcept {
+		*this = std::move(other);
+	}
+	ImageMask::~ImageMask() {
+		free();
+	}
+
+	// Operators | assignment
+	ImageMask& ImageMask::operator=(const ImageMask& other) {
+		if (this == &other)
+			return *this;
+
+		if (other.data == nullptr) {
+			free();
+			return *this;
+		}
+		if (allocate(other.width, other.height) != nullptr)
+			std::memcpy(data, other.data, other.dataSize());
+
+		return *this;
+	}
+	ImageMask& ImageMask::operator=(ImageMask&& other) noexcept {
+		if (this == &other)
+			return *this;
+
+		free();
+
+		width = other.width;
+		height = other.height;
+		wordsPerRow = other.wordsPerRow;
+		data = other.data;
+
+		other.width = 0;
+		other.height = 0;
+		other.wordsPerRow = 0;
+		other.data = nullptr;
+
+		return *this;
+	}
+
+	// Getters
+	int ImageMask::getWidth() const {
+		return width;
+	}
+	int ImageMask::getHeight() const {
+		return height;
+	}
+	int ImageMask::getWordsPerRow() const {
+		return wordsPerRow;
+	}
+	std::uint64_t* ImageMask::getData() const {
+		return data;
+	}
+
+	// Functions | allocation / deallocation
+	std::uint64_t* ImageMask::allocate(int width, int height) {
+		assert(width > 0 && "width must be greater than 0");
+		assert(height > 0 && "height must be greater than 0");
+		if (width <= 0 || height <= 0)
+			return nullptr;
+
+		if (data != nullptr && this->width == width && this->height == height) {
+			std::memset(data, 0, dataSize());
+			return data;
+		}
+
+		free();
+		const int words = (width + WORD_BITS - 1) / WORD_BITS;
+		data = reinterpret_cast<std::uint64_t*>(std::calloc(static_cast<size_t>(words) * static_cast<size_t>(height), sizeof(std::uint64_t)));
+		if (data == nullptr)
+			return nullptr;
+
+		this->width = width;
+		this->height = height;
+		wordsPerRow = words;
+		return data;
+	}
+	bool ImageMask::isAllocated() const {
+		return data != nullptr;
+	}
+	size_t ImageMask::dataSize() const {
+		return static_cast<size_t>(wordsPerRow) * static_cast<size_t>(height) * sizeof(std::uint64_t);
+	}
+	void ImageMask::free() {
+		width = 0;
+		height = 0;
+		wordsPerRow = 0;
+		if (data != nullptr) {
+			std::free(data);
+			data = nullptr;
+		}
+	}
+
+	// Functions | pixels
+	std::uint64_t* ImageMask::row(int y) const {
+		assert(data != nullptr);
+		assert(y >= 0 && y < height && "y is out of range");
+		return data + static_cast<size_t>(y) * static_cast<size_t>(wordsPerRow);
+	}
+	bool ImageMask::pixelAt(int x, int y) const {
+		assert(x >= 0 && x < width && "x is out of range");
+		return (row(y)[x / WORD_BITS] >> (x % WORD_BITS)) & 1U;
+	}
+	bool ImageMask::setPixel(int x, int y, bool value) {
+		if (data == nullptr || x < 0 || y < 0 || x >= width || y >= height)
+			return false;
+
+		std::uint64_t& word = row(y)[x / WORD_BITS];
+		const std::uint64_t bit = std::uint64_t{ 1 } << (x % WORD_BITS);
+		word = value ? word | bit : word & ~bit;
+		return true;
+	}
+	void ImageMask::fill(bool value) {
+		if (data == nullptr)
+			return;
+
+		fillRect({ { 0, 0 }, { width, height } }, value);
+	}
+	void ImageMask::fillRect(const ui::Rect& rect, bool value) {
+		const ui::Rect area = rect.intersected({ { 0, 0 }, { width, height } });
+		if (data == nullptr || !area.isValid())
+			return;
+
+		const int firstWord = area.left() / WORD_BITS;
+		const int lastWord = (area.right() - 1) / WORD_BITS;
+		for (int y = area.top(); y < area.bottom(); y++) {
+			std::uint64_t* words = row(y);
+			for (int word = firstWord; word <= lastWord; word++) {
+				const int first = std::max(area.left() - word * WORD_BITS, 0);
+				const int last = std::min(area.right() - word * WORD_BITS, WORD_BITS);
+				const std::uint64_t bits = bitRange(first, last);
+				words[word] = value ? words[word] | bits : words[word] & ~bits;
+			}
+		}
+	}
+	size_t ImageMask::countPixels() const {
+		size_t count = 0;
+		const size_t words = dataSize() / sizeof(std::uint64_t);
+		for (size_t word = 0; word < words; word++)
+			count += static_cast<size_t>(std::popcount(data[word]));
+		return count;
+	}
+	size_t ImageMask::countPixels(const ui::Rect& rect) const {
+		const ui::Rect area = rect.intersected({ { 0, 0 }, { width, height } });
+		if (data == nullptr || !area.isValid())
+			return 0;
+
+		size_t count = 0;
+		const int firstWord = area.left() / WORD_BITS;
+		const int lastWord = (area.right() - 1) / WORD_BITS;
+		const std::uint64_t firstBits = bitRange(area.left() - firstWord * WORD_BITS, WORD_BITS);
+		const std::uint64_t lastBits = bitRange(0, area.right() - lastWord * WORD_BITS);
+		for (int y = area.top(); y < area.bottom(); y++) {
+			const std::uint64_t* words = row(y);
+			if (firstWord == lastWord) {
+				count += static_cast<size_t>(std::popcount(words[firstWord] & firstBits & lastBits));
+				continue;
+			}
+			count += static_cast<size_t>(std::popcount(words[firstWord] & firstBits));
+			for (int word = firstWord + 1; word < lastWord; word++)
+				count += static_cast<size_t>(std::popcount(words[word]));
+			count += static_cast<size_t>(std::popcount(words[lastWord] & lastBits));
+		}
+		return count;
+	}
+
+	// Functions | conversions
+	bool thresholdMask(const ImageViewGray& source, ImageMask& mask, unsigned char threshold) {
+		return thresholdRows<1, 0>(source.data, source.stride, source.width, source.height, mask, threshold);
+	}
+	bool alphaMask(const ImageViewGrayAlpha& source, ImageMask& mask, unsigned char threshold) {
+		return thresholdRows<2, 1>(reinterpret_cast<const unsigned char*>(source.data), source.stride, source.width, source.height, mask, threshold);
+	}
+	bool alphaMask(const ImageViewRGBA& source, ImageMask& mask, unsigned char threshold) {
+		return thresholdRows<4, 3>(reinterpret_cast<const unsigned char*>(source.data), source.stride, source.width, source.height, mask, threshold);
+	}
+	bool maskToGray(const ImageMask& mask, const ImageViewGray& destination) {
+		// Error check
+		if (!mask.isAllocated() || !destination.hasData())
+			return false;
+		if (mask.getWidth() != destination.width || mask.getHeight() != destination.height)
+			return false;
+
+		parallelFor(0, destination.height, [&](int rowBegin, int rowEnd) {
+			for (int y = rowBegin; y < rowEnd; y++) {
+				unsigned char* pixels = destination.row(y);
+				std::memset(pixels, 0, static_cast<size_t>(destination.width));
+				forEachRun(mask.row(y), 0, destination.width, [&](int x, int count) {
+					std::memset(pixels + x, 255, static_cast<size_t>(count));
+				});
+			}
+		}, rowGrain(destination.width));
+		return true;
+	}
+
+	// Functions | logic
+	bool maskAnd(const ImageMask& first, const ImageMask& second, ImageMask& destination) {
+		return combineMasks<Logic::AND>(first, second, destination);
+	}
+	bool maskOr(const ImageMask& first, const ImageMask& second, ImageMask& destination) {
+		return combineMasks<Logic::OR>(first, second, destination);
+	}
+	bool maskXor(const ImageMask& first, const ImageMask& second, ImageMask& destination) {
+		return combineMasks<Logic::XOR>(first, second, destination);
+	}
+	bool maskNot(const ImageMask& source, ImageMask& destination) {
+		return combineMasks<Logic::NOT>(source, source, destination);
+	}
+
+	// Functions | clipping
+	bool fillRect(const ImageViewGray& image, const ui::Rect& rect, unsigned char color, const ImageMask& clip) {
+		return fillMasked(image, rect, color, clip);
+	}
+	bool fillRect(const ImageViewGrayAlpha& image, const ui::Rect& rect, glm::u8vec2 color, const ImageMask& clip) {
+		return fillMasked(image, rect, color, clip);
+	}
+	bool fillRect(const ImageViewRGB& image, const ui::Rect& rect, glm::u8vec3 color, const ImageMask& clip) {
+		return fillMasked(image, rect, color, clip);
+	}
+	bool fillRect(const ImageViewRGBA& image, const ui::Rect& rect, glm::u8vec4 color, const ImageMask& clip) {
+		return fillMasked(image, rect, color, clip);
+	}
+	bool blend(const ImageViewGrayAlpha& foreground, const ImageViewGrayAlpha& image, const ImageMask& clip, glm::ivec2 position) {
+		return blendMasked(foreground, image, clip, position);
+	}
+	bool blend(const ImageViewRGBA& foreground, const ImageViewRGBA& image, const ImageMask& clip, glm::ivec2 position) {
+		return blendMasked(foreground, image, clip, position);
+	}
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+// Dependencies | std
+#include <cstddef>
+#include <cstdint>
+
+// Dependencies | glm
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+// Dependencies | core
+#include <core/Rect.h>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Classes
+	// One bit per pixel: pixel x of a row is bit x % 64 of word x / 64. Every row starts on a 64-bit word and the bits
+	// past the width are always clear, so whole words can be combined and counted without masking.
+	class ImageMask {
+		// Object
+		private:
+			// Properties
+			int width{ 0 };
+			int height{ 0 };
+			int wordsPerRow{ 0 };
+			std::uint64_t* data{ nullptr };
+
+		public:
+			// Constructor / Destructor
+			ImageMask() = default;
+			ImageMask(int width, int height); // All pixels clear
+			ImageMask(const ImageMask& other);
+			ImageMask(ImageMask&& other) noexcept;
+			~ImageMask();
+
+			// Operators | assignment
+			ImageMask& operator=(const ImageMask& other);
+			ImageMask& operator=(ImageMask&& other) noexcept;
+
+			// Getters
+			int getWidth() const;
+			int getHeight() const;
+			int getWordsPerRow() const;
+			std::uint64_t* getData() const;
+
+			// Functions | allocation / deallocation
+			std::uint64_t* allocate(int width, int height); // All pixels clear
+			bool isAllocated() const;
+			size_t dataSize() const;
+			void free();
+
+			// Functions | pixels
+			std::uint64_t* row(int y) const;
+			bool pixelAt(int x, int y) const;
+			bool setPixel(int x, int y, bool value);
+			void fill(bool value);
+			void fillRect(const ui::Rect& rect, bool value); // Clipped to the mask
+			size_t countPixels() const; // Set pixels, by population count
+			size_t countPixels(const ui::Rect& rect) const; // Set pixels inside rect (clipped to the mask)
+	};
+
+	// Functions | conversions
+	// Set where the gray value (alpha) is at least threshold; 16 pixels per SSE2 compare. The mask is (re)allocated to
+	// the size of the source.
+	bool thresholdMask(const ImageViewGray& source, ImageMask& mask, unsigned char threshold = 128);
+	bool alphaMask(const ImageViewGrayAlpha& source, ImageMask& mask, unsigned char threshold = 128);
+	bool alphaMask(const ImageViewRGBA& source, ImageMask& mask, unsigned char threshold = 128);
+	bool maskToGray(const ImageMask& mask, const ImageViewGray& destination); // 255 where set, 0 elsewhere; same size
+
+	// Functions | logic
+	// Word-wise in SSE2. The sources must have the same size; destination is (re)allocated and may be either source.
+	bool maskAnd(const ImageMask& first, const ImageMask& second, ImageMask& destination);
+	bool maskOr(const ImageMask& first, const ImageMask& second, ImageMask& destination);
+	bool maskXor(const ImageMask& first, const ImageMask& second, ImageMask& destination);
+	bool maskNot(const ImageMask& source, ImageMask& destination);
+
+	// Functions | clipping
+	// Only pixels whose mask bit is set are written; the mask has the size of the image and rect is clipped to it.
+	// Runs of set bits are found a word at a time, so fully set words fill 64 pixels at once.
+	bool fillRect(const ImageViewGray& image, const ui::Rect& rect, unsigned char color, const ImageMask& clip);
+	bool fillRect(const ImageViewGrayAlpha& image, const ui::Rect& rect, glm::u8vec2 color, const ImageMask& clip);
+	bool fillRect(const ImageViewRGB& image, const ui::Rect& rect, glm::u8vec3 color, const ImageMask& clip);
+	bool fillRect(const ImageViewRGBA& image, const ui::Rect& rect, glm::u8vec4 color, const ImageMask& clip);
+	// Straight alpha foreground over the image, with the top left corner of the foreground at position
+	bool blend(const ImageViewGrayAlpha& foreground, const ImageViewGrayAlpha& image, const ImageMask& clip, glm::ivec2 position = glm::ivec2(0));
+	bool blend(const ImageViewRGBA& foreground, const ImageViewRGBA& image, const ImageMask& clip, glm::ivec2 position = glm::ivec2(0));
+}
@@ -0,0 +1,360 @@
+#include "ImagePlanar.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+// Dependencies | core
+#include <core/Simd.h>
+
+namespace it {
+	namespace {
+		// Pixels per parallel range
+		constexpr int PARALLEL_GRAIN{ 65536 };
+
+		int rowGrain(int width) {
+			return std::max(1, PARALLEL_GRAIN / std::max(1, width));
+		}
+
+		// Byte shuffles for 16 pixels of interleaved samples. gatherMask picks the samples of one channel found in
+		// input register part; scatterMask places the samples of one channel plane that belong in output register part.
+		using ShuffleMask = std::array<char, 16>;
+		constexpr ShuffleMask gatherMask(int channels, int channel, int part) {
+			ShuffleMask mask{};
+			for (int pixel = 0; pixel < 16; pixel++) {
+				const int byte = pixel * channels + channel;
+				mask[pixel] = byte / 16 == part ? static_cast<char>(byte % 16) : static_cast<char>(-1);
+			}
+			return mask;
+		}
+		constexpr ShuffleMask scatterMask(int channels, int channel, int part) {
+			ShuffleMask mask{};
+			for (int lane = 0; lane < 16; lane++) {
+				const int byte = part * 16 + lane;
+				mask[lane] = byte % channels == channel ? static_cast<char>(byte / channels) : static_cast<char>(-1);
+			}
+			return mask;
+		}
+		constexpr std::array<ShuffleMask, 9> GATHER_RGB{
+			gatherMask(3, 0, 0), gatherMask(3, 0, 1), gatherMask(3, 0, 2),
+			gatherMask(3, 1, 0), gatherMask(3, 1, 1), gatherMask(3, 1, 2),
+			gatherMask(3, 2, 0), gatherMask(3, 2, 1), gatherMask(3, 2, 2)
+		};
+		constexpr std::array<ShuffleMask, 9> SCATTER_RGB{
+			scatterMask(3, 0, 0), scatterMask(3, 1, 0), scatterMask(3, 2, 0),
+			scatterMask(3, 0, 1), scatterMask(3, 1, 1), scatterMask(3, 2, 1),
+			scatterMask(3, 0, 2), scatterMask(3, 1, 2), scatterMask(3, 2, 2)
+		};
+		// Groups each register of 4 RGBA pixels by channel: r0 r1 r2 r3 g0 g1 ... a3
+		constexpr ShuffleMask GROUP_RGBA{ 0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15 };
+
+#if defined(IT_SIMD_SSSE3)
+		__m128i loadMask(const ShuffleMask& mask) {
+			return _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask.data()));
+		}
+#endif
+
+		// Functions | rows
+		void splitRow(const unsigned char* source, int width, int channels, unsigned char* const* planes) {
+			int x = 0;
+#if defined(IT_SIMD_SSE2)
+			if (channels == 2) {
+				const __m128i lowByte = _mm_set1_epi16(0x00FF);
+				for (; x + 16 <= width; x += 16) {
+					const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 2 * x));
+					const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 2 * x + 16));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(planes[0] + x), _mm_packus_epi16(_mm_and_si128(first, lowByte), _mm_and_si128(second, lowByte)));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(planes[1] + x), _mm_packus_epi16(_mm_srli_epi16(first, 8), _mm_srli_epi16(second, 8)));
+				}
+			}
+#endif
+#if defined(IT_SIMD_SSSE3)
+			if (channels == 3) {
+				__m128i masks[9];
+				for (int index = 0; index < 9; index++)
+					masks[index] = loadMask(GATHER_RGB[index]);
+				for (; x + 16 <= width; x += 16) {
+					const __m128i* pixels = reinterpret_cast<const __m128i*>(source + 3 * x);
+					const __m128i parts[3]{ _mm_loadu_si128(pixels), _mm_loadu_si128(pixels + 1), _mm_loadu_si128(pixels + 2) };
+					for (int channel = 0; channel < 3; channel++) {
+						const __m128i* mask = masks + channel * 3;
+						const __m128i samples = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(parts[0], mask[0]), _mm_shuffle_epi8(parts[1], mask[1])), _mm_shuffle_epi8(parts[2], mask[2]));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(planes[channel] + x), samples);
+					}
+				}
+			}
+			else if (channels == 4) {
+				const __m128i group = loadMask(GROUP_RGBA);
+				for (; x + 16 <= width; x += 16) {
+					const __m128i* pixels = reinterpret_cast<const __m128i*>(source + 4 * x);
+					const __m128i first = _mm_shuffle_epi8(_mm_loadu_si128(pixels), group);
+					const __m128i second = _mm_shuffle_epi8(_mm_loadu_si128(pixels + 1), group);
+					const __m128i third = _mm_shuffle_epi8(_mm_loadu_si128(pixels + 2), group);
+					const __m128i fourth = _mm_shuffle_epi8(_mm_loadu_si128(pixels + 3), group);
+					// Red and green of pixels 0-7, blue and alpha of pixels 0-7, then the same for pixels 8-15
+					const __m128i redGreenLow = _mm_unpacklo_epi32(first, second);
+					const __m128i blueAlphaLow = _mm_unpackhi_epi32(first, second);
+					const __m128i redGreenHigh = _mm_unpacklo_epi32(third, fourth);
+					const __m128i blueAlphaHigh = _mm_unpackhi_epi32(third, fourth);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(planes[0] + x), _mm_unpacklo_epi64(redGreenLow, redGreenHigh));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(planes[1] + x), _mm_unpackhi_epi64(redGreenLow, redGreenHigh));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(planes[2] + x), _mm_unpacklo_epi64(blueAlphaLow, blueAlphaHigh));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(planes[3] + x), _mm_unpackhi_epi64(blueAlphaLow, blueAlphaHigh));
+				}
+			}
+#endif
+			if (channels == 1) {
+				std::memcpy(planes[0], source, static_cast<size_t>(width));
+				return;
+			}
+			for (; x < width; x++)
+				for (int channel = 0; channel < channels; channel++)
+					planes[channel][x] = source[x * channels + channel];
+		}
+
+		void mergeRow(const unsigned char* const* planes, int width, int channels, unsigned char* destination) {
+			int x = 0;
+#if defined(IT_SIMD_SSE2)
+			if (channels == 2) {
+				for (; x + 16 <= width; x += 16) {
+					const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[0] + x));
+					const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[1] + x));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 2 * x), _mm_unpacklo_epi8(first, second));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 2 * x + 16), _mm_unpackhi_epi8(first, second));
+				}
+			}
+			else if (channels == 4) {
+				for (; x + 16 <= width; x += 16) {
+					const __m128i red = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[0] + x));
+					const __m128i green = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[1] + x));
+					const __m128i blue = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[2] + x));
+					const __m128i alpha = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[3] + x));
+					const __m128i redGreenLow = _mm_unpacklo_epi8(red, green);
+					const __m128i redGreenHigh = _mm_unpackhi_epi8(red, green);
+					const __m128i blueAlphaLow = _mm_unpacklo_epi8(blue, alpha);
+					const __m128i blueAlphaHigh = _mm_unpackhi_epi8(blue, alpha);
+					__m128i* pixels = reinterpret_cast<__m128i*>(destination + 4 * x);
+					_mm_storeu_si128(pixels, _mm_unpacklo_epi16(redGreenLow, blueAlphaLow));
+					_mm_storeu_si128(pixels + 1, _mm_unpackhi_epi16(redGreenLow, blueAlphaLow));
+					_mm_storeu_si128(pixels + 2, _mm_unpacklo_epi16(redGreenHigh, blueAlphaHigh));
+					_mm_storeu_si128(pixels + 3, _mm_unpackhi_epi16(redGreenHigh, blueAlphaHigh));
+				}
+			}
+#endif
+#if defined(IT_SIMD_SSSE3)
+			if (channels == 3) {
+				__m128i masks[9];
+				for (int index = 0; index < 9; index++)
+					masks[index] = loadMask(SCATTER_RGB[index]);
+				for (; x + 16 <= width; x += 16) {
+					const __m128i red = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[0] + x));
+					const __m128i green = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[1] + x));
+					const __m128i blue = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[2] + x));
+					__m128i* pixels = reinterpret_cast<__m128i*>(destination + 3 * x);
+					for (int part = 0; part < 3; part++) {
+						const __m128i* mask = masks + part * 3;
+						_mm_storeu_si128(pixels + part, _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(red, mask[0]), _mm_shuffle_epi8(green, mask[1])), _mm_shuffle_epi8(blue, mask[2])));
+					}
+				}
+			}
+#endif
+			if (channels == 1) {
+				std::memcpy(destination, planes[0], static_cast<size_t>(width));
+				return;
+			}
+			for (; x < width; x++)
+				for (int channel = 0; channel < channels; channel++)
+					destination[x * channels + channel] = planes[channel][x];
+		}
+	}
+
+	// class ImagePlanar
+
+	// Constructor / Destructor
+	ImagePlanar::ImagePlanar(int width, int height, int channels) {
+		allocate(width, height, channels);
+	}
+	ImagePlanar::ImagePlanar(const ImagePlanar& other) {
+		*this = other;
+	}
+	ImagePlanar::ImagePlanar(ImagePlanar&& other) noexcept {
+		*this = std::move(other);
+	}
+	ImagePlanar::~ImagePlanar() {
+		free();
+	}
+
+	// Operators | assignment
+	ImagePlanar& ImagePlanar::operator=(const ImagePlanar& other) {
+		if (this == &other)
+			return *this;
+
+		if (other.data == nullptr) {
+			free();
+			return *this;
+		}
+		if (allocate(other.width, other.height, other.channels) != nullptr)
+			std::memcpy(data, other.data, other.dataSize());
+
+		return *this;
+	}
+	ImagePlanar& ImagePlanar::operator=(ImagePlanar&& other) noexcept {
+		if (this == &other)
+			return *this;
+
+		free();
+
+		width = other.width;
+		height = other.height;
+		channels = other.channels;
+		stride = other.stride;
+		allocation = other.allocation;
+		data = other.data;
+
+		other.width = 0;
+		other.height = 0;
+		other.channels = 0;
+		other.stride = 0;
+		other.allocation = nullptr;
+		other.data = nullptr;
+
+		return *this;
+	}
+
+	// Getters
+	int ImagePlanar::getWidth() const {
+		return width;
+	}
+	int ImagePlanar::getHeight() const {
+		return height;
+	}
+	int ImagePlanar::getChannels() const {
+		return channels;
+	}
+	size_t ImagePlanar::getStride() const {
+		return stride;
+	}
+	unsigned char* ImagePlanar::getData() const {
+		return data;
+	}
+
+	// Functions | allocation / deallocation
+	unsigned char* ImagePlanar::allocate(int width, int height, int channels) {
+		free();
+
+		if (width <= 0 || height <= 0 || channels < 1 || channels > MAXIMUM_CHANNELS)
+			return nullptr;
+
+		const size_t paddedStride = (static_cast<size_t>(width) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+		allocation = reinterpret_cast<unsigned char*>(std::malloc(paddedStride * static_cast<size_t>(height) * static_cast<size_t>(channels) + ALIGNMENT));
+		if (allocation == nullptr)
+			return nullptr;
+
+		const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(allocation);
+		data = allocation + (ALIGNMENT - address % ALIGNMENT) % ALIGNMENT;
+		this->width = width;
+		this->height = height;
+		this->channels = channels;
+		stride = paddedStride;
+		return data;
+	}
+	bool ImagePlanar::isAllocated() const {
+		return data != nullptr;
+	}
+	size_t ImagePlanar::dataSize() const {
+		return planeSize() * static_cast<size_t>(channels);
+	}
+	size_t ImagePlanar::planeSize() const {
+		return stride * static_cast<size_t>(height);
+	}
+	void ImagePlanar::free() {
+		width = 0;
+		height = 0;
+		channels = 0;
+		stride = 0;
+		data = nullptr;
+		if (allocation != nullptr) {
+			std::free(allocation);
+			allocation = nullptr;
+		}
+	}
+
+	// Functions | planes
+	unsigned char* ImagePlanar::plane(int channel) const {
+		if (data == nullptr || channel < 0 || channel >= channels)
+			return nullptr;
+		return data + planeSize() * static_cast<size_t>(channel);
+	}
+	unsigned char* ImagePlanar::row(int channel, int y) const {
+		return plane(channel) + static_cast<size_t>(y) * stride;
+	}
+	ImageViewGray ImagePlanar::planeView(int channel) const {
+		unsigned char* pixels = plane(channel);
+		if (pixels == nullptr)
+			return ImageViewGray(nullptr, 0, 0);
+		return ImageViewGray(pixels, width, height, stride);
+	}
+
+	// Functions | pixel manipulation
+	size_t ImagePlanar::pixelCount() const {
+		return static_cast<size_t>(width) * static_cast<size_t>(height);
+	}
+	unsigned char ImagePlanar::sampleAt(int x, int y, int channel) const {
+		return row(channel, y)[x];
+	}
+	bool ImagePlanar::setSample(int x, int y, int channel, unsigned char value) {
+		// Error check
+		if (x < 0 || y < 0 || x >= width || y >= height || channel < 0 || channel >= channels)
+			return false;
+
+		row(channel, y)[x] = value;
+		return true;
+	}
+
+	// Functions | conversions
+	bool deinterleave(const ImageView& source, ImagePlanar& destination, ExecutionPolicy policy) {
+		// Error check
+		if (!source.hasData() || source.channels < 1 || source.channels > ImagePlanar::MAXIMUM_CHANNELS)
+			return false;
+		if (destination.allocate(source.width, source.height, source.channels) == nullptr)
+			return false;
+
+		parallelFor(0, source.height, [&](int begin, int end) {
+			std::array<unsigned char*, ImagePlanar::MAXIMUM_CHANNELS> planes{};
+			for (int y = begin; y < end; y++) {
+				for (int channel = 0; channel < source.channels; channel++)
+					planes[channel] = destination.row(channel, y);
+				splitRow(source.row(y), source.width, source.channels, planes.data());
+			}
+		}, rowGrain(source.width), policy);
+
+		return true;
+	}
+	bool interleave(const ImagePlanar& source, const ImageView& destination, ExecutionPolicy policy) {
+		// Error check
+		if (!source.isAllocated() || !destination.hasData() || destination.channels < 1 || destination.channels > ImagePlanar::MAXIMUM_CHANNELS)
+			return false;
+		if (source.getWidth() != destination.width || source.getHeight() != destination.height)
+			return false;
+		const bool addAlpha = destination.channels == source.getChannels() + 1 && (destination.channels == 2 || destination.channels == 4);
+		if (destination.channels > source.getChannels() && !addAlpha)
+			return false;
+
+		const std::vector<unsigned char> opaque(addAlpha ? static_cast<size_t>(destination.width) : 0, 255);
+		parallelFor(0, destination.height, [&](int begin, int end) {
+			std::array<const unsigned char*, ImagePlanar::MAXIMUM_CHANNELS> planes{};
+			for (int y = begin; y < end; y++) {
+				for (int channel = 0; channel < destination.channels; channel++)
+					planes[channel] = channel < source.getChannels() ? source.row(channel, y) : opaque.data();
+				mergeRow(planes.data(), destination.width, destination.channels, destination.row(y));
+			}
+		}, rowGrain(destination.width), policy);
+
+		return true;
+	}
+}
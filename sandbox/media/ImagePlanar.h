@@ -0,0 +1,81 @@
+#pragma once
+
+// Dependencies | std
+#include <cstddef>
+
+// Dependencies | core
+#include <core/Parallel.h>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Classes
+	// 8-bit image with every channel in its own plane (structure of arrays) of width x height samples. Planes start on
+	// 64-byte boundaries and their rows are padded to a multiple of 64 bytes, so per-channel kernels run whole vectors
+	// from aligned row starts and only touch the planes they need.
+	class ImagePlanar {
+		// Static
+		public:
+			// Properties
+			static const int MAXIMUM_CHANNELS{ 4 };
+			static const int ALIGNMENT{ 64 }; // Bytes, of the planes and of the row stride
+
+		// Object
+		private:
+			// Properties
+			int width{ 0 };
+			int height{ 0 };
+			int channels{ 0 };
+			size_t stride{ 0 };					// Bytes from the start of one plane row to the next
+			unsigned char* allocation{ nullptr };	// As returned by malloc
+			unsigned char* data{ nullptr };		// First plane, aligned
+
+		public:
+			// Constructor / Destructor
+			ImagePlanar() = default;
+			ImagePlanar(int width, int height, int channels);
+			ImagePlanar(const ImagePlanar& other);
+			ImagePlanar(ImagePlanar&& other) noexcept;
+			~ImagePlanar();
+
+			// Operators | assignment
+			ImagePlanar& operator=(const ImagePlanar& other);
+			ImagePlanar& operator=(ImagePlanar&& other) noexcept;
+
+			// Getters
+			int getWidth() const;
+			int getHeight() const;
+			int getChannels() const;
+			size_t getStride() const;
+			unsigned char* getData() const;
+
+			// Functions | allocation / deallocation
+			unsigned char* allocate(int width, int height, int channels); // 1 to MAXIMUM_CHANNELS planes
+			bool isAllocated() const;
+			size_t dataSize() const; // Of every plane, padding included
+			size_t planeSize() const; // Padding included
+			void free();
+
+			// Functions | planes
+			unsigned char* plane(int channel) const; // nullptr past the last channel
+			unsigned char* row(int channel, int y) const;
+			// Shares the pixels of one plane, so every gray algorithm runs on a single channel as it is
+			ImageViewGray planeView(int channel) const;
+
+			// Functions | pixel manipulation
+			size_t pixelCount() const;
+			unsigned char sampleAt(int x, int y, int channel) const;
+			bool setSample(int x, int y, int channel, unsigned char value);
+	};
+
+	// Functions | conversions
+	// 16 pixels per step: SSSE3 byte shuffles for 3 and 4 channels (transposed through 32 and 64-bit unpacks for 4),
+	// SSE2 unpacks and packs for 2; rows in parallel.
+	// Splits the channels of source into destination, (re)allocated to its size and channel count
+	bool deinterleave(const ImageView& source, ImagePlanar& destination, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	// Merges the planes of source into destination, of the same size. Destination takes the first planes when it has
+	// fewer channels (RGBA planes to RGB) and an opaque alpha when it has one more (RGB planes to RGBA, gray to gray
+	// alpha).
+	bool interleave(const ImagePlanar& source, const ImageView& destination, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+}
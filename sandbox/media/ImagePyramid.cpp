@@ -0,0 +1,437 @@
+#include "ImagePyramid.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <numbers>
+#include <utility>
+
+// Dependencies | core
+#include <core/Parallel.h>
+
+namespace it {
+	namespace {
+		// Rows per parallel band
+		constexpr int BAND_ROWS{ 16 };
+
+		// Filter taps are offsets from 2 * x in the finer level
+		struct Taps {
+			int first{ 0 };
+			int count{ 0 };
+			std::array<float, 6> weights{};
+		};
+		double besselI0(double x) {
+			double sum{ 1.0 };
+			double term{ 1.0 };
+			for (int k = 1; k < 32; k++) {
+				term *= (x / (2.0 * k)) * (x / (2.0 * k));
+				sum += term;
+			}
+			return sum;
+		}
+		const Taps& tapsOf(PyramidFilter filter) {
+			static const Taps BOX{ 0, 2, { 0.5f, 0.5f } };
+			static const Taps KAISER = [] {
+				// sinc(t / 2) windowed by a Kaiser window (beta 4) of radius 3, sampled at the six nearest texel centers
+				constexpr double BETA{ 4.0 };
+				Taps taps{ -2, 6, {} };
+				double total{ 0.0 };
+				for (int k = 0; k < 6; k++) {
+					const double t = (k - 2) - 0.5;
+					const double x = std::numbers::pi * t / 2.0;
+					const double window = besselI0(BETA * std::sqrt(1.0 - (t / 3.0) * (t / 3.0))) / besselI0(BETA);
+					taps.weights[k] = static_cast<float>(std::sin(x) / x * window);
+					total += taps.weights[k];
+				}
+				for (float& weight : taps.weights)
+					weight = static_cast<float>(weight / total);
+				return taps;
+			}();
+			return filter == PyramidFilter::KAISER ? KAISER : BOX;
+		}
+
+		// sRGB transfer function: decode through a table, encode by searching the midpoints between decoded values,
+		// which makes encode(decode(v)) == v exact. The 16-bit tables (512 KiB) are only built once a 16-bit pyramid is.
+		template<typename Sample>
+		struct SrgbTables {
+			static constexpr size_t COUNT{ static_cast<size_t>(std::numeric_limits<Sample>::max()) + 1ULL };
+			std::vector<float> decode = std::vector<float>(COUNT);
+			std::vector<float> midpoints = std::vector<float>(COUNT - 1ULL);
+		};
+		template<typename Sample>
+		const SrgbTables<Sample>& srgbTables() {
+			static const SrgbTables<Sample> TABLES = [] {
+				constexpr double MAX{ std::numeric_limits<Sample>::max() };
+				SrgbTables<Sample> tables{};
+				for (size_t i = 0ULL; i < tables.decode.size(); i++) {
+					const double value = static_cast<double>(i) / MAX;
+					tables.decode[i] = static_cast<float>(value <= 0.04045 ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4));
+				}
+				for (size_t i = 0ULL; i < tables.midpoints.size(); i++)
+					tables.midpoints[i] = (tables.decode[i] + tables.decode[i + 1ULL]) * 0.5f;
+				return tables;
+			}();
+			return TABLES;
+		}
+		template<typename Sample>
+		inline Sample encodeLinear(float value, bool gammaCorrect) {
+			constexpr float MAX{ std::numeric_limits<Sample>::max() };
+			if (!gammaCorrect)
+				return static_cast<Sample>(std::clamp(value * MAX + 0.5f, 0.0f, MAX));
+			const std::vector<float>& midpoints = srgbTables<Sample>().midpoints;
+			return static_cast<Sample>(std::upper_bound(midpoints.begin(), midpoints.end(), value) - midpoints.begin());
+		}
+
+		// Produces row y of coarser over [xBegin, xEnd) from finer, both tightly packed
+		template<typename Sample>
+		void downsampleRow(const ImageView& finer, const ImageView& coarser, int y, int xBegin, int xEnd, const Taps& taps, bool gammaCorrect, std::vector<float>& scratch) {
+			constexpr float MAX{ std::numeric_limits<Sample>::max() };
+			const std::vector<float>& decode = srgbTables<Sample>().decode;
+			const int channels = finer.channels;
+			const bool hasAlpha = channels == 2 || channels == 4;
+			const int colorChannels = hasAlpha ? channels - 1 : channels;
+
+			// Vertical pass into linear (alpha weighted) floats over the finer columns this span reads
+			const int columnBegin = std::max(0, 2 * xBegin + taps.first);
+			const int columnEnd = std::min(finer.width, 2 * (xEnd - 1) + taps.first + taps.count);
+			const size_t columnCount = static_cast<size_t>(columnEnd - columnBegin);
+			scratch.assign(columnCount * static_cast<size_t>(channels), 0.0f);
+			for (int k = 0; k < taps.count; k++) {
+				const int row = std::clamp(2 * y + taps.first + k, 0, finer.height - 1);
+				const Sample* pixel = reinterpret_cast<const Sample*>(finer.row(row)) + static_cast<size_t>(columnBegin) * static_cast<size_t>(channels);
+				float* accumulator = scratch.data();
+				const float weight = taps.weights[k];
+				for (size_t column = 0ULL; column < columnCount; column++, pixel += channels, accumulator += channels) {
+					const float alpha = hasAlpha ? pixel[channels - 1] / MAX : 1.0f;
+					for (int channel = 0; channel < colorChannels; channel++)
+						accumulator[channel] += weight * alpha * (gammaCorrect ? decode[pixel[channel]] : pixel[channel] / MAX);
+					if (hasAlpha)
+						accumulator[channels - 1] += weight * alpha;
+				}
+			}
+
+			// Horizontal pass and encode
+			Sample* output = reinterpret_cast<Sample*>(coarser.row(y)) + static_cast<size_t>(xBegin) * static_cast<size_t>(channels);
+			for (int x = xBegin; x < xEnd; x++, output += channels) {
+				float sum[4]{};
+				for (int k = 0; k < taps.count; k++) {
+					const int column = std::clamp(2 * x + taps.first + k, 0, finer.width - 1) - columnBegin;
+					const float* accumulator = scratch.data() + static_cast<size_t>(column) * static_cast<size_t>(channels);
+					for (int channel = 0; channel < channels; channel++)
+						sum[channel] += taps.weights[k] * accumulator[channel];
+				}
+
+				const float alpha = hasAlpha ? std::clamp(sum[channels - 1], 0.0f, 1.0f) : 1.0f;
+				for (int channel = 0; channel < colorChannels; channel++)
+					output[channel] = alpha > 0.0f ? encodeLinear<Sample>(sum[channel] / alpha, gammaCorrect) : Sample{ 0 };
+				if (hasAlpha)
+					output[channels - 1] = static_cast<Sample>(alpha * MAX + 0.5f);
+			}
+		}
+	}
+
+	// class ImagePyramid
+
+	// Object | public
+
+	// Constructor / Destructor
+	ImagePyramid::ImagePyramid(const ImageGray& image, PyramidFilter filter, bool gammaCorrect) {
+		build(image, filter, gammaCorrect);
+	}
+	ImagePyramid::ImagePyramid(const ImageGrayAlpha& image, PyramidFilter filter, bool gammaCorrect) {
+		build(image, filter, gammaCorrect);
+	}
+	ImagePyramid::ImagePyramid(const ImageRGB& image, PyramidFilter filter, bool gammaCorrect) {
+		build(image, filter, gammaCorrect);
+	}
+	ImagePyramid::ImagePyramid(const ImageRGBA& image, PyramidFilter filter, bool gammaCorrect) {
+		build(image, filter, gammaCorrect);
+	}
+	ImagePyramid::ImagePyramid(const ImageGray16& image, PyramidFilter filter, bool gammaCorrect) {
+		build(image, filter, gammaCorrect);
+	}
+	ImagePyramid::ImagePyramid(const ImageGrayAlpha16& image, PyramidFilter filter, bool gammaCorrect) {
+		build(image, filter, gammaCorrect);
+	}
+	ImagePyramid::ImagePyramid(const ImageRGB16& image, PyramidFilter filter, bool gammaCorrect) {
+		build(image, filter, gammaCorrect);
+	}
+	ImagePyramid::ImagePyramid(const ImageRGBA16& image, PyramidFilter filter, bool gammaCorrect) {
+		build(image, filter, gammaCorrect);
+	}
+	ImagePyramid::ImagePyramid(const ImagePyramid& other) {
+		*this = other;
+	}
+	ImagePyramid::ImagePyramid(ImagePyramid&& other) noexcept {
+		*this = std::move(other);
+	}
+	ImagePyramid::~ImagePyramid() {
+		free();
+	}
+
+	// Operators | assignment
+	ImagePyramid& ImagePyramid::operator=(const ImagePyramid& other) {
+		if (this == &other)
+			return *this;
+
+		free();
+		if (other.data == nullptr)
+			return *this;
+
+		data = reinterpret_cast<unsigned char*>(std::malloc(other.size));
+		if (data == nullptr)
+			return *this;
+		std::memcpy(data, other.data, other.size);
+
+		channels = other.channels;
+		sampleSize = other.sampleSize;
+		filter = other.filter;
+		gammaCorrect = other.gammaCorrect;
+		size = other.size;
+		for (const ImageView& level : other.levels)
+			levels.emplace_back(data + (level.data - other.data), level.width, level.height, level.channels, level.stride);
+
+		return *this;
+	}
+	ImagePyramid& ImagePyramid::operator=(ImagePyramid&& other) noexcept {
+		if (this == &other)
+			return *this;
+
+		free();
+
+		channels = other.channels;
+		sampleSize = other.sampleSize;
+		filter = other.filter;
+		gammaCorrect = other.gammaCorrect;
+		data = other.data;
+		size = other.size;
+		levels = std::move(other.levels);
+
+		other.channels = 0;
+		other.sampleSize = 0;
+		other.data = nullptr;
+		other.size = 0ULL;
+		other.levels.clear();
+
+		return *this;
+	}
+
+	// Getters
+	int ImagePyramid::getLevelCount() const {
+		return static_cast<int>(levels.size());
+	}
+	int ImagePyramid::getChannels() const {
+		return channels;
+	}
+	int ImagePyramid::getSampleSize() const {
+		return sampleSize;
+	}
+	unsigned char* ImagePyramid::getData() const {
+		return data;
+	}
+	ImageView ImagePyramid::getLevel(int level) const {
+		assert(level >= 0 && level < static_cast<int>(levels.size()) && "level is out of range");
+		if (sampleSize != 1)
+			return ImageView(nullptr, 0, 0, 0);
+		return levels[static_cast<size_t>(level)];
+	}
+	template<IsImage Image>
+	bool ImagePyramid::borrowLevel(int level, Image& image) const {
+		using Pixel = std::remove_pointer_t<decltype(image.getData())>;
+		if (level < 0 || level >= static_cast<int>(levels.size()) || channels != Image::CHANNELS || static_cast<size_t>(sampleSize) * Image::CHANNELS != sizeof(Pixel))
+			return false;
+		const ImageView& view = levels[static_cast<size_t>(level)];
+		return image.wrap(reinterpret_cast<Pixel*>(view.data), view.width, view.height, PixelOwnership::BORROW);
+	}
+
+	// Functions | allocation / deallocation
+	bool ImagePyramid::isAllocated() const {
+		return data != nullptr;
+	}
+	size_t ImagePyramid::dataSize() const {
+		return size;
+	}
+	void ImagePyramid::free() {
+		channels = 0;
+		sampleSize = 0;
+		size = 0ULL;
+		levels.clear();
+		if (data != nullptr) {
+			std::free(data);
+			data = nullptr;
+		}
+	}
+
+	// Functions | building
+	bool ImagePyramid::build(const ImageGray& image, PyramidFilter filter, bool gammaCorrect) {
+		return build(image.getData(), image.getWidth(), image.getHeight(), ImageGray::CHANNELS, 1, filter, gammaCorrect);
+	}
+	bool ImagePyramid::build(const ImageGrayAlpha& image, PyramidFilter filter, bool gammaCorrect) {
+		return build(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageGrayAlpha::CHANNELS, 1, filter, gammaCorrect);
+	}
+	bool ImagePyramid::build(const ImageRGB& image, PyramidFilter filter, bool gammaCorrect) {
+		return build(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageRGB::CHANNELS, 1, filter, gammaCorrect);
+	}
+	bool ImagePyramid::build(const ImageRGBA& image, PyramidFilter filter, bool gammaCorrect) {
+		return build(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageRGBA::CHANNELS, 1, filter, gammaCorrect);
+	}
+	bool ImagePyramid::build(const ImageGray16& image, PyramidFilter filter, bool gammaCorrect) {
+		return build(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageGray16::CHANNELS, 2, filter, gammaCorrect);
+	}
+	bool ImagePyramid::build(const ImageGrayAlpha16& image, PyramidFilter filter, bool gammaCorrect) {
+		return build(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageGrayAlpha16::CHANNELS, 2, filter, gammaCorrect);
+	}
+	bool ImagePyramid::build(const ImageRGB16& image, PyramidFilter filter, bool gammaCorrect) {
+		return build(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageRGB16::CHANNELS, 2, filter, gammaCorrect);
+	}
+	bool ImagePyramid::build(const ImageRGBA16& image, PyramidFilter filter, bool gammaCorrect) {
+		return build(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageRGBA16::CHANNELS, 2, filter, gammaCorrect);
+	}
+
+	// Functions | incremental update
+	bool ImagePyramid::update(const ImageGray& image, const ui::Rect& dirtyRect) {
+		return update(image.getData(), image.getWidth(), image.getHeight(), ImageGray::CHANNELS, 1, dirtyRect);
+	}
+	bool ImagePyramid::update(const ImageGrayAlpha& image, const ui::Rect& dirtyRect) {
+		return update(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageGrayAlpha::CHANNELS, 1, dirtyRect);
+	}
+	bool ImagePyramid::update(const ImageRGB& image, const ui::Rect& dirtyRect) {
+		return update(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageRGB::CHANNELS, 1, dirtyRect);
+	}
+	bool ImagePyramid::update(const ImageRGBA& image, const ui::Rect& dirtyRect) {
+		return update(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageRGBA::CHANNELS, 1, dirtyRect);
+	}
+	bool ImagePyramid::update(const ImageGray16& image, const ui::Rect& dirtyRect) {
+		return update(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageGray16::CHANNELS, 2, dirtyRect);
+	}
+	bool ImagePyramid::update(const ImageGrayAlpha16& image, const ui::Rect& dirtyRect) {
+		return update(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageGrayAlpha16::CHANNELS, 2, dirtyRect);
+	}
+	bool ImagePyramid::update(const ImageRGB16& image, const ui::Rect& dirtyRect) {
+		return update(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageRGB16::CHANNELS, 2, dirtyRect);
+	}
+	bool ImagePyramid::update(const ImageRGBA16& image, const ui::Rect& dirtyRect) {
+		return update(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageRGBA16::CHANNELS, 2, dirtyRect);
+	}
+
+	// Object | private
+
+	// Functions
+	bool ImagePyramid::build(const unsigned char* pixels, int width, int height, int channels, int sampleSize, PyramidFilter filter, bool gammaCorrect) {
+		// Error check
+		if (pixels == nullptr || width <= 0 || height <= 0 || channels < 1 || channels > 4 || (sampleSize != 1 && sampleSize != 2))
+			return false;
+
+		// Release existing data
+		free();
+
+		// Lay out every level in one allocation
+		std::vector<glm::ivec2> sizes{ { width, height } };
+		while (sizes.back().x > 1 || sizes.back().y > 1)
+			sizes.push_back({ std::max(1, sizes.back().x / 2), std::max(1, sizes.back().y / 2) });
+
+		const size_t pixelSize = static_cast<size_t>(channels) * static_cast<size_t>(sampleSize);
+		size_t totalSize{ 0ULL };
+		for (const glm::ivec2& levelSize : sizes)
+			totalSize += static_cast<size_t>(levelSize.x) * static_cast<size_t>(levelSize.y) * pixelSize;
+
+		data = reinterpret_cast<unsigned char*>(std::malloc(totalSize));
+		if (data == nullptr)
+			return false;
+
+		this->channels = channels;
+		this->sampleSize = sampleSize;
+		this->filter = filter;
+		this->gammaCorrect = gammaCorrect;
+		size = totalSize;
+		unsigned char* levelData = data;
+		for (const glm::ivec2& levelSize : sizes) {
+			levels.emplace_back(levelData, levelSize.x, levelSize.y, channels, static_cast<size_t>(levelSize.x) * pixelSize);
+			levelData += static_cast<size_t>(levelSize.x) * static_cast<size_t>(levelSize.y) * pixelSize;
+		}
+
+		// Level 0, then every coarser level from the complete finer one
+		const size_t rowSize = levels[0].stride;
+		parallelForBands(0, height, [&](int rowBegin, int rowEnd) {
+			const size_t offset = static_cast<size_t>(rowBegin) * rowSize;
+			std::memcpy(levels[0].data + offset, pixels + offset, static_cast<size_t>(rowEnd - rowBegin) * rowSize);
+		}, BAND_ROWS);
+		for (size_t level = 1ULL; level < levels.size(); level++)
+			downsampleRows(static_cast<int>(level), 0, levels[level].height, 0, levels[level].width);
+
+		return true;
+	}
+	bool ImagePyramid::update(const unsigned char* pixels, int width, int height, int channels, int sampleSize, const ui::Rect& dirtyRect) {
+		// Error check
+		if (pixels == nullptr || levels.empty() || width != levels[0].width || height != levels[0].height || channels != this->channels || sampleSize != this->sampleSize)
+			return false;
+
+		ui::Rect dirty = dirtyRect.normalized().intersected({ { 0, 0 }, { width, height } });
+		if (!dirty.isValid())
+			return true; // Nothing to update
+
+		// Level 0
+		const size_t pixelSize = static_cast<size_t>(channels) * static_cast<size_t>(sampleSize);
+		const size_t rowSize = levels[0].stride;
+		const size_t dirtyOffset = static_cast<size_t>(dirty.left()) * pixelSize;
+		const size_t dirtySize = static_cast<size_t>(dirty.width()) * pixelSize;
+		parallelForBands(dirty.top(), dirty.bottom(), [&](int rowBegin, int rowEnd) {
+			for (int y = rowBegin; y < rowEnd; y++)
+				std::memcpy(levels[0].data + static_cast<size_t>(y) * rowSize + dirtyOffset, pixels + static_cast<size_t>(y) * rowSize + dirtyOffset, dirtySize);
+		}, BAND_ROWS);
+
+		// Coarser levels: output texel x reads finer texels 2x + first .. 2x + last
+		const Taps& taps = tapsOf(filter);
+		const int firstTap = taps.first;
+		const int lastTap = taps.first + taps.count - 1;
+		auto ceilHalf = [](int value) { return value >= 0 ? (value + 1) / 2 : -((-value) / 2); };
+		auto floorHalf = [](int value) { return value >= 0 ? value / 2 : -((-value + 1) / 2); };
+		for (size_t level = 1ULL; level < levels.size(); level++) {
+			const ImageView& coarser = levels[level];
+			const int left = std::max(0, ceilHalf(dirty.left() - lastTap));
+			const int top = std::max(0, ceilHalf(dirty.top() - lastTap));
+			const int right = std::min(coarser.width, floorHalf(dirty.right() - 1 - firstTap) + 1);
+			const int bottom = std::min(coarser.height, floorHalf(dirty.bottom() - 1 - firstTap) + 1);
+			dirty = { { left, top }, { right - left, bottom - top } };
+			if (!dirty.isValid())
+				break;
+
+			downsampleRows(static_cast<int>(level), top, bottom, left, right);
+		}
+
+		return true;
+	}
+	void ImagePyramid::downsampleRows(int level, int rowBegin, int rowEnd, int xBegin, int xEnd) const {
+		const ImageView& finer = levels[static_cast<size_t>(level) - 1ULL];
+		const ImageView& coarser = levels[static_cast<size_t>(level)];
+		const Taps& taps = tapsOf(filter);
+		parallelForBands(rowBegin, rowEnd, [&](int bandBegin, int bandEnd) {
+			std::vector<float> scratch{};
+			for (int y = bandBegin; y < bandEnd; y++) {
+				if (sampleSize == 2)
+					downsampleRow<unsigned short>(finer, coarser, y, xBegin, xEnd, taps, gammaCorrect, scratch);
+				else
+					downsampleRow<unsigned char>(finer, coarser, y, xBegin, xEnd, taps, gammaCorrect, scratch);
+			}
+		}, BAND_ROWS);
+	}
+
+#define IT_IMAGEPYRAMID_INSTANTIATE(Image) \
+	template bool ImagePyramid::borrowLevel<Image>(int, Image&) const;
+
+	IT_IMAGEPYRAMID_INSTANTIATE(ImageGray)
+	IT_IMAGEPYRAMID_INSTANTIATE(ImageGrayAlpha)
+	IT_IMAGEPYRAMID_INSTANTIATE(ImageRGB)
+	IT_IMAGEPYRAMID_INSTANTIATE(ImageRGBA)
+	IT_IMAGEPYRAMID_INSTANTIATE(ImageGray16)
+	IT_IMAGEPYRAMID_INSTANTIATE(ImageGrayAlpha16)
+	IT_IMAGEPYRAMID_INSTANTIATE(ImageRGB16)
+	IT_IMAGEPYRAMID_INSTANTIATE(ImageRGBA16)
+
+#undef IT_IMAGEPYRAMID_INSTANTIATE
+}
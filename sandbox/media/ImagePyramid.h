@@ -0,0 +1,94 @@
+#pragma once
+
+// Dependencies | std
+#include <vector>
+
+// Dependencies | core
+#include <core/Rect.h>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Enums
+	enum class PyramidFilter {
+		BOX,	// 2x2 average
+		KAISER	// 6x6 Kaiser windowed sinc, sharper minification at a higher cost
+	};
+
+	// Classes
+	// Mip chain down to 1x1 over 8 or 16-bit samples. Level 0 is a copy of the source and every level lives in one
+	// contiguous allocation. Levels are built one after another, the rows of each one in parallel bands.
+	class ImagePyramid {
+		// Object
+		private:
+			// Properties
+			int channels{ 0 };
+			int sampleSize{ 0 };
+			PyramidFilter filter{ PyramidFilter::BOX };
+			bool gammaCorrect{ true };
+			unsigned char* data{ nullptr };
+			size_t size{ 0 };
+			std::vector<ImageView> levels{}; // Byte strides, so 16-bit levels are only exposed through borrowLevel
+
+		public:
+			// Constructor / Destructor
+			ImagePyramid() = default;
+			ImagePyramid(const ImageGray& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			ImagePyramid(const ImageGrayAlpha& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			ImagePyramid(const ImageRGB& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			ImagePyramid(const ImageRGBA& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			ImagePyramid(const ImageGray16& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			ImagePyramid(const ImageGrayAlpha16& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			ImagePyramid(const ImageRGB16& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			ImagePyramid(const ImageRGBA16& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			ImagePyramid(const ImagePyramid& other);
+			ImagePyramid(ImagePyramid&& other) noexcept;
+			~ImagePyramid();
+
+			// Operators | assignment
+			ImagePyramid& operator=(const ImagePyramid& other);
+			ImagePyramid& operator=(ImagePyramid&& other) noexcept;
+
+			// Getters
+			int getLevelCount() const;
+			int getChannels() const;
+			int getSampleSize() const; // Bytes, 1 or 2
+			unsigned char* getData() const;
+			ImageView getLevel(int level) const; // 8-bit samples only, empty otherwise
+			// Borrows a level into the image class matching the channel count and sample size (see PixelOwnership)
+			template<IsImage Image>
+			bool borrowLevel(int level, Image& image) const;
+
+			// Functions | allocation / deallocation
+			bool isAllocated() const;
+			size_t dataSize() const;
+			void free();
+
+			// Functions | building
+			bool build(const ImageGray& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			bool build(const ImageGrayAlpha& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			bool build(const ImageRGB& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			bool build(const ImageRGBA& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			bool build(const ImageGray16& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			bool build(const ImageGrayAlpha16& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			bool build(const ImageRGB16& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+			bool build(const ImageRGBA16& image, PyramidFilter filter = PyramidFilter::BOX, bool gammaCorrect = true);
+
+			// Functions | incremental update (image must match the built size and format; only dirtyRect is re-read)
+			bool update(const ImageGray& image, const ui::Rect& dirtyRect);
+			bool update(const ImageGrayAlpha& image, const ui::Rect& dirtyRect);
+			bool update(const ImageRGB& image, const ui::Rect& dirtyRect);
+			bool update(const ImageRGBA& image, const ui::Rect& dirtyRect);
+			bool update(const ImageGray16& image, const ui::Rect& dirtyRect);
+			bool update(const ImageGrayAlpha16& image, const ui::Rect& dirtyRect);
+			bool update(const ImageRGB16& image, const ui::Rect& dirtyRect);
+			bool update(const ImageRGBA16& image, const ui::Rect& dirtyRect);
+
+		private:
+			// Functions
+			bool build(const unsigned char* pixels, int width, int height, int channels, int sampleSize, PyramidFilter filter, bool gammaCorrect);
+			bool update(const unsigned char* pixels, int width, int height, int channels, int sampleSize, const ui::Rect& dirtyRect);
+			void downsampleRows(int level, int rowBegin, int rowEnd, int xBegin, int xEnd) const; // In parallel bands
+	};
+}
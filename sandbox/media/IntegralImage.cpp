@@ -0,0 +1,310 @@
+#include "IntegralImage.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+// Dependencies | core
+#include <core/Simd.h>
+
+namespace it {
+	namespace {
+		// Largest pixel count whose 8-bit sum fits in 32 bits
+		constexpr unsigned long long U32_PIXEL_LIMIT{ std::numeric_limits<unsigned int>::max() / 255ULL };
+
+		size_t entryCount(int width, int height, int channels) {
+			return static_cast<size_t>(width + 1) * static_cast<size_t>(height + 1) * static_cast<size_t>(channels);
+		}
+		size_t sumSize(IntegralAccumulator accumulator) {
+			return accumulator == IntegralAccumulator::U64 ? sizeof(unsigned long long) : sizeof(unsigned int);
+		}
+
+		// Single channel 32-bit rows: prefix sums of 16 pixels at a time in registers (log-step shifted adds), carried
+		// across blocks through the last lane, then added to the row above
+		void buildGrayRow(const unsigned char* source, const unsigned int* above, unsigned int* output, int width) {
+			int x = 0;
+			unsigned int running{ 0U };
+#if defined(IT_SIMD_SSE2)
+			const __m128i ZERO = _mm_setzero_si128();
+			__m128i carry = ZERO;
+			for (; x + 16 <= width; x += 16) {
+				const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + x));
+				const __m128i words[2]{ _mm_unpacklo_epi8(bytes, ZERO), _mm_unpackhi_epi8(bytes, ZERO) };
+				for (int quarter = 0; quarter < 4; quarter++) {
+					const __m128i& word = words[quarter / 2];
+					__m128i sums = quarter % 2 == 0 ? _mm_unpacklo_epi16(word, ZERO) : _mm_unpackhi_epi16(word, ZERO);
+					sums = _mm_add_epi32(sums, _mm_slli_si128(sums, 4));
+					sums = _mm_add_epi32(sums, _mm_slli_si128(sums, 8));
+					sums = _mm_add_epi32(sums, carry);
+					carry = _mm_shuffle_epi32(sums, _MM_SHUFFLE(3, 3, 3, 3));
+
+					const int offset = x + quarter * 4;
+					const __m128i previous = _mm_loadu_si128(reinterpret_cast<const __m128i*>(above + offset));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(output + offset), _mm_add_epi32(sums, previous));
+				}
+			}
+			running = static_cast<unsigned int>(_mm_cvtsi128_si32(carry));
+#endif
+			for (; x < width; x++) {
+				running += source[x];
+				output[x] = running + above[x];
+			}
+		}
+
+		// Any channel count / accumulator: one running sum per channel
+		template<typename T, bool SQUARED>
+		void buildRow(const unsigned char* source, const T* above, T* output, int width, int channels) {
+			T running[4]{};
+			for (int x = 0; x < width; x++) {
+				for (int channel = 0; channel < channels; channel++, source++, output++, above++) {
+					const T value = static_cast<T>(*source);
+					running[channel] += SQUARED ? value * value : value;
+					*output = running[channel] + *above;
+				}
+			}
+		}
+
+		template<typename T>
+		void buildTable(const unsigned char* pixels, int width, int height, int channels, T* table) {
+			const size_t stride = static_cast<size_t>(width + 1) * static_cast<size_t>(channels);
+			std::memset(table, 0, stride * sizeof(T));
+			for (int y = 0; y < height; y++) {
+				const unsigned char* source = pixels + static_cast<size_t>(y) * static_cast<size_t>(width) * static_cast<size_t>(channels);
+				T* row = table + static_cast<size_t>(y + 1) * stride;
+				std::memset(row, 0, static_cast<size_t>(channels) * sizeof(T));
+
+				if constexpr (sizeof(T) == sizeof(unsigned int)) {
+					if (channels == 1) {
+						buildGrayRow(source, row - stride + 1, row + 1, width);
+						continue;
+					}
+				}
+				buildRow<T, false>(source, row - stride + channels, row + channels, width, channels);
+			}
+		}
+		void buildSquareTable(const unsigned char* pixels, int width, int height, int channels, unsigned long long* table) {
+			const size_t stride = static_cast<size_t>(width + 1) * static_cast<size_t>(channels);
+			std::memset(table, 0, stride * sizeof(unsigned long long));
+			for (int y = 0; y < height; y++) {
+				const unsigned char* source = pixels + static_cast<size_t>(y) * static_cast<size_t>(width) * static_cast<size_t>(channels);
+				unsigned long long* row = table + static_cast<size_t>(y + 1) * stride;
+				std::memset(row, 0, static_cast<size_t>(channels) * sizeof(unsigned long long));
+				buildRow<unsigned long long, true>(source, row - stride + channels, row + channels, width, channels);
+			}
+		}
+
+		// Four corner lookup; unsigned wrap around cancels out as long as the true sum fits in T
+		template<typename T>
+		unsigned long long rectSum(const T* table, int width, int channels, const ui::Rect& rect, int channel) {
+			const size_t stride = static_cast<size_t>(width + 1) * static_cast<size_t>(channels);
+			const T* top = table + static_cast<size_t>(rect.top()) * stride;
+			const T* bottom = table + static_cast<size_t>(rect.bottom()) * stride;
+			const size_t left = static_cast<size_t>(rect.left()) * static_cast<size_t>(channels) + static_cast<size_t>(channel);
+			const size_t right = static_cast<size_t>(rect.right()) * static_cast<size_t>(channels) + static_cast<size_t>(channel);
+			return static_cast<unsigned long long>(static_cast<T>(bottom[right] - bottom[left] - top[right] + top[left]));
+		}
+	}
+
+	// class IntegralImage
+
+	// Object | public
+
+	// Constructor / Destructor
+	IntegralImage::IntegralImage(const ImageGray& image, bool withSquares, IntegralAccumulator accumulator) {
+		build(image, withSquares, accumulator);
+	}
+	IntegralImage::IntegralImage(const ImageRGB& image, bool withSquares, IntegralAccumulator accumulator) {
+		build(image, withSquares, accumulator);
+	}
+	IntegralImage::IntegralImage(const IntegralImage& other) {
+		*this = other;
+	}
+	IntegralImage::IntegralImage(IntegralImage&& other) noexcept {
+		*this = std::move(other);
+	}
+	IntegralImage::~IntegralImage() {
+		free();
+	}
+
+	// Operators | assignment
+	IntegralImage& IntegralImage::operator=(const IntegralImage& other) {
+		if (this == &other)
+			return *this;
+
+		free();
+		if (other.data == nullptr)
+			return *this;
+
+		data = reinterpret_cast<unsigned char*>(std::malloc(other.size));
+		if (data == nullptr)
+			return *this;
+		std::memcpy(data, other.data, other.size);
+
+		width = other.width;
+		height = other.height;
+		channels = other.channels;
+		accumulator = other.accumulator;
+		squares = other.squares;
+		size = other.size;
+
+		return *this;
+	}
+	IntegralImage& IntegralImage::operator=(IntegralImage&& other) noexcept {
+		if (this == &other)
+			return *this;
+
+		free();
+
+		width = other.width;
+		height = other.height;
+		channels = other.channels;
+		accumulator = other.accumulator;
+		squares = other.squares;
+		data = other.data;
+		size = other.size;
+
+		other.width = 0;
+		other.height = 0;
+		other.channels = 0;
+		other.squares = false;
+		other.data = nullptr;
+		other.size = 0ULL;
+
+		return *this;
+	}
+
+	// Getters
+	int IntegralImage::getWidth() const {
+		return width;
+	}
+	int IntegralImage::getHeight() const {
+		return height;
+	}
+	int IntegralImage::getChannels() const {
+		return channels;
+	}
+	IntegralAccumulator IntegralImage::getAccumulator() const {
+		return accumulator;
+	}
+	bool IntegralImage::hasSquares() const {
+		return squares;
+	}
+
+	// Functions | allocation / deallocation
+	bool IntegralImage::isAllocated() const {
+		return data != nullptr;
+	}
+	size_t IntegralImage::dataSize() const {
+		return size;
+	}
+	void IntegralImage::free() {
+		width = 0;
+		height = 0;
+		channels = 0;
+		squares = false;
+		size = 0ULL;
+		if (data != nullptr) {
+			std::free(data);
+			data = nullptr;
+		}
+	}
+
+	// Functions | building
+	bool IntegralImage::build(const ImageGray& image, bool withSquares, IntegralAccumulator accumulator) {
+		return build(image.getData(), image.getWidth(), image.getHeight(), ImageGray::CHANNELS, withSquares, accumulator);
+	}
+	bool IntegralImage::build(const ImageRGB& image, bool withSquares, IntegralAccumulator accumulator) {
+		return build(reinterpret_cast<const unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), ImageRGB::CHANNELS, withSquares, accumulator);
+	}
+
+	// Functions | queries
+	unsigned long long IntegralImage::sum(const ui::Rect& rect, int channel) const {
+		ui::Rect clipped{};
+		if (!clip(rect, channel, clipped))
+			return 0ULL;
+
+		if (accumulator == IntegralAccumulator::U64)
+			return rectSum(reinterpret_cast<const unsigned long long*>(sumData()), width, channels, clipped, channel);
+		return rectSum(reinterpret_cast<const unsigned int*>(sumData()), width, channels, clipped, channel);
+	}
+	unsigned long long IntegralImage::squaredSum(const ui::Rect& rect, int channel) const {
+		assert(squares && "squared sums were not built");
+
+		ui::Rect clipped{};
+		if (!squares || !clip(rect, channel, clipped))
+			return 0ULL;
+		return rectSum(squareData(), width, channels, clipped, channel);
+	}
+	double IntegralImage::mean(const ui::Rect& rect, int channel) const {
+		ui::Rect clipped{};
+		if (!clip(rect, channel, clipped))
+			return 0.0;
+		return static_cast<double>(sum(clipped, channel)) / (static_cast<double>(clipped.width()) * static_cast<double>(clipped.height()));
+	}
+	double IntegralImage::variance(const ui::Rect& rect, int channel) const {
+		assert(squares && "squared sums were not built");
+
+		ui::Rect clipped{};
+		if (!squares || !clip(rect, channel, clipped))
+			return 0.0;
+		const double count = static_cast<double>(clipped.width()) * static_cast<double>(clipped.height());
+		const double average = static_cast<double>(sum(clipped, channel)) / count;
+		return std::max(0.0, static_cast<double>(squaredSum(clipped, channel)) / count - average * average);
+	}
+
+	// Object | private
+
+	// Functions
+	bool IntegralImage::build(const unsigned char* pixels, int width, int height, int channels, bool withSquares, IntegralAccumulator accumulator) {
+		// Error check
+		if (pixels == nullptr || width <= 0 || height <= 0 || channels < 1 || channels > 4)
+			return false;
+
+		if (accumulator == IntegralAccumulator::AUTO)
+			accumulator = static_cast<unsigned long long>(width) * static_cast<unsigned long long>(height) > U32_PIXEL_LIMIT ? IntegralAccumulator::U64 : IntegralAccumulator::U32;
+
+		// Squared sums first so both tables stay 8-byte aligned
+		const size_t entries = entryCount(width, height, channels);
+		const size_t newSize = (withSquares ? entries * sizeof(unsigned long long) : 0ULL) + entries * sumSize(accumulator);
+		if (newSize != size) {
+			free();
+			data = reinterpret_cast<unsigned char*>(std::malloc(newSize));
+			if (data == nullptr)
+				return false;
+		}
+
+		this->width = width;
+		this->height = height;
+		this->channels = channels;
+		this->accumulator = accumulator;
+		squares = withSquares;
+		size = newSize;
+
+		if (accumulator == IntegralAccumulator::U64)
+			buildTable(pixels, width, height, channels, reinterpret_cast<unsigned long long*>(sumData()));
+		else
+			buildTable(pixels, width, height, channels, reinterpret_cast<unsigned int*>(sumData()));
+		if (squares)
+			buildSquareTable(pixels, width, height, channels, squareData());
+
+		return true;
+	}
+	bool IntegralImage::clip(const ui::Rect& rect, int channel, ui::Rect& clipped) const {
+		assert(channel >= 0 && channel < channels && "channel is out of range");
+
+		if (data == nullptr || channel < 0 || channel >= channels)
+			return false;
+		clipped = rect.normalized().intersected({ { 0, 0 }, { width, height } });
+		return clipped.isValid();
+	}
+	unsigned long long* IntegralImage::squareData() const {
+		return squares ? reinterpret_cast<unsigned long long*>(data) : nullptr;
+	}
+	void* IntegralImage::sumData() const {
+		return data + (squares ? entryCount(width, height, channels) * sizeof(unsigned long long) : 0ULL);
+	}
+}
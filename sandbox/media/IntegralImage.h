@@ -0,0 +1,76 @@
+#pragma once
+
+// Dependencies | core
+#include <core/Rect.h>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Enums
+	enum class IntegralAccumulator {
+		AUTO,	// U32 unless the image has more than 16843009 (UINT32_MAX / 255) pixels
+		U32,
+		U64
+	};
+
+	// Classes
+	// Summed-area table of an 8-bit image: every entry holds the per channel sum of all pixels above and to the left of
+	// it, so the sum over any rectangle takes four lookups. The table has one extra row and column of zeros so queries
+	// need no edge cases. U32 sums wrap around for large images but rectangle sums stay exact as long as the rectangle
+	// itself has at most 16843009 pixels. Squared sums (for variance) are always 64-bit.
+	class IntegralImage {
+		// Object
+		private:
+			// Properties
+			int width{ 0 };
+			int height{ 0 };
+			int channels{ 0 };
+			IntegralAccumulator accumulator{ IntegralAccumulator::U32 };
+			bool squares{ false };
+			unsigned char* data{ nullptr };
+			size_t size{ 0 };
+
+		public:
+			// Constructor / Destructor
+			IntegralImage() = default;
+			IntegralImage(const ImageGray& image, bool withSquares = false, IntegralAccumulator accumulator = IntegralAccumulator::AUTO);
+			IntegralImage(const ImageRGB& image, bool withSquares = false, IntegralAccumulator accumulator = IntegralAccumulator::AUTO);
+			IntegralImage(const IntegralImage& other);
+			IntegralImage(IntegralImage&& other) noexcept;
+			~IntegralImage();
+
+			// Operators | assignment
+			IntegralImage& operator=(const IntegralImage& other);
+			IntegralImage& operator=(IntegralImage&& other) noexcept;
+
+			// Getters
+			int getWidth() const;
+			int getHeight() const;
+			int getChannels() const;
+			IntegralAccumulator getAccumulator() const;
+			bool hasSquares() const;
+
+			// Functions | allocation / deallocation
+			bool isAllocated() const;
+			size_t dataSize() const;
+			void free();
+
+			// Functions | building
+			bool build(const ImageGray& image, bool withSquares = false, IntegralAccumulator accumulator = IntegralAccumulator::AUTO);
+			bool build(const ImageRGB& image, bool withSquares = false, IntegralAccumulator accumulator = IntegralAccumulator::AUTO);
+
+			// Functions | queries (rect is clipped to the image; an empty rect sums to 0)
+			unsigned long long sum(const ui::Rect& rect, int channel = 0) const;
+			unsigned long long squaredSum(const ui::Rect& rect, int channel = 0) const;
+			double mean(const ui::Rect& rect, int channel = 0) const;
+			double variance(const ui::Rect& rect, int channel = 0) const;
+
+		private:
+			// Functions
+			bool build(const unsigned char* pixels, int width, int height, int channels, bool withSquares, IntegralAccumulator accumulator);
+			bool clip(const ui::Rect& rect, int channel, ui::Rect& clipped) const;
+			unsigned long long* squareData() const;
+			void* sumData() const;
+	};
+}
@@ -0,0 +1,426 @@
+#include "Lut.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <cmath>
+
+// Dependencies | core
+#include <core/Parallel.h>
+#include <core/Simd.h>
+
+namespace it {
+	namespace {
+		// Rows per parallel band
+		constexpr int BAND_ROWS{ 32 };
+
+		unsigned char toLevel(double value) {
+			return static_cast<unsigned char>(std::clamp(std::lround(value), 0L, 255L));
+		}
+
+		// Distinct non-identity tables of an application and the table each channel reads (-1 leaves it untouched)
+		struct Plan {
+			int channels{ 0 };
+			int tableCount{ 0 };
+			std::array<const Lut*, 4> tables{};
+			std::array<int, 4> tableOfChannel{ -1, -1, -1, -1 };
+			bool uniform{ false }; // One table for every channel, no blending needed
+		};
+
+		// Byte shuffle lookups. Every instruction set provides a Table (the 256 entries held in registers), lookup,
+		// a lane Mask built from 0x00 / 0xFF bytes and blend (b where the mask is set, a elsewhere).
+#if defined(IT_SIMD_AVX512VBMI)
+		struct Avx512Vbmi {
+			using Vector = __m512i;
+			using Mask = __mmask64;
+			static constexpr size_t BYTES{ 64 };
+			struct Table {
+				__m512i quarters[4];
+			};
+
+			static Table load(const Lut& lut) {
+				Table table{};
+				for (int quarter = 0; quarter < 4; quarter++)
+					table.quarters[quarter] = _mm512_loadu_si512(lut.table.data() + quarter * 64);
+				return table;
+			}
+			static Mask mask(const unsigned char* lanes) {
+				return _mm512_movepi8_mask(_mm512_loadu_si512(lanes));
+			}
+			static Vector load(const unsigned char* samples) {
+				return _mm512_loadu_si512(samples);
+			}
+			static void store(unsigned char* samples, Vector vector) {
+				_mm512_storeu_si512(samples, vector);
+			}
+			// vpermi2b indexes 128 bytes with the low seven bits; bit seven picks the upper half of the table
+			static Vector lookup(const Table& table, Vector levels) {
+				const __m512i lower = _mm512_permutex2var_epi8(table.quarters[0], levels, table.quarters[1]);
+				const __m512i upper = _mm512_permutex2var_epi8(table.quarters[2], levels, table.quarters[3]);
+				return _mm512_mask_blend_epi8(_mm512_movepi8_mask(levels), lower, upper);
+			}
+			static Vector blend(Vector a, Vector b, Mask mask) {
+				return _mm512_mask_blend_epi8(mask, a, b);
+			}
+		};
+#endif
+#if defined(IT_SIMD_AVX2)
+		struct Avx2 {
+			using Vector = __m256i;
+			using Mask = __m256i;
+			static constexpr size_t BYTES{ 32 };
+			struct Table {
+				__m256i chunks[16];
+			};
+
+			static Table load(const Lut& lut) {
+				Table table{};
+				for (int chunk = 0; chunk < 16; chunk++)
+					table.chunks[chunk] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.table.data() + chunk * 16)));
+				return table;
+			}
+			static Mask mask(const unsigned char* lanes) {
+				return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes));
+			}
+			static Vector load(const unsigned char* samples) {
+				return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(samples));
+			}
+			static void store(unsigned char* samples, Vector vector) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(samples), vector);
+			}
+			// Chunk k answers the levels whose high nibble is k: xor clears that nibble, the saturating add pushes every
+			// other level past 0x80 where pshufb returns zero
+			static Vector lookup(const Table& table, Vector levels) {
+				const __m256i OFFSET = _mm256_set1_epi8(0x70);
+				__m256i result = _mm256_setzero_si256();
+				for (int chunk = 0; chunk < 16; chunk++) {
+					const __m256i indices = _mm256_adds_epu8(_mm256_xor_si256(levels, _mm256_set1_epi8(static_cast<char>(chunk << 4))), OFFSET);
+					result = _mm256_or_si256(result, _mm256_shuffle_epi8(table.chunks[chunk], indices));
+				}
+				return result;
+			}
+			static Vector blend(Vector a, Vector b, Mask mask) {
+				return _mm256_blendv_epi8(a, b, mask);
+			}
+		};
+#endif
+#if defined(IT_SIMD_SSSE3)
+		struct Ssse3 {
+			using Vector = __m128i;
+			using Mask = __m128i;
+			static constexpr size_t BYTES{ 16 };
+			struct Table {
+				__m128i chunks[16];
+			};
+
+			static Table load(const Lut& lut) {
+				Table table{};
+				for (int chunk = 0; chunk < 16; chunk++)
+					table.chunks[chunk] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.table.data() + chunk * 16));
+				return table;
+			}
+			static Mask mask(const unsigned char* lanes) {
+				return _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes));
+			}
+			static Vector load(const unsigned char* samples) {
+				return _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples));
+			}
+			static void store(unsigned char* samples, Vector vector) {
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(samples), vector);
+			}
+			// Same nibble split as the AVX2 lookup
+			static Vector lookup(const Table& table, Vector levels) {
+				const __m128i OFFSET = _mm_set1_epi8(0x70);
+				__m128i result = _mm_setzero_si128();
+				for (int chunk = 0; chunk < 16; chunk++) {
+					const __m128i indices = _mm_adds_epu8(_mm_xor_si128(levels, _mm_set1_epi8(static_cast<char>(chunk << 4))), OFFSET);
+					result = _mm_or_si128(result, _mm_shuffle_epi8(table.chunks[chunk], indices));
+				}
+				return result;
+			}
+			static Vector blend(Vector a, Vector b, Mask mask) {
+				return _mm_or_si128(_mm_andnot_si128(mask, a), _mm_and_si128(mask, b));
+			}
+		};
+#endif
+#if defined(IT_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+		struct Neon {
+			using Vector = uint8x16_t;
+			using Mask = uint8x16_t;
+			static constexpr size_t BYTES{ 16 };
+			struct Table {
+				uint8x16x4_t quarters[4];
+			};
+
+			static Table load(const Lut& lut) {
+				Table table{};
+				for (int quarter = 0; quarter < 4; quarter++)
+					table.quarters[quarter] = vld1q_u8_x4(lut.table.data() + quarter * 64);
+				return table;
+			}
+			static Mask mask(const unsigned char* lanes) {
+				return vld1q_u8(lanes);
+			}
+			static Vector load(const unsigned char* samples) {
+				return vld1q_u8(samples);
+			}
+			static void store(unsigned char* samples, Vector vector) {
+				vst1q_u8(samples, vector);
+			}
+			// tbl answers indices below 64 and zeroes the rest; tbx keeps the previous result for out of range indices
+			static Vector lookup(const Table& table, Vector levels) {
+				uint8x16_t result = vqtbl4q_u8(table.quarters[0], levels);
+				result = vqtbx4q_u8(result, table.quarters[1], vsubq_u8(levels, vdupq_n_u8(64)));
+				result = vqtbx4q_u8(result, table.quarters[2], vsubq_u8(levels, vdupq_n_u8(128)));
+				return vqtbx4q_u8(result, table.quarters[3], vsubq_u8(levels, vdupq_n_u8(192)));
+			}
+			static Vector blend(Vector a, Vector b, Mask mask) {
+				return vbslq_u8(mask, b, a);
+			}
+		};
+#endif
+
+		// Applies the plan to whole vectors of a row and returns how many samples were done. Rows start on a pixel, so
+		// the channel of every lane repeats with the vector (after three vectors for three channels).
+		template<typename Isa>
+		class VectorKernel {
+			// Object
+			private:
+				// Properties
+				const Plan& plan;
+				int phases{ 1 };
+				typename Isa::Table tables[4]{};
+				typename Isa::Mask masks[3][4]{};
+
+			public:
+				// Constructor
+				VectorKernel(const Plan& plan) : plan(plan) {
+					phases = plan.channels == 3 ? 3 : 1;
+					for (int table = 0; table < plan.tableCount; table++)
+						tables[table] = Isa::load(*plan.tables[table]);
+
+					unsigned char lanes[Isa::BYTES];
+					for (int phase = 0; phase < phases; phase++) {
+						for (int table = 0; table < plan.tableCount; table++) {
+							for (size_t lane = 0ULL; lane < Isa::BYTES; lane++)
+								lanes[lane] = plan.tableOfChannel[(phase * Isa::BYTES + lane) % static_cast<size_t>(plan.channels)] == table ? 0xFFU : 0x00U;
+							masks[phase][table] = Isa::mask(lanes);
+						}
+					}
+				}
+
+				// Functions
+				size_t apply(unsigned char* samples, size_t count) const {
+					size_t i = 0ULL;
+					int phase = 0;
+					for (; i + Isa::BYTES <= count; i += Isa::BYTES) {
+						const typename Isa::Vector levels = Isa::load(samples + i);
+						if (plan.uniform)
+							Isa::store(samples + i, Isa::lookup(tables[0], levels));
+						else {
+							typename Isa::Vector result = levels;
+							for (int table = 0; table < plan.tableCount; table++)
+								result = Isa::blend(result, Isa::lookup(tables[table], levels), masks[phase][table]);
+							Isa::store(samples + i, result);
+						}
+						if (++phase == phases)
+							phase = 0;
+					}
+					return i;
+				}
+		};
+#if defined(IT_SIMD_AVX512VBMI)
+		using Kernel = VectorKernel<Avx512Vbmi>;
+#elif defined(IT_SIMD_AVX2)
+		using Kernel = VectorKernel<Avx2>;
+#elif defined(IT_SIMD_SSSE3)
+		using Kernel = VectorKernel<Ssse3>;
+#elif defined(IT_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+		using Kernel = VectorKernel<Neon>;
+#endif
+	}
+
+	// struct Lut
+
+	// Object | public
+
+	// Constructors
+	Lut::Lut() {
+		for (int level = 0; level < 256; level++)
+			table[level] = static_cast<unsigned char>(level);
+	}
+
+	// Functions
+	Lut Lut::then(const Lut& next) const {
+		Lut fused{};
+		for (int level = 0; level < 256; level++)
+			fused.table[level] = next.table[table[level]];
+		return fused;
+	}
+	bool Lut::isIdentity() const {
+		return *this == Lut{};
+	}
+
+	// struct ChannelLuts
+
+	// Object | public
+
+	// Constructors
+	ChannelLuts::ChannelLuts(const Lut& all) {
+		channels.fill(all);
+	}
+
+	// Functions
+	ChannelLuts ChannelLuts::then(const ChannelLuts& next) const {
+		ChannelLuts fused{};
+		for (size_t channel = 0ULL; channel < channels.size(); channel++)
+			fused.channels[channel] = channels[channel].then(next.channels[channel]);
+		return fused;
+	}
+
+	// Functions | tables
+	Lut invertLut() {
+		Lut lut{};
+		for (int level = 0; level < 256; level++)
+			lut.table[level] = static_cast<unsigned char>(255 - level);
+		return lut;
+	}
+	Lut thresholdLut(int threshold) {
+		Lut lut{};
+		for (int level = 0; level < 256; level++)
+			lut.table[level] = level >= threshold ? 255U : 0U;
+		return lut;
+	}
+	Lut gammaLut(float gamma) {
+		Lut lut{};
+		for (int level = 0; level < 256; level++)
+			lut.table[level] = toLevel(255.0 * std::pow(level / 255.0, static_cast<double>(gamma)));
+		return lut;
+	}
+	Lut brightnessContrastLut(float brightness, float contrast) {
+		Lut lut{};
+		for (int level = 0; level < 256; level++)
+			lut.table[level] = toLevel((level - 128.0) * contrast + 128.0 + brightness);
+		return lut;
+	}
+	Lut levelsLut(int inputBlack, int inputWhite, float gamma, int outputBlack, int outputWhite) {
+		Lut lut{};
+		const double range = std::max(1, inputWhite - inputBlack);
+		const double exponent = gamma > 0.0f ? 1.0 / gamma : 1.0;
+		for (int level = 0; level < 256; level++) {
+			const double position = std::clamp((level - inputBlack) / range, 0.0, 1.0);
+			lut.table[level] = toLevel(outputBlack + std::pow(position, exponent) * (outputWhite - outputBlack));
+		}
+		return lut;
+	}
+	Lut curveLut(const std::vector<glm::vec2>& points) {
+		// Control points sorted by input, one per input level
+		std::vector<glm::vec2> knots(points);
+		std::sort(knots.begin(), knots.end(), [](const glm::vec2& a, const glm::vec2& b) { return a.x < b.x; });
+		knots.erase(std::unique(knots.begin(), knots.end(), [](const glm::vec2& a, const glm::vec2& b) { return a.x == b.x; }), knots.end());
+		if (knots.size() < 2ULL)
+			return Lut{};
+
+		// Fritsch-Carlson tangents keep the curve monotone between monotone control points (no overshoot)
+		const size_t count = knots.size();
+		std::vector<double> slopes(count - 1ULL);
+		std::vector<double> tangents(count);
+		for (size_t i = 0ULL; i + 1ULL < count; i++)
+			slopes[i] = (knots[i + 1ULL].y - knots[i].y) / static_cast<double>(knots[i + 1ULL].x - knots[i].x);
+		tangents.front() = slopes.front();
+		tangents.back() = slopes.back();
+		for (size_t i = 1ULL; i + 1ULL < count; i++)
+			tangents[i] = slopes[i - 1ULL] * slopes[i] <= 0.0 ? 0.0 : (slopes[i - 1ULL] + slopes[i]) * 0.5;
+		for (size_t i = 0ULL; i + 1ULL < count; i++) {
+			if (slopes[i] == 0.0) {
+				tangents[i] = tangents[i + 1ULL] = 0.0;
+				continue;
+			}
+			const double a = tangents[i] / slopes[i];
+			const double b = tangents[i + 1ULL] / slopes[i];
+			const double length = a * a + b * b;
+			if (length > 9.0) {
+				const double scale = 3.0 / std::sqrt(length);
+				tangents[i] = scale * a * slopes[i];
+				tangents[i + 1ULL] = scale * b * slopes[i];
+			}
+		}
+
+		Lut lut{};
+		size_t segment = 0ULL;
+		for (int level = 0; level < 256; level++) {
+			if (level <= knots.front().x) {
+				lut.table[level] = toLevel(knots.front().y);
+				continue;
+			}
+			if (level >= knots.back().x) {
+				lut.table[level] = toLevel(knots.back().y);
+				continue;
+			}
+			while (knots[segment + 1ULL].x < level)
+				segment++;
+
+			// Cubic Hermite on the segment
+			const double width = knots[segment + 1ULL].x - knots[segment].x;
+			const double t = (level - knots[segment].x) / width;
+			const double t2 = t * t;
+			const double t3 = t2 * t;
+			lut.table[level] = toLevel(
+				(2.0 * t3 - 3.0 * t2 + 1.0) * knots[segment].y + (t3 - 2.0 * t2 + t) * width * tangents[segment] +
+				(-2.0 * t3 + 3.0 * t2) * knots[segment + 1ULL].y + (t3 - t2) * width * tangents[segment + 1ULL]
+			);
+		}
+		return lut;
+	}
+
+	// Functions | application
+	bool applyLut(const ImageView& image, const Lut& lut, bool includeAlpha) {
+		ChannelLuts luts(lut);
+		if (!includeAlpha && (image.channels == 2 || image.channels == 4))
+			luts.channels[image.channels - 1] = Lut{};
+		return applyLut(image, luts);
+	}
+	bool applyLut(const ImageView& image, const ChannelLuts& luts) {
+		// Error check
+		if (!image.hasData() || image.width <= 0 || image.height <= 0 || image.channels < 1 || image.channels > 4)
+			return false;
+
+		Plan plan{};
+		plan.channels = image.channels;
+		for (int channel = 0; channel < image.channels; channel++) {
+			const Lut& lut = luts.channels[channel];
+			if (lut.isIdentity())
+				continue;
+
+			int table = 0;
+			while (table < plan.tableCount && *plan.tables[table] != lut)
+				table++;
+			if (table == plan.tableCount)
+				plan.tables[plan.tableCount++] = &lut;
+			plan.tableOfChannel[channel] = table;
+		}
+		if (plan.tableCount == 0)
+			return true;
+		plan.uniform = plan.tableCount == 1 && std::all_of(plan.tableOfChannel.begin(), plan.tableOfChannel.begin() + image.channels, [](int table) { return table == 0; });
+
+		parallelForBands(0, image.height, [&](int rowBegin, int rowEnd) {
+#if defined(IT_SIMD_SSSE3) || defined(IT_SIMD_AVX2) || defined(IT_SIMD_AVX512VBMI) || (defined(IT_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64)))
+			const Kernel kernel(plan);
+#endif
+			const size_t count = static_cast<size_t>(image.width) * static_cast<size_t>(image.channels);
+			for (int y = rowBegin; y < rowEnd; y++) {
+				unsigned char* samples = image.row(y);
+				size_t i = 0ULL;
+#if defined(IT_SIMD_SSSE3) || defined(IT_SIMD_AVX2) || defined(IT_SIMD_AVX512VBMI) || (defined(IT_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64)))
+				i = kernel.apply(samples, count);
+#endif
+				for (; i < count; i++) {
+					const int table = plan.tableOfChannel[i % static_cast<size_t>(plan.channels)];
+					if (table >= 0)
+						samples[i] = plan.tables[table]->table[samples[i]];
+				}
+			}
+		}, BAND_ROWS);
+
+		return true;
+	}
+}
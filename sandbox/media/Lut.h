@@ -0,0 +1,58 @@
+#pragma once
+
+// Dependencies | std
+#include <array>
+#include <vector>
+
+// Dependencies | glm
+#include <glm/vec2.hpp>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Structs
+	// 256 entry lookup table for 8-bit samples, identity by default
+	struct Lut {
+		// Properties
+		std::array<unsigned char, 256> table{};
+
+		// Constructors
+		Lut();
+
+		// Operators | comparison
+		bool operator==(const Lut& other) const = default;
+		bool operator!=(const Lut& other) const = default;
+
+		// Functions
+		Lut then(const Lut& next) const; // One table equivalent to applying this and then next
+		bool isIdentity() const;
+	};
+
+	// One table per channel (index 3 is alpha for RGBA, index 1 for gray + alpha)
+	struct ChannelLuts {
+		// Properties
+		std::array<Lut, 4> channels{};
+
+		// Constructors
+		ChannelLuts() = default;
+		ChannelLuts(const Lut& all);
+
+		// Functions
+		ChannelLuts then(const ChannelLuts& next) const;
+	};
+
+	// Functions | tables
+	Lut invertLut();
+	Lut thresholdLut(int threshold); // level >= threshold -> 255, otherwise 0
+	Lut gammaLut(float gamma); // 255 * (level / 255)^gamma
+	Lut brightnessContrastLut(float brightness, float contrast); // (level - 128) * contrast + 128 + brightness
+	Lut levelsLut(int inputBlack, int inputWhite, float gamma = 1.0f, int outputBlack = 0, int outputWhite = 255); // gamma > 1 brightens midtones
+	Lut curveLut(const std::vector<glm::vec2>& points); // Monotone cubic through control points in 0..255
+
+	// Functions | application
+	// In place and in parallel over rows. Channels sharing a table are looked up together with byte shuffles
+	// (vpermi2b with AVX-512 VBMI, nibble split pshufb with SSSE3 / AVX2, tbl on NEON) and blended per channel.
+	bool applyLut(const ImageView& image, const Lut& lut, bool includeAlpha = false);
+	bool applyLut(const ImageView& image, const ChannelLuts& luts);
+}
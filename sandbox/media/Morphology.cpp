@@ -0,0 +1,349 @@
+#include "Morphology.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Dependencies | core
+#include <core/Parallel.h>
+#include <core/Simd.h>
+
+namespace it {
+	namespace {
+		// Columns (mask words) per vertical strip and rows per vertical band (rounded up to whole kernel blocks)
+		constexpr int STRIP_COLUMNS{ 256 };
+		constexpr int STRIP_WORDS{ 32 };
+		constexpr int BAND_ROWS{ 256 };
+		// Rows per parallel range of the horizontal pass
+		constexpr int ROW_GRAIN{ 16 };
+
+		// Operations over the samples of gray images
+		struct Minimum {
+			using Element = unsigned char;
+			static constexpr Element IDENTITY{ 255 };
+
+			static Element apply(Element first, Element second) {
+				return std::min(first, second);
+			}
+#if defined(IT_SIMD_SSE2)
+			static __m128i apply(__m128i first, __m128i second) {
+				return _mm_min_epu8(first, second);
+			}
+#endif
+		};
+		struct Maximum {
+			using Element = unsigned char;
+			static constexpr Element IDENTITY{ 0 };
+
+			static Element apply(Element first, Element second) {
+				return std::max(first, second);
+			}
+#if defined(IT_SIMD_SSE2)
+			static __m128i apply(__m128i first, __m128i second) {
+				return _mm_max_epu8(first, second);
+			}
+#endif
+		};
+		// The same over the 64 pixel words of masks
+		struct Intersection {
+			using Element = std::uint64_t;
+			static constexpr Element IDENTITY{ ~Element{ 0 } };
+
+			static Element apply(Element first, Element second) {
+				return first & second;
+			}
+#if defined(IT_SIMD_SSE2)
+			static __m128i apply(__m128i first, __m128i second) {
+				return _mm_and_si128(first, second);
+			}
+#endif
+		};
+		struct Union {
+			using Element = std::uint64_t;
+			static constexpr Element IDENTITY{ 0 };
+
+			static Element apply(Element first, Element second) {
+				return first | second;
+			}
+#if defined(IT_SIMD_SSE2)
+			static __m128i apply(__m128i first, __m128i second) {
+				return _mm_or_si128(first, second);
+			}
+#endif
+		};
+
+		// destination[i] = Operation(first[i], second[i])
+		template<typename Operation, typename Element = typename Operation::Element>
+		void combine(const Element* first, const Element* second, Element* destination, int count) {
+			int i = 0;
+#if defined(IT_SIMD_SSE2)
+			constexpr int LANES = static_cast<int>(sizeof(__m128i) / sizeof(Element));
+			for (; i + LANES <= count; i += LANES) {
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(second + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), Operation::apply(a, b));
+			}
+#endif
+			for (; i < count; i++)
+				destination[i] = Operation::apply(first[i], second[i]);
+		}
+
+		// Vertical van Herk/Gil-Werman over the rows [rowBegin, rowEnd) of a strip of columns elements, with
+		// sourceRow(y) and destinationRow(y) pointing at the strip in row y. Padded row i is source row i - anchor
+		// (identity outside the image); output row y is the window of padded rows [y, y + size). Blocks of size padded
+		// rows start at rowBegin: for output row y = b + j of the block starting at b, the window is the suffix of its
+		// block from j (backward running values, kept for the whole block) combined with the prefix of the next block
+		// up to j - 1 (one forward running row).
+		template<typename Operation, typename SourceRow, typename DestinationRow, typename Element = typename Operation::Element>
+		void slideColumns(SourceRow sourceRow, DestinationRow destinationRow, int sourceHeight, int columns, int rowBegin, int rowEnd, int size, int anchor, std::vector<Element>& scratch) {
+			scratch.resize(static_cast<size_t>(size + 2) * static_cast<size_t>(columns));
+			Element* identity = scratch.data();
+			Element* forward = identity + columns;
+			Element* backward = forward + columns;
+			std::fill(identity, identity + columns, Operation::IDENTITY);
+			const size_t rowSize = static_cast<size_t>(columns) * sizeof(Element);
+
+			const auto paddedRow = [&](int i) -> const Element* {
+				const int y = i - anchor;
+				return y >= 0 && y < sourceHeight ? sourceRow(y) : identity;
+			};
+			const auto backwardRow = [&](int j) {
+				return backward + static_cast<size_t>(j) * static_cast<size_t>(columns);
+			};
+
+			for (int block = rowBegin; block < rowEnd; block += size) {
+				std::memcpy(backwardRow(size - 1), paddedRow(block + size - 1), rowSize);
+				for (int j = size - 2; j >= 0; j--)
+					combine<Operation>(backwardRow(j + 1), paddedRow(block + j), backwardRow(j), columns);
+
+				std::memcpy(destinationRow(block), backwardRow(0), rowSize);
+				const int blockEnd = std::min(block + size, rowEnd);
+				for (int y = block + 1; y < blockEnd; y++) {
+					const int j = y - block;
+					if (j == 1)
+						std::memcpy(forward, paddedRow(block + size), rowSize);
+					else
+						combine<Operation>(forward, paddedRow(block + size + j - 1), forward, columns);
+					combine<Operation>(backwardRow(j), forward, destinationRow(y), columns);
+				}
+			}
+		}
+
+		// The same along one row: output x is the window of padded samples [x, x + size) with padded sample i being
+		// source[i - anchor]
+		template<typename Operation>
+		void slideRow(const unsigned char* source, unsigned char* destination, int width, int size, int anchor, std::vector<unsigned char>& backward) {
+			backward.resize(static_cast<size_t>(size));
+			const auto padded = [&](int i) {
+				const int x = i - anchor;
+				return x >= 0 && x < width ? source[x] : Operation::IDENTITY;
+			};
+
+			for (int block = 0; block < width; block += size) {
+				unsigned char running = padded(block + size - 1);
+				backward[size - 1] = running;
+				for (int j = size - 2; j >= 0; j--)
+					backward[j] = running = Operation::apply(running, padded(block + j));
+
+				destination[block] = backward[0];
+				const int blockEnd = std::min(block + size, width);
+				running = Operation::IDENTITY;
+				for (int x = block + 1; x < blockEnd; x++) {
+					const int j = x - block;
+					running = Operation::apply(running, padded(block + size + j - 1));
+					destination[x] = Operation::apply(backward[j], running);
+				}
+			}
+		}
+
+		// dst[x] = src[x + shift] for the bits of a row of words, fill outside of it
+		void shiftBits(const std::uint64_t* source, std::uint64_t* destination, int words, int shift, std::uint64_t fill) {
+			const auto word = [&](int i) {
+				return i >= 0 && i < words ? source[i] : fill;
+			};
+			const int distance = shift < 0 ? -shift : shift;
+			const int wordShift = distance / 64;
+			const int bitShift = distance % 64;
+			for (int i = 0; i < words; i++) {
+				if (shift >= 0) {
+					const std::uint64_t low = word(i + wordShift);
+					destination[i] = bitShift == 0 ? low : (low >> bitShift) | (word(i + wordShift + 1) << (64 - bitShift));
+				} else {
+					const std::uint64_t high = word(i - wordShift);
+					destination[i] = bitShift == 0 ? high : (high << bitShift) | (word(i - wordShift - 1) >> (64 - bitShift));
+				}
+			}
+		}
+
+		// Combines bit x with the following (direction 1) or preceding (direction -1) length - 1 bits, by doubling: a
+		// window of 2n bits is a window of n bits combined with the same shifted by n, and a window of any length is two
+		// overlapping windows of the largest power of two below it. Windows starting outside the row only cover bits
+		// outside of it, so the fill of the shifts is exact.
+		template<typename Operation>
+		void windowBits(std::uint64_t* window, std::uint64_t* shifted, int words, int length, int direction) {
+			int covered = 1;
+			for (; covered * 2 <= length; covered *= 2) {
+				shiftBits(window, shifted, words, covered * direction, Operation::IDENTITY);
+				combine<Operation>(window, shifted, window, words);
+			}
+			if (covered < length) {
+				shiftBits(window, shifted, words, (length - covered) * direction, Operation::IDENTITY);
+				combine<Operation>(window, shifted, window, words);
+			}
+		}
+
+		// Horizontal pass of masks, 64 pixels per word operation and log2(size) passes per row: the window of bit x is
+		// bits [x - anchor, x] combined with bits [x, x + size - 1 - anchor]
+		template<typename Operation>
+		void slideBits(const std::uint64_t* source, std::uint64_t* destination, int width, int words, int size, int anchor, std::vector<std::uint64_t>& scratch) {
+			scratch.resize(static_cast<size_t>(words) * 3ULL);
+			std::uint64_t* before = scratch.data();
+			std::uint64_t* after = before + words;
+			std::uint64_t* shifted = after + words;
+
+			// Pixels past the width count as outside the image
+			std::memcpy(before, source, static_cast<size_t>(words) * sizeof(std::uint64_t));
+			const int used = width % 64;
+			const std::uint64_t outside = used == 0 ? 0 : ~std::uint64_t{ 0 } << used;
+			before[words - 1] = (before[words - 1] & ~outside) | (Operation::IDENTITY & outside);
+			std::memcpy(after, before, static_cast<size_t>(words) * sizeof(std::uint64_t));
+
+			windowBits<Operation>(before, shifted, words, anchor + 1, -1);
+			windowBits<Operation>(after, shifted, words, size - anchor, 1);
+			combine<Operation>(before, after, destination, words);
+			destination[words - 1] &= ~outside;
+		}
+
+		template<typename Operation>
+		bool maskMorphology(const ImageMask& source, ImageMask& destination, glm::ivec2 kernelSize) {
+			// Error check
+			if (!source.isAllocated() || kernelSize.x <= 0 || kernelSize.y <= 0)
+				return false;
+
+			const int width = source.getWidth();
+			const int height = source.getHeight();
+			const int words = source.getWordsPerRow();
+
+			// Vertical pass over strips of words into a copy, which also lets the destination be the source
+			ImageMask intermediate(width, height);
+			if (!intermediate.isAllocated())
+				return false;
+			const int bandRows = (std::max(BAND_ROWS, kernelSize.y) + kernelSize.y - 1) / kernelSize.y * kernelSize.y;
+			parallelForTiles({ { 0, 0 }, { words, height } }, { STRIP_WORDS, bandRows }, [&](const ui::Rect& tile) {
+				std::vector<std::uint64_t> scratch;
+				const auto sourceRow = [&](int y) { return source.row(y) + tile.left(); };
+				const auto destinationRow = [&](int y) { return intermediate.row(y) + tile.left(); };
+				slideColumns<Operation>(sourceRow, destinationRow, height, tile.width(), tile.top(), tile.bottom(), kernelSize.y, kernelSize.y / 2, scratch);
+			});
+
+			if (&destination != &source && destination.allocate(width, height) == nullptr)
+				return false;
+			parallelFor(0, height, [&](int rowBegin, int rowEnd) {
+				std::vector<std::uint64_t> scratch;
+				for (int y = rowBegin; y < rowEnd; y++)
+					slideBits<Operation>(intermediate.row(y), destination.row(y), width, words, kernelSize.x, kernelSize.x / 2, scratch);
+			}, std::max(1, ROW_GRAIN * 64 / words));
+			return true;
+		}
+
+		template<typename Operation>
+		bool morphology(const ImageViewGray& source, const ImageViewGray& destination, glm::ivec2 kernelSize) {
+			// Error check
+			if (!source.hasData() || !destination.hasData() || kernelSize.x <= 0 || kernelSize.y <= 0)
+				return false;
+			if (source.width != destination.width || source.height != destination.height)
+				return false;
+
+			const int width = source.width;
+			const int height = source.height;
+
+			// Vertical pass into a packed copy, which also lets the destination be the source
+			std::vector<unsigned char> columnsPass(static_cast<size_t>(width) * static_cast<size_t>(height));
+			const ImageViewGray intermediate(columnsPass.data(), width, height);
+			const int bandRows = (std::max(BAND_ROWS, kernelSize.y) + kernelSize.y - 1) / kernelSize.y * kernelSize.y;
+			parallelForTiles({ { 0, 0 }, { width, height } }, { STRIP_COLUMNS, bandRows }, [&](const ui::Rect& tile) {
+				std::vector<unsigned char> scratch;
+				if (kernelSize.y == 1) {
+					for (int y = tile.top(); y < tile.bottom(); y++)
+						std::memcpy(intermediate.row(y) + tile.left(), source.row(y) + tile.left(), static_cast<size_t>(tile.width()));
+				} else {
+					const auto sourceRow = [&](int y) { return source.row(y) + tile.left(); };
+					const auto destinationRow = [&](int y) { return intermediate.row(y) + tile.left(); };
+					slideColumns<Operation>(sourceRow, destinationRow, height, tile.width(), tile.top(), tile.bottom(), kernelSize.y, kernelSize.y / 2, scratch);
+				}
+			});
+
+			parallelFor(0, height, [&](int rowBegin, int rowEnd) {
+				std::vector<unsigned char> backward;
+				for (int y = rowBegin; y < rowEnd; y++) {
+					if (kernelSize.x == 1)
+						std::memcpy(destination.row(y), intermediate.row(y), static_cast<size_t>(width));
+					else
+						slideRow<Operation>(intermediate.row(y), destination.row(y), width, kernelSize.x, kernelSize.x / 2, backward);
+				}
+			}, ROW_GRAIN);
+			return true;
+		}
+	}
+
+	// Functions | morphology
+	bool erode(const ImageViewGray& source, const ImageViewGray& destination, glm::ivec2 kernelSize) {
+		return morphology<Minimum>(source, destination, kernelSize);
+	}
+	bool dilate(const ImageViewGray& source, const ImageViewGray& destination, glm::ivec2 kernelSize) {
+		return morphology<Maximum>(source, destination, kernelSize);
+	}
+	bool opening(const ImageViewGray& source, const ImageViewGray& destination, glm::ivec2 kernelSize) {
+		return erode(source, destination, kernelSize) && dilate(destination, destination, kernelSize);
+	}
+	bool closing(const ImageViewGray& source, const ImageViewGray& destination, glm::ivec2 kernelSize) {
+		return dilate(source, destination, kernelSize) && erode(destination, destination, kernelSize);
+	}
+	bool morphologicalGradient(const ImageViewGray& source, const ImageViewGray& destination, glm::ivec2 kernelSize) {
+		// Error check
+		if (!source.hasData())
+			return false;
+
+		std::vector<unsigned char> eroded(static_cast<size_t>(source.width) * static_cast<size_t>(source.height));
+		const ImageViewGray erosion(eroded.data(), source.width, source.height);
+		if (!erode(source, erosion, kernelSize) || !dilate(source, destination, kernelSize))
+			return false;
+
+		parallelFor(0, destination.height, [&](int rowBegin, int rowEnd) {
+			for (int y = rowBegin; y < rowEnd; y++) {
+				unsigned char* row = destination.row(y);
+				const unsigned char* subtrahend = erosion.row(y);
+				int x = 0;
+#if defined(IT_SIMD_SSE2)
+				for (; x + 16 <= destination.width; x += 16) {
+					const __m128i maximum = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + x));
+					const __m128i minimum = _mm_loadu_si128(reinterpret_cast<const __m128i*>(subtrahend + x));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(row + x), _mm_subs_epu8(maximum, minimum));
+				}
+#endif
+				for (; x < destination.width; x++)
+					row[x] = static_cast<unsigned char>(row[x] - subtrahend[x]);
+			}
+		}, ROW_GRAIN);
+		return true;
+	}
+
+	bool erode(const ImageMask& source, ImageMask& destination, glm::ivec2 kernelSize) {
+		return maskMorphology<Intersection>(source, destination, kernelSize);
+	}
+	bool dilate(const ImageMask& source, ImageMask& destination, glm::ivec2 kernelSize) {
+		return maskMorphology<Union>(source, destination, kernelSize);
+	}
+	bool opening(const ImageMask& source, ImageMask& destination, glm::ivec2 kernelSize) {
+		return erode(source, destination, kernelSize) && dilate(destination, destination, kernelSize);
+	}
+	bool closing(const ImageMask& source, ImageMask& destination, glm::ivec2 kernelSize) {
+		return dilate(source, destination, kernelSize) && erode(destination, destination, kernelSize);
+	}
+	bool morphologicalGradient(const ImageMask& source, ImageMask& destination, glm::ivec2 kernelSize) {
+		ImageMask eroded;
+		return erode(source, eroded, kernelSize) && dilate(source, destination, kernelSize) && maskXor(destination, eroded, destination);
+	}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+// Dependencies | glm
+#include <glm/vec2.hpp>
+
+// Dependencies | media
+#include <media/Image.h>
+#include <media/ImageMask.h>
+
+namespace it {
+	// Functions | morphology
+	// Rectangular structuring elements of kernelSize pixels, anchored at (width / 2, height / 2) like ConvolutionKernel.
+	// Pixels outside the image never win the minimum or maximum. Both directions use van Herk/Gil-Werman: a running
+	// minimum (maximum) forwards and backwards inside blocks of the kernel size gives every window from two lookups,
+	// so the cost per pixel stays constant for any kernel size. The vertical pass runs over strips of columns in SSE2,
+	// the horizontal pass over rows, both in parallel. The destination must have the size of the source and may be the
+	// source itself.
+	bool erode(const ImageViewGray& source, const ImageViewGray& destination, glm::ivec2 kernelSize);
+	bool dilate(const ImageViewGray& source, const ImageViewGray& destination, glm::ivec2 kernelSize);
+	bool opening(const ImageViewGray& source, const ImageViewGray& destination, glm::ivec2 kernelSize); // Erosion then dilation, removes specks smaller than the kernel
+	bool closing(const ImageViewGray& source, const ImageViewGray& destination, glm::ivec2 kernelSize); // Dilation then erosion, fills holes smaller than the kernel
+	bool morphologicalGradient(const ImageViewGray& source, const ImageViewGray& destination, glm::ivec2 kernelSize); // Dilation minus erosion, outlines shapes
+
+	// The same for masks (set pixels are foreground). Rows of 64 pixel words: the vertical pass combines words with
+	// SSE2 and/or, the horizontal one shifts whole rows by doubling windows, log2(kernel width) passes per row. The
+	// destination is (re)allocated to the size of the source and may be the source.
+	bool erode(const ImageMask& source, ImageMask& destination, glm::ivec2 kernelSize);
+	bool dilate(const ImageMask& source, ImageMask& destination, glm::ivec2 kernelSize);
+	bool opening(const ImageMask& source, ImageMask& destination, glm::ivec2 kernelSize);
+	bool closing(const ImageMask& source, ImageMask& destination, glm::ivec2 kernelSize);
+	bool morphologicalGradient(const ImageMask& source, ImageMask& destination, glm::ivec2 kernelSize);
+}
@@ -0,0 +1,565 @@
+#include "Orientation.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Dependencies | core
+#include <core/Parallel.h>
+#include <core/Simd.h>
+
+namespace it {
+	namespace {
+		// Rows of pixels of any size; a negative stride walks the rows bottom up
+		struct Pixels {
+			unsigned char* data{ nullptr };
+			int width{ 0 };
+			int height{ 0 };
+			std::ptrdiff_t stride{ 0 };
+			int pixelSize{ 0 };
+
+			unsigned char* row(int y) const {
+				return data + static_cast<std::ptrdiff_t>(y) * stride;
+			}
+		};
+
+		Pixels pixelsOf(const ImageView& view) {
+			return { view.data, view.width, view.height, static_cast<std::ptrdiff_t>(view.stride), view.channels };
+		}
+		template<typename Image>
+		Pixels pixelsOf(const Image& image) {
+			constexpr int PIXEL_SIZE = static_cast<int>(sizeof(*image.getData()));
+			return { reinterpret_cast<unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), static_cast<std::ptrdiff_t>(image.getWidth()) * PIXEL_SIZE, PIXEL_SIZE };
+		}
+		// The same pixels with the rows in reverse order
+		Pixels upsideDown(const Pixels& pixels) {
+			return { pixels.row(pixels.height - 1), pixels.width, pixels.height, -pixels.stride, pixels.pixelSize };
+		}
+
+		// Calls function with std::integral_constant<int, pixelSize>
+		template<typename Function>
+		bool dispatchPixelSize(int pixelSize, Function&& function) {
+			switch (pixelSize) {
+				case 1: function(std::integral_constant<int, 1>{}); return true;
+				case 2: function(std::integral_constant<int, 2>{}); return true;
+				case 3: function(std::integral_constant<int, 3>{}); return true;
+				case 4: function(std::integral_constant<int, 4>{}); return true;
+				case 6: function(std::integral_constant<int, 6>{}); return true;
+				case 8: function(std::integral_constant<int, 8>{}); return true;
+				default: return false;
+			}
+		}
+
+		// Pixel rows per parallel range when a row costs about SIZE * width bytes
+		int grainRows(int width, int pixelSize) {
+			return std::max(1, 65536 / std::max(1, width * pixelSize));
+		}
+
+		// Register transposes of TILE x TILE pixels: destination row x receives source column x
+		template<int SIZE>
+		struct TransposeKernel {
+			static constexpr int TILE{ 0 };
+		};
+#if defined(IT_SIMD_SSE2)
+		template<>
+		struct TransposeKernel<1> {
+			static constexpr int TILE{ 8 };
+
+			static void run(const unsigned char* source, std::ptrdiff_t sourceStride, unsigned char* destination, std::ptrdiff_t destinationStride) {
+				__m128i rows[8];
+				for (int y = 0; y < 8; y++)
+					rows[y] = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + y * sourceStride));
+
+				const __m128i pairs0 = _mm_unpacklo_epi8(rows[0], rows[1]);
+				const __m128i pairs1 = _mm_unpacklo_epi8(rows[2], rows[3]);
+				const __m128i pairs2 = _mm_unpacklo_epi8(rows[4], rows[5]);
+				const __m128i pairs3 = _mm_unpacklo_epi8(rows[6], rows[7]);
+				const __m128i quads0 = _mm_unpacklo_epi16(pairs0, pairs1);
+				const __m128i quads1 = _mm_unpackhi_epi16(pairs0, pairs1);
+				const __m128i quads2 = _mm_unpacklo_epi16(pairs2, pairs3);
+				const __m128i quads3 = _mm_unpackhi_epi16(pairs2, pairs3);
+				const __m128i columns[4] = {
+					_mm_unpacklo_epi32(quads0, quads2),
+					_mm_unpackhi_epi32(quads0, quads2),
+					_mm_unpacklo_epi32(quads1, quads3),
+					_mm_unpackhi_epi32(quads1, quads3)
+				};
+
+				for (int x = 0; x < 4; x++) {
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(destination + (2 * x) * destinationStride), columns[x]);
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(destination + (2 * x + 1) * destinationStride), _mm_unpackhi_epi64(columns[x], columns[x]));
+				}
+			}
+		};
+		template<>
+		struct TransposeKernel<2> {
+			static constexpr int TILE{ 8 };
+
+			static void run(const unsigned char* source, std::ptrdiff_t sourceStride, unsigned char* destination, std::ptrdiff_t destinationStride) {
+				__m128i rows[8];
+				for (int y = 0; y < 8; y++)
+					rows[y] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + y * sourceStride));
+
+				__m128i pairs[8];
+				for (int y = 0; y < 4; y++) {
+					pairs[2 * y] = _mm_unpacklo_epi16(rows[2 * y], rows[2 * y + 1]);
+					pairs[2 * y + 1] = _mm_unpackhi_epi16(rows[2 * y], rows[2 * y + 1]);
+				}
+				__m128i quads[8];
+				for (int half = 0; half < 2; half++) {
+					const __m128i* top = pairs + 4 * half;
+					quads[4 * half] = _mm_unpacklo_epi32(top[0], top[2]);
+					quads[4 * half + 1] = _mm_unpackhi_epi32(top[0], top[2]);
+					quads[4 * half + 2] = _mm_unpacklo_epi32(top[1], top[3]);
+					quads[4 * half + 3] = _mm_unpackhi_epi32(top[1], top[3]);
+				}
+
+				for (int x = 0; x < 4; x++) {
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + (2 * x) * destinationStride), _mm_unpacklo_epi64(quads[x], quads[x + 4]));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + (2 * x + 1) * destinationStride), _mm_unpackhi_epi64(quads[x], quads[x + 4]));
+				}
+			}
+		};
+		template<>
+		struct TransposeKernel<4> {
+			static constexpr int TILE{ 4 };
+
+			static void run(const unsigned char* source, std::ptrdiff_t sourceStride, unsigned char* destination, std::ptrdiff_t destinationStride) {
+				const __m128i row0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+				const __m128i row1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + sourceStride));
+				const __m128i row2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 2 * sourceStride));
+				const __m128i row3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 3 * sourceStride));
+
+				const __m128i pairs0 = _mm_unpacklo_epi32(row0, row1);
+				const __m128i pairs1 = _mm_unpackhi_epi32(row0, row1);
+				const __m128i pairs2 = _mm_unpacklo_epi32(row2, row3);
+				const __m128i pairs3 = _mm_unpackhi_epi32(row2, row3);
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_unpacklo_epi64(pairs0, pairs2));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + destinationStride), _mm_unpackhi_epi64(pairs0, pairs2));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 2 * destinationStride), _mm_unpacklo_epi64(pairs1, pairs3));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 3 * destinationStride), _mm_unpackhi_epi64(pairs1, pairs3));
+			}
+		};
+		template<>
+		struct TransposeKernel<8> {
+			static constexpr int TILE{ 2 };
+
+			static void run(const unsigned char* source, std::ptrdiff_t sourceStride, unsigned char* destination, std::ptrdiff_t destinationStride) {
+				const __m128i row0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+				const __m128i row1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + sourceStride));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_unpacklo_epi64(row0, row1));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + destinationStride), _mm_unpackhi_epi64(row0, row1));
+			}
+		};
+#endif
+
+		template<int SIZE>
+		void transposeScalar(const unsigned char* source, std::ptrdiff_t sourceStride, unsigned char* destination, std::ptrdiff_t destinationStride, int width, int height) {
+			for (int x = 0; x < width; x++) {
+				const unsigned char* column = source + x * SIZE;
+				unsigned char* row = destination + x * destinationStride;
+				for (int y = 0; y < height; y++)
+					std::memcpy(row + y * SIZE, column + y * sourceStride, SIZE);
+			}
+		}
+
+		// Transposes a width x height block into a height x width block
+		template<int SIZE>
+		void transposeBlock(const unsigned char* source, std::ptrdiff_t sourceStride, unsigned char* destination, std::ptrdiff_t destinationStride, int width, int height) {
+			constexpr int TILE = TransposeKernel<SIZE>::TILE;
+			int tiledWidth{ 0 };
+			int tiledHeight{ 0 };
+			if constexpr (TILE > 0) {
+				tiledWidth = width - width % TILE;
+				tiledHeight = height - height % TILE;
+				for (int y = 0; y < tiledHeight; y += TILE) {
+					for (int x = 0; x < tiledWidth; x += TILE)
+						TransposeKernel<SIZE>::run(source + y * sourceStride + x * SIZE, sourceStride, destination + x * destinationStride + y * SIZE, destinationStride);
+				}
+			}
+
+			// Right columns, then the bottom rows left of them
+			transposeScalar<SIZE>(source + tiledWidth * SIZE, sourceStride, destination + tiledWidth * destinationStride, destinationStride, width - tiledWidth, height);
+			transposeScalar<SIZE>(source + tiledHeight * sourceStride, sourceStride, destination + tiledHeight * SIZE, destinationStride, tiledWidth, height - tiledHeight);
+		}
+
+		// Blocks whose source and destination rows both stay in L1
+		template<int SIZE>
+		constexpr int blockSize() {
+			return SIZE <= 2 ? 64 : 32;
+		}
+
+		template<int SIZE>
+		void transposePixels(const Pixels& source, const Pixels& destination) {
+			constexpr int BLOCK = blockSize<SIZE>();
+			parallelForTiles({ { 0, 0 }, { source.width, source.height } }, { BLOCK, BLOCK }, [&](const ui::Rect& block) {
+				transposeBlock<SIZE>(source.row(block.y()) + block.x() * SIZE, source.stride, destination.row(block.x()) + block.y() * SIZE, destination.stride, block.width(), block.height());
+			});
+		}
+
+		// Swaps every block above the diagonal with its mirror below it through a scratch block
+		template<int SIZE>
+		void transposeSquare(const Pixels& pixels) {
+			constexpr int BLOCK = blockSize<SIZE>();
+			const int size = pixels.width;
+			const int blocks = (size + BLOCK - 1) / BLOCK;
+			parallelFor(0, blocks, [&](int first, int last) {
+				thread_local std::vector<unsigned char> scratch{};
+				scratch.resize(static_cast<size_t>(BLOCK) * BLOCK * SIZE);
+
+				for (int blockY = first; blockY < last; blockY++) {
+					for (int blockX = blockY; blockX < blocks; blockX++) {
+						const int x = blockX * BLOCK;
+						const int y = blockY * BLOCK;
+						const int width = std::min(BLOCK, size - x);
+						const int height = std::min(BLOCK, size - y);
+						unsigned char* block = pixels.row(y) + x * SIZE;
+						unsigned char* mirror = pixels.row(x) + y * SIZE;
+
+						// scratch holds the transposed block: width rows of height pixels
+						transposeBlock<SIZE>(block, pixels.stride, scratch.data(), static_cast<std::ptrdiff_t>(height) * SIZE, width, height);
+						if (blockX != blockY)
+							transposeBlock<SIZE>(mirror, pixels.stride, block, pixels.stride, height, width);
+						for (int row = 0; row < width; row++)
+							std::memcpy(mirror + row * pixels.stride, scratch.data() + static_cast<size_t>(row) * height * SIZE, static_cast<size_t>(height) * SIZE);
+					}
+				}
+			});
+		}
+
+		// Reverses the order of the SIZE byte pixels in a register
+#if defined(IT_SIMD_SSE2)
+		template<int SIZE>
+		__m128i reversePixels(__m128i pixels) {
+			if constexpr (SIZE == 1)
+				pixels = _mm_or_si128(_mm_slli_epi16(pixels, 8), _mm_srli_epi16(pixels, 8));
+			if constexpr (SIZE <= 2)
+				pixels = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+			if constexpr (SIZE == 4)
+				return _mm_shuffle_epi32(pixels, _MM_SHUFFLE(0, 1, 2, 3));
+			else
+				return _mm_shuffle_epi32(pixels, _MM_SHUFFLE(1, 0, 3, 2));
+		}
+#endif
+
+		// Writes the width pixels of source to destination in reverse order; the rows must not overlap
+		template<int SIZE>
+		void reverseRow(const unsigned char* source, unsigned char* destination, int width) {
+			int x{ 0 };
+#if defined(IT_SIMD_SSE2)
+			if constexpr (16 % SIZE == 0) {
+				constexpr int STEP = 16 / SIZE;
+				for (; x + STEP <= width; x += STEP) {
+					const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + (width - x - STEP) * SIZE));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + x * SIZE), reversePixels<SIZE>(pixels));
+				}
+			}
+#endif
+			for (; x < width; x++)
+				std::memcpy(destination + x * SIZE, source + (width - 1 - x) * SIZE, SIZE);
+		}
+
+		template<int SIZE>
+		void reverseRows(const Pixels& source, const Pixels& destination) {
+			parallelFor(0, source.height, [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd; y++)
+					reverseRow<SIZE>(source.row(y), destination.row(y), source.width);
+			}, grainRows(source.width, SIZE));
+		}
+
+		// In place: rows y and height - 1 - y trade places, reversed when mirror is set
+		template<int SIZE>
+		void swapRows(const Pixels& pixels, bool mirror) {
+			const size_t rowSize = static_cast<size_t>(pixels.width) * SIZE;
+			parallelFor(0, (pixels.height + 1) / 2, [&](int rowBegin, int rowEnd) {
+				thread_local std::vector<unsigned char> scratch{};
+				scratch.resize(rowSize * 2ULL);
+				unsigned char* top = scratch.data();
+				unsigned char* bottom = scratch.data() + rowSize;
+
+				for (int y = rowBegin; y < rowEnd; y++) {
+					unsigned char* upper = pixels.row(y);
+					unsigned char* lower = pixels.row(pixels.height - 1 - y);
+					std::memcpy(top, upper, rowSize);
+					std::memcpy(bottom, lower, rowSize);
+					if (mirror) {
+						reverseRow<SIZE>(bottom, upper, pixels.width);
+						reverseRow<SIZE>(top, lower, pixels.width);
+					}
+					else {
+						std::memcpy(upper, bottom, rowSize);
+						std::memcpy(lower, top, rowSize);
+					}
+				}
+			}, grainRows(pixels.width, SIZE));
+		}
+
+		// In place horizontal mirror of every row
+		template<int SIZE>
+		void mirrorRows(const Pixels& pixels) {
+			const size_t rowSize = static_cast<size_t>(pixels.width) * SIZE;
+			parallelFor(0, pixels.height, [&](int rowBegin, int rowEnd) {
+				thread_local std::vector<unsigned char> scratch{};
+				scratch.resize(rowSize);
+				for (int y = rowBegin; y < rowEnd; y++) {
+					std::memcpy(scratch.data(), pixels.row(y), rowSize);
+					reverseRow<SIZE>(scratch.data(), pixels.row(y), pixels.width);
+				}
+			}, grainRows(pixels.width, SIZE));
+		}
+
+		void copyRows(const Pixels& source, const Pixels& destination) {
+			const size_t rowSize = static_cast<size_t>(source.width) * static_cast<size_t>(source.pixelSize);
+			parallelFor(0, source.height, [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd; y++)
+					std::memcpy(destination.row(y), source.row(y), rowSize);
+			}, grainRows(source.width, source.pixelSize));
+		}
+
+		// Operations on Pixels
+		bool flipHorizontalPixels(const Pixels& pixels) {
+			return dispatchPixelSize(pixels.pixelSize, [&](auto size) {
+				mirrorRows<decltype(size)::value>(pixels);
+			});
+		}
+		bool flipVerticalPixels(const Pixels& pixels) {
+			return dispatchPixelSize(pixels.pixelSize, [&](auto size) {
+				swapRows<decltype(size)::value>(pixels, false);
+			});
+		}
+		bool transposePixels(const Pixels& pixels) {
+			if (pixels.width != pixels.height)
+				return false;
+			return dispatchPixelSize(pixels.pixelSize, [&](auto size) {
+				transposeSquare<decltype(size)::value>(pixels);
+			});
+		}
+		bool rotatePixels(const Pixels& pixels, Rotation rotation) {
+			if (rotation == Rotation::HALF_TURN) {
+				return dispatchPixelSize(pixels.pixelSize, [&](auto size) {
+					swapRows<decltype(size)::value>(pixels, true);
+				});
+			}
+
+			// Quarter turns are a transpose followed by a horizontal (clockwise) or vertical mirror
+			if (!transposePixels(pixels))
+				return false;
+			return rotation == Rotation::CLOCKWISE_90 ? flipHorizontalPixels(pixels) : flipVerticalPixels(pixels);
+		}
+
+		bool flipHorizontalPixels(const Pixels& source, const Pixels& destination) {
+			return dispatchPixelSize(source.pixelSize, [&](auto size) {
+				reverseRows<decltype(size)::value>(source, destination);
+			});
+		}
+		bool flipVerticalPixels(const Pixels& source, const Pixels& destination) {
+			copyRows(upsideDown(source), destination);
+			return true;
+		}
+		bool transposePixels(const Pixels& source, const Pixels& destination) {
+			return dispatchPixelSize(source.pixelSize, [&](auto size) {
+				transposePixels<decltype(size)::value>(source, destination);
+			});
+		}
+		bool rotatePixels(const Pixels& source, const Pixels& destination, Rotation rotation) {
+			// Clockwise reads the source bottom up, counterclockwise writes the destination bottom up
+			switch (rotation) {
+				case Rotation::CLOCKWISE_90: return transposePixels(upsideDown(source), destination);
+				case Rotation::HALF_TURN: return flipHorizontalPixels(upsideDown(source), destination);
+				case Rotation::COUNTERCLOCKWISE_90: return transposePixels(source, upsideDown(destination));
+			}
+			return false;
+		}
+
+		bool isValid(const ImageView& view) {
+			return view.hasData() && view.width > 0 && view.height > 0 && view.channels >= 1 && view.channels <= 4;
+		}
+		bool fits(const ImageView& source, const ImageView& destination, bool swapped) {
+			return isValid(source) && isValid(destination) && source.channels == destination.channels &&
+				destination.width == (swapped ? source.height : source.width) && destination.height == (swapped ? source.width : source.height);
+		}
+
+		// Allocates destination at width x height unless it already has that size
+		template<typename Image>
+		bool allocateFor(Image& destination, int width, int height) {
+			if (destination.isAllocated() && destination.getWidth() == width && destination.getHeight() == height)
+				return true;
+			return destination.allocate(width, height) != nullptr;
+		}
+	}
+
+	// Functions | views
+	bool flipHorizontal(const ImageView& image) {
+		// Error check
+		if (!isValid(image))
+			return false;
+
+		return flipHorizontalPixels(pixelsOf(image));
+	}
+	bool flipVertical(const ImageView& image) {
+		// Error check
+		if (!isValid(image))
+			return false;
+
+		return flipVerticalPixels(pixelsOf(image));
+	}
+	bool transpose(const ImageView& image) {
+		// Error check
+		if (!isValid(image))
+			return false;
+
+		return transposePixels(pixelsOf(image));
+	}
+	bool rotate(const ImageView& image, Rotation rotation) {
+		// Error check
+		if (!isValid(image))
+			return false;
+
+		return rotatePixels(pixelsOf(image), rotation);
+	}
+
+	bool flipHorizontal(const ImageView& source, const ImageView& destination) {
+		// Error check
+		if (!fits(source, destination, false))
+			return false;
+
+		return flipHorizontalPixels(pixelsOf(source), pixelsOf(destination));
+	}
+	bool flipVertical(const ImageView& source, const ImageView& destination) {
+		// Error check
+		if (!fits(source, destination, false))
+			return false;
+
+		return flipVerticalPixels(pixelsOf(source), pixelsOf(destination));
+	}
+	bool transpose(const ImageView& source, const ImageView& destination) {
+		// Error check
+		if (!fits(source, destination, true))
+			return false;
+
+		return transposePixels(pixelsOf(source), pixelsOf(destination));
+	}
+	bool rotate(const ImageView& source, const ImageView& destination, Rotation rotation) {
+		// Error check
+		if (!fits(source, destination, rotation != Rotation::HALF_TURN))
+			return false;
+
+		return rotatePixels(pixelsOf(source), pixelsOf(destination), rotation);
+	}
+
+	// Functions | images
+	template<IsImage Image>
+	bool flipHorizontal(Image& image) {
+		// Error check
+		if (!image.isAllocated())
+			return false;
+
+		return flipHorizontalPixels(pixelsOf(image));
+	}
+	template<IsImage Image>
+	bool flipVertical(Image& image) {
+		// Error check
+		if (!image.isAllocated())
+			return false;
+
+		return flipVerticalPixels(pixelsOf(image));
+	}
+	template<IsImage Image>
+	bool transpose(Image& image) {
+		// Error check
+		if (!image.isAllocated())
+			return false;
+
+		if (image.getWidth() == image.getHeight())
+			return transposePixels(pixelsOf(image));
+
+		Image transposed{};
+		if (!transpose(image, transposed))
+			return false;
+		image = std::move(transposed);
+		return true;
+	}
+	template<IsImage Image>
+	bool rotate(Image& image, Rotation rotation) {
+		// Error check
+		if (!image.isAllocated())
+			return false;
+
+		if (rotation == Rotation::HALF_TURN || image.getWidth() == image.getHeight())
+			return rotatePixels(pixelsOf(image), rotation);
+
+		Image rotated{};
+		if (!rotate(image, rotated, rotation))
+			return false;
+		image = std::move(rotated);
+		return true;
+	}
+
+	template<IsImage Image>
+	bool flipHorizontal(const Image& source, Image& destination) {
+		// Error check
+		if (&source == &destination || !source.isAllocated())
+			return false;
+		if (!allocateFor(destination, source.getWidth(), source.getHeight()))
+			return false;
+
+		return flipHorizontalPixels(pixelsOf(source), pixelsOf(destination));
+	}
+	template<IsImage Image>
+	bool flipVertical(const Image& source, Image& destination) {
+		// Error check
+		if (&source == &destination || !source.isAllocated())
+			return false;
+		if (!allocateFor(destination, source.getWidth(), source.getHeight()))
+			return false;
+
+		return flipVerticalPixels(pixelsOf(source), pixelsOf(destination));
+	}
+	template<IsImage Image>
+	bool transpose(const Image& source, Image& destination) {
+		// Error check
+		if (&source == &destination || !source.isAllocated())
+			return false;
+		if (!allocateFor(destination, source.getHeight(), source.getWidth()))
+			return false;
+
+		return transposePixels(pixelsOf(source), pixelsOf(destination));
+	}
+	template<IsImage Image>
+	bool rotate(const Image& source, Image& destination, Rotation rotation) {
+		// Error check
+		if (&source == &destination || !source.isAllocated())
+			return false;
+		const bool swapped = rotation != Rotation::HALF_TURN;
+		if (!allocateFor(destination, swapped ? source.getHeight() : source.getWidth(), swapped ? source.getWidth() : source.getHeight()))
+			return false;
+
+		return rotatePixels(pixelsOf(source), pixelsOf(destination), rotation);
+	}
+
+#define IT_ORIENTATION_INSTANTIATE(Image) \
+	template bool flipHorizontal<Image>(Image&); \
+	template bool flipVertical<Image>(Image&); \
+	template bool transpose<Image>(Image&); \
+	template bool rotate<Image>(Image&, Rotation); \
+	template bool flipHorizontal<Image>(const Image&, Image&); \
+	template bool flipVertical<Image>(const Image&, Image&); \
+	template bool transpose<Image>(const Image&, Image&); \
+	template bool rotate<Image>(const Image&, Image&, Rotation);
+
+	IT_ORIENTATION_INSTANTIATE(ImageGray)
+	IT_ORIENTATION_INSTANTIATE(ImageGrayAlpha)
+	IT_ORIENTATION_INSTANTIATE(ImageRGB)
+	IT_ORIENTATION_INSTANTIATE(ImageRGBA)
+	IT_ORIENTATION_INSTANTIATE(ImageGray16)
+	IT_ORIENTATION_INSTANTIATE(ImageGrayAlpha16)
+	IT_ORIENTATION_INSTANTIATE(ImageRGB16)
+	IT_ORIENTATION_INSTANTIATE(ImageRGBA16)
+
+#undef IT_ORIENTATION_INSTANTIATE
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Enums
+	enum class Rotation {
+		CLOCKWISE_90,
+		HALF_TURN,
+		COUNTERCLOCKWISE_90
+	};
+
+	// Functions | views
+	// Transposes and quarter turns copy cache-sized blocks through SSE2 register transposes (8x8 for 1 and 2 byte
+	// pixels, 4x4 for 4 bytes), flips reverse whole registers. All of them run in parallel over rows or blocks.
+
+	// In place. Transposes and quarter turns only work on square views.
+	bool flipHorizontal(const ImageView& image);
+	bool flipVertical(const ImageView& image);
+	bool transpose(const ImageView& image);
+	bool rotate(const ImageView& image, Rotation rotation);
+
+	// Out of place into a destination with the same channels and the resulting size (width and height swap for
+	// transposes and quarter turns) that does not overlap the source
+	bool flipHorizontal(const ImageView& source, const ImageView& destination);
+	bool flipVertical(const ImageView& source, const ImageView& destination);
+	bool transpose(const ImageView& source, const ImageView& destination);
+	bool rotate(const ImageView& source, const ImageView& destination, Rotation rotation);
+
+	// Functions | images
+	// Image is any of the 8 image classes. In place transposes and quarter turns of non-square images reallocate; out
+	// of place versions (re)allocate the destination, which must not be the source.
+	template<IsImage Image>
+	bool flipHorizontal(Image& image);
+	template<IsImage Image>
+	bool flipVertical(Image& image);
+	template<IsImage Image>
+	bool transpose(Image& image);
+	template<IsImage Image>
+	bool rotate(Image& image, Rotation rotation);
+	template<IsImage Image>
+	bool flipHorizontal(const Image& source, Image& destination);
+	template<IsImage Image>
+	bool flipVertical(const Image& source, Image& destination);
+	template<IsImage Image>
+	bool transpose(const Image& source, Image& destination);
+	template<IsImage Image>
+	bool rotate(const Image& source, Image& destination, Rotation rotation);
+}
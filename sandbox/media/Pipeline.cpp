@@ -0,0 +1,346 @@
+#include "Pipeline.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+// Dependencies | core
+#include <core/Parallel.h>
+
+// Dependencies | media
+#include <media/Blend.h>
+
+namespace it {
+	namespace {
+		// Part of a tile, given in image coordinates (must lie inside the tile)
+		ImageView viewOf(const PipelineTile& tile, const ui::Rect& region) {
+			return tile.view.subView({ region.position - tile.region.position, region.size });
+		}
+
+		void copyPixels(const ImageView& source, const ImageView& destination) {
+			const size_t rowSize = static_cast<size_t>(destination.width) * static_cast<size_t>(destination.channels);
+			for (int y = 0; y < destination.height; y++)
+				std::memcpy(destination.row(y), source.row(y), rowSize);
+		}
+
+		ui::Rect expanded(const ui::Rect& region, int x, int y) {
+			return { { region.x() - x, region.y() - y }, { region.width() + 2 * x, region.height() + 2 * y } };
+		}
+	}
+
+	// struct PipelineStage
+
+	// Functions
+	bool PipelineStage::isSource() const {
+		return image.hasData();
+	}
+
+	// class Pipeline
+
+	// Object | public
+
+	// Getters
+	int Pipeline::getStageCount() const {
+		return static_cast<int>(stages.size());
+	}
+	const PipelineStage& Pipeline::getStage(int stage) const {
+		assert(stage >= 0 && stage < getStageCount() && "stage is out of range");
+		return stages[static_cast<size_t>(stage)];
+	}
+
+	// Functions | graph
+	int Pipeline::addSource(const ImageView& image) {
+		// Error check
+		if (!image.hasData() || image.width <= 0 || image.height <= 0 || image.channels < 1 || image.channels > 4)
+			return -1;
+
+		PipelineStage stage{};
+		stage.width = image.width;
+		stage.height = image.height;
+		stage.channels = image.channels;
+		stage.image = image;
+		stages.push_back(std::move(stage));
+		return getStageCount() - 1;
+	}
+	int Pipeline::addStage(const PipelineStage& stage) {
+		// Error check
+		if (stage.isSource())
+			return addSource(stage.image);
+		if (stage.width <= 0 || stage.height <= 0 || stage.channels < 1 || stage.channels > 4 || !stage.footprint || !stage.compute)
+			return -1;
+		for (int input : stage.inputs) {
+			if (input < 0 || input >= getStageCount())
+				return -1;
+		}
+
+		stages.push_back(stage);
+		return getStageCount() - 1;
+	}
+	int Pipeline::addLut(int input, const ChannelLuts& luts) {
+		// Error check
+		if (input < 0 || input >= getStageCount())
+			return -1;
+
+		const PipelineStage& source = getStage(input);
+		PipelineStage stage{};
+		stage.width = source.width;
+		stage.height = source.height;
+		stage.channels = source.channels;
+		stage.inputs = { input };
+		stage.footprint = [](const ui::Rect& region, int) {
+			return region;
+		};
+		stage.compute = [luts](const std::vector<PipelineTile>& inputs, const PipelineTile& output) {
+			copyPixels(viewOf(inputs[0], output.region), output.view);
+			return applyLut(output.view, luts);
+		};
+		return addStage(stage);
+	}
+	int Pipeline::addConvolution(int input, const ConvolutionKernel& kernel, const ConvolutionOptions& options) {
+		// Error check
+		if (input < 0 || input >= getStageCount() || !kernel.isValid())
+			return -1;
+
+		const PipelineStage& source = getStage(input);
+		PipelineStage stage{};
+		stage.width = source.width;
+		stage.height = source.height;
+		stage.channels = source.channels;
+		stage.inputs = { input };
+
+		// The convolution runs over the whole input tile: where the tile was clipped it ends at the image edge, so the
+		// border modes see the same pixels as on the full image. Wrapping reads the opposite edge, so it runs untiled.
+		stage.untiled = options.border == BorderMode::WRAP;
+		stage.footprint = [kernel](const ui::Rect& region, int) {
+			return expanded(region, kernel.width / 2, kernel.height / 2);
+		};
+		stage.compute = [kernel, options](const std::vector<PipelineTile>& inputs, const PipelineTile& output) {
+			// The band's scratch, not a thread_local one: a thread waiting on the parallel convolve may run another band
+			std::vector<unsigned char>& scratch = *output.scratch;
+			const ImageView& source = inputs[0].view;
+			scratch.resize(static_cast<size_t>(source.width) * static_cast<size_t>(source.height) * static_cast<size_t>(source.channels));
+
+			const ImageView filtered(scratch.data(), source.width, source.height, source.channels);
+			if (!convolve(source, filtered, kernel, options))
+				return false;
+			copyPixels(viewOf({ filtered, inputs[0].region }, output.region), output.view);
+			return true;
+		};
+		return addStage(stage);
+	}
+	int Pipeline::addGaussianBlur(int input, float sigma, BorderMode border) {
+		// Error check
+		if (sigma <= 0.0f)
+			return -1;
+
+		const int radius = std::max(1, static_cast<int>(std::ceil(3.0f * sigma)));
+		std::vector<float> weights(static_cast<size_t>(radius) * 2ULL + 1ULL);
+		float total{ 0.0f };
+		for (int i = -radius; i <= radius; i++) {
+			weights[static_cast<size_t>(i + radius)] = std::exp(-static_cast<float>(i * i) / (2.0f * sigma * sigma));
+			total += weights[static_cast<size_t>(i + radius)];
+		}
+		for (float& weight : weights)
+			weight /= total;
+
+		// Colors are blurred premultiplied by alpha, like gaussianBlur does
+		ConvolutionOptions options{};
+		options.border = border;
+		options.premultiplied = true;
+		return addConvolution(input, ConvolutionKernel(weights, weights), options);
+	}
+	int Pipeline::addResize(int input, int width, int height, ResampleFilter filter) {
+		// Error check
+		if (input < 0 || input >= getStageCount() || width <= 0 || height <= 0)
+			return -1;
+
+		const PipelineStage& source = getStage(input);
+		const int sourceWidth = source.width;
+		const int sourceHeight = source.height;
+		PipelineStage stage{};
+		stage.width = width;
+		stage.height = height;
+		stage.channels = source.channels;
+		stage.inputs = { input };
+		stage.footprint = [=](const ui::Rect& region, int) {
+			return resizeFootprint(sourceWidth, sourceHeight, width, height, region, filter);
+		};
+		stage.compute = [=](const std::vector<PipelineTile>& inputs, const PipelineTile& output) {
+			return resizeRegion(inputs[0].view, inputs[0].region, sourceWidth, sourceHeight, output.view, output.region, width, height, filter);
+		};
+		return addStage(stage);
+	}
+	int Pipeline::addComposite(int background, int foreground) {
+		// Error check
+		if (background < 0 || background >= getStageCount() || foreground < 0 || foreground >= getStageCount())
+			return -1;
+
+		const PipelineStage& under = getStage(background);
+		const PipelineStage& over = getStage(foreground);
+		if (under.width != over.width || under.height != over.height || under.channels != over.channels || (under.channels != 2 && under.channels != 4))
+			return -1;
+
+		PipelineStage stage{};
+		stage.width = under.width;
+		stage.height = under.height;
+		stage.channels = under.channels;
+		stage.inputs = { background, foreground };
+		stage.footprint = [](const ui::Rect& region, int) {
+			return region;
+		};
+		stage.compute = [](const std::vector<PipelineTile>& inputs, const PipelineTile& output) {
+			const ImageView under = viewOf(inputs[0], output.region);
+			const ImageView over = viewOf(inputs[1], output.region);
+			for (int y = 0; y < output.view.height; y++)
+				blendOver(under.row(y), over.row(y), output.view.row(y), output.view.width, output.view.channels);
+			return true;
+		};
+		return addStage(stage);
+	}
+	void Pipeline::clear() {
+		stages.clear();
+	}
+
+	// Functions | execution
+	bool Pipeline::run(int output, const ImageView& destination, int tileWidth, int tileHeight) const {
+		// Error check
+		if (output < 0 || output >= getStageCount() || tileWidth <= 0 || tileHeight <= 0 || !destination.hasData())
+			return false;
+		const PipelineStage& last = getStage(output);
+		if (destination.width != last.width || destination.height != last.height || destination.channels != last.channels)
+			return false;
+
+		// Stages the output depends on
+		const size_t stageCount = static_cast<size_t>(output) + 1ULL;
+		std::vector<bool> needed(stageCount, false);
+		needed[static_cast<size_t>(output)] = true;
+		for (int id = output; id >= 0; id--) {
+			if (!needed[static_cast<size_t>(id)])
+				continue;
+			for (int input : stages[static_cast<size_t>(id)].inputs)
+				needed[static_cast<size_t>(input)] = true;
+		}
+
+		// Untiled stages run first, in graph order, over inputs produced whole; later stages read them like sources
+		std::vector<ImageView> images(stageCount, ImageView(nullptr, 0, 0, 0));
+		std::vector<std::vector<unsigned char>> wholeBuffers(stageCount);
+		auto wholeImage = [&](int id) {
+			const PipelineStage& stage = stages[static_cast<size_t>(id)];
+			std::vector<unsigned char>& buffer = wholeBuffers[static_cast<size_t>(id)];
+			buffer.resize(static_cast<size_t>(stage.width) * static_cast<size_t>(stage.height) * static_cast<size_t>(stage.channels));
+			return ImageView(buffer.data(), stage.width, stage.height, stage.channels);
+		};
+		for (size_t id = 0ULL; id < stageCount; id++) {
+			if (stages[id].isSource())
+				images[id] = stages[id].image;
+		}
+		for (int id = 0; id <= output; id++) {
+			const PipelineStage& stage = stages[static_cast<size_t>(id)];
+			if (!needed[static_cast<size_t>(id)] || !stage.untiled)
+				continue;
+
+			std::vector<PipelineTile> inputs{};
+			for (int input : stage.inputs) {
+				const PipelineStage& producer = stages[static_cast<size_t>(input)];
+				if (!images[static_cast<size_t>(input)].hasData()) {
+					const ImageView produced = wholeImage(input);
+					if (!runTiles(input, produced, tileWidth, tileHeight, images))
+						return false;
+					images[static_cast<size_t>(input)] = produced;
+				}
+				inputs.push_back({ images[static_cast<size_t>(input)], { { 0, 0 }, { producer.width, producer.height } } });
+			}
+
+			std::vector<unsigned char> scratch{};
+			const ImageView result = id == output ? destination : wholeImage(id);
+			if (!stage.compute(inputs, { result, { { 0, 0 }, { stage.width, stage.height } }, &scratch }))
+				return false;
+			if (id == output)
+				return true;
+			images[static_cast<size_t>(id)] = result;
+		}
+
+		return runTiles(output, destination, tileWidth, tileHeight, images);
+	}
+
+	// Object | private
+
+	// Functions
+	bool Pipeline::runTiles(int output, const ImageView& destination, int tileWidth, int tileHeight, const std::vector<ImageView>& images) const {
+		const PipelineStage& last = getStage(output);
+		const int tilesX = (last.width + tileWidth - 1) / tileWidth;
+		const int tilesY = (last.height + tileHeight - 1) / tileHeight;
+		const size_t stageCount = static_cast<size_t>(output) + 1ULL;
+		std::atomic<bool> succeeded{ true };
+
+		parallelForBands(0, tilesX * tilesY, [&](int tileBegin, int tileEnd) {
+			// Per band scratch, reused by every tile of the band
+			std::vector<ui::Rect> regions(stageCount);
+			std::vector<PipelineTile> tiles(stageCount);
+			std::vector<std::vector<unsigned char>> buffers(stageCount);
+			std::vector<std::vector<unsigned char>> scratches(stageCount);
+			std::vector<PipelineTile> inputs{};
+
+			for (int tile = tileBegin; tile < tileEnd && succeeded; tile++) {
+				const ui::Rect tileRegion = ui::Rect{ { (tile % tilesX) * tileWidth, (tile / tilesX) * tileHeight }, { tileWidth, tileHeight } }.intersected({ { 0, 0 }, { last.width, last.height } });
+
+				// Backwards: the region every stage has to produce for this tile
+				std::fill(regions.begin(), regions.end(), ui::Rect{});
+				regions[static_cast<size_t>(output)] = tileRegion;
+				for (int id = output; id >= 0; id--) {
+					const ui::Rect& region = regions[static_cast<size_t>(id)];
+					const PipelineStage& stage = stages[static_cast<size_t>(id)];
+					if (!region.isValid() || images[static_cast<size_t>(id)].hasData())
+						continue;
+
+					for (size_t input = 0ULL; input < stage.inputs.size(); input++) {
+						const PipelineStage& producer = stages[static_cast<size_t>(stage.inputs[input])];
+						const ui::Rect needed = stage.footprint(region, static_cast<int>(input)).intersected({ { 0, 0 }, { producer.width, producer.height } });
+						ui::Rect& produced = regions[static_cast<size_t>(stage.inputs[input])];
+						if (needed.isValid())
+							produced = produced.isValid() ? produced.merged(needed) : needed;
+					}
+				}
+
+				// Forwards: stages with pixels are read in place (and copied when they are the output), the output stage
+				// writes straight into the destination
+				for (int id = 0; id <= output; id++) {
+					const ui::Rect& region = regions[static_cast<size_t>(id)];
+					const PipelineStage& stage = stages[static_cast<size_t>(id)];
+					if (!region.isValid())
+						continue;
+
+					PipelineTile& result = tiles[static_cast<size_t>(id)];
+					result.region = region;
+					if (images[static_cast<size_t>(id)].hasData()) {
+						result.view = images[static_cast<size_t>(id)].subView(region);
+						if (id == output)
+							copyPixels(result.view, destination.subView(region));
+						continue;
+					}
+					if (id == output)
+						result.view = destination.subView(region);
+					else {
+						std::vector<unsigned char>& buffer = buffers[static_cast<size_t>(id)];
+						buffer.resize(static_cast<size_t>(region.width()) * static_cast<size_t>(region.height()) * static_cast<size_t>(stage.channels));
+						result.view = ImageView(buffer.data(), region.width(), region.height(), stage.channels);
+					}
+					result.scratch = &scratches[static_cast<size_t>(id)];
+
+					inputs.clear();
+					for (int input : stage.inputs)
+						inputs.push_back(tiles[static_cast<size_t>(input)]);
+					if (!stage.compute(inputs, result)) {
+						succeeded = false;
+						break;
+					}
+				}
+			}
+		}, 1);
+
+		return succeeded;
+	}
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+// Dependencies | std
+#include <functional>
+#include <vector>
+
+// Dependencies | core
+#include <core/Rect.h>
+
+// Dependencies | media
+#include <media/Convolution.h>
+#include <media/Image.h>
+#include <media/Lut.h>
+#include <media/Resample.h>
+
+namespace it {
+	// Structs
+	// Pixels of one stage over a region of its image (view covers exactly region)
+	struct PipelineTile {
+		// Properties
+		ImageView view{ nullptr, 0, 0, 0 };
+		ui::Rect region{};
+		std::vector<unsigned char>* scratch{ nullptr }; // Output tiles only: working memory owned by the computing band
+	};
+
+	// One node of a pipeline graph. Sources only set image; operations set the output size, their inputs (ids of earlier
+	// stages), the footprint (region of input `input` that computing `region` reads; the scheduler clips it to the
+	// input) and compute, which fills output from input tiles that cover at least their footprints. Untiled stages skip
+	// the footprint: before the tiles run, their inputs are produced whole and compute runs once over the whole image.
+	struct PipelineStage {
+		// Properties
+		int width{ 0 };
+		int height{ 0 };
+		int channels{ 0 };
+		ImageView image{ nullptr, 0, 0, 0 };
+		std::vector<int> inputs{};
+		std::function<ui::Rect(const ui::Rect& region, int input)> footprint{};
+		std::function<bool(const std::vector<PipelineTile>& inputs, const PipelineTile& output)> compute{};
+		bool untiled{ false }; // For footprints that reach across the image, like wrapping borders
+
+		// Functions
+		bool isSource() const;
+	};
+
+	// class Pipeline
+	// A DAG of 8-bit image operations evaluated tile by tile. For every output tile the scheduler walks the graph
+	// backwards to find the region each stage must produce (the union of its consumers' footprints), then computes the
+	// stages forward into tile-sized scratch buffers that stay in cache, so only untiled stages and their inputs get a
+	// full-size intermediate. Halos are recomputed by neighboring tiles. Tiles are spread over threads.
+	class Pipeline {
+		// Object
+		private:
+			// Properties
+			std::vector<PipelineStage> stages{};
+
+		public:
+			// Getters
+			int getStageCount() const;
+			const PipelineStage& getStage(int stage) const;
+
+			// Functions | graph (each returns the id of the new stage, or -1 if its inputs are invalid)
+			int addSource(const ImageView& image); // Read in place; must outlive every run
+			int addStage(const PipelineStage& stage);
+			int addLut(int input, const ChannelLuts& luts);
+			int addConvolution(int input, const ConvolutionKernel& kernel, const ConvolutionOptions& options = {});
+			int addGaussianBlur(int input, float sigma, BorderMode border = BorderMode::CLAMP); // Premultiplied by alpha for gray alpha and RGBA
+			int addResize(int input, int width, int height, ResampleFilter filter = ResampleFilter::BICUBIC);
+			int addComposite(int background, int foreground); // Foreground over background, both gray + alpha or RGBA
+			void clear();
+
+			// Functions | execution
+			// Computes stage output into destination, which must have its size and channels and must not share pixels
+			// with a source
+			bool run(int output, const ImageView& destination, int tileWidth = 256, int tileHeight = 64) const;
+
+		private:
+			// Functions
+			// Tiled pass; stages with pixels in images (sources and untiled stages already computed) are read in place
+			bool runTiles(int output, const ImageView& destination, int tileWidth, int tileHeight, const std::vector<ImageView>& images) const;
+	};
+}
@@ -0,0 +1,333 @@
+#include "Quantization.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+// Dependencies | core
+#include <core/Parallel.h>
+
+namespace it {
+	namespace {
+		// Open addressing table of the exact pass, 4 slots per palette color at most
+		constexpr int HASH_BITS{ 10 };
+		constexpr unsigned int HASH_MASK{ (1U << HASH_BITS) - 1U };
+		// Histogram bins: 5 bits of red, green and blue, 4 of alpha, and one more for fully transparent pixels so they do
+		// not share a bin with near transparent black
+		constexpr int TRANSPARENT_BIN{ 1 << 19 };
+		constexpr int BIN_COUNT{ TRANSPARENT_BIN + 1 };
+		// Pixels per parallel range
+		constexpr int PARALLEL_GRAIN{ 65536 };
+
+		// Rows of RGB or RGBA pixels
+		struct Pixels {
+			const unsigned char* data{ nullptr };
+			size_t stride{ 0 };
+			int width{ 0 };
+			int height{ 0 };
+
+			const unsigned char* row(int y) const {
+				return data + static_cast<size_t>(y) * stride;
+			}
+		};
+
+		// RGBA packed red first; RGB pixels are opaque
+		template<int CHANNELS>
+		std::uint32_t colorAt(const unsigned char* pixel) {
+			const std::uint32_t alpha = CHANNELS == 4 ? pixel[CHANNELS - 1] : 255U;
+			return pixel[0] | (static_cast<std::uint32_t>(pixel[1]) << 8) | (static_cast<std::uint32_t>(pixel[2]) << 16) | (alpha << 24);
+		}
+		glm::u8vec4 unpack(std::uint32_t color) {
+			return { color & 0xFFU, (color >> 8) & 0xFFU, (color >> 16) & 0xFFU, color >> 24 };
+		}
+		int binOf(std::uint32_t color) {
+			const std::uint32_t alpha = color >> 24;
+			if (alpha == 0U)
+				return TRANSPARENT_BIN;
+			return static_cast<int>(((color & 0xF8U) << 11) | (((color >> 8) & 0xF8U) << 6) | (((color >> 16) & 0xF8U) << 1) | (alpha >> 4));
+		}
+
+		// Keeps the colors as they are when there are few enough; false as soon as there are too many
+		template<int CHANNELS>
+		bool quantizeExactly(const Pixels& source, ImageIndexed& destination, int maximumColors) {
+			std::array<std::uint32_t, 1U << HASH_BITS> keys{};
+			std::array<short, 1U << HASH_BITS> slots{};
+			slots.fill(-1);
+			std::vector<glm::u8vec4> palette;
+
+			// Neighboring pixels mostly repeat, so the last lookup is kept
+			std::uint32_t lastColor{ 0 };
+			int lastIndex{ -1 };
+			unsigned char* indices = destination.getData();
+			for (int y = 0; y < source.height; y++) {
+				const unsigned char* pixel = source.row(y);
+				for (int x = 0; x < source.width; x++, pixel += CHANNELS) {
+					const std::uint32_t color = colorAt<CHANNELS>(pixel);
+					if (color != lastColor || lastIndex < 0) {
+						unsigned int slot = (color * 0x9E3779B1U) >> (32 - HASH_BITS);
+						while (slots[slot] >= 0 && keys[slot] != color)
+							slot = (slot + 1U) & HASH_MASK;
+						if (slots[slot] < 0) {
+							if (static_cast<int>(palette.size()) == maximumColors)
+								return false;
+							keys[slot] = color;
+							slots[slot] = static_cast<short>(palette.size());
+							palette.push_back(unpack(color));
+						}
+						lastColor = color;
+						lastIndex = slots[slot];
+					}
+					*indices++ = static_cast<unsigned char>(lastIndex);
+				}
+			}
+
+			return destination.setPalette(palette);
+		}
+
+		// Averaged color of a histogram bin
+		struct Entry {
+			std::array<float, 4> color{};
+			double weight{ 0.0 };
+			int bin{ 0 };
+		};
+
+		template<int CHANNELS>
+		std::vector<Entry> histogram(const Pixels& source) {
+			// Counts first, then the bins in use get their color sums. Every band of rows fills its own tables, merged at
+			// the end; a band covers at least as many pixels as there are bins.
+			const int bandRows = std::max(1, BIN_COUNT / source.width);
+			std::mutex mergeMutex{};
+			std::vector<std::uint32_t> counts(BIN_COUNT, 0U);
+			parallelForBands(0, source.height, [&](int rowBegin, int rowEnd) {
+				std::vector<std::uint32_t> local(BIN_COUNT, 0U);
+				for (int y = rowBegin; y < rowEnd; y++) {
+					const unsigned char* pixel = source.row(y);
+					for (int x = 0; x < source.width; x++, pixel += CHANNELS)
+						local[binOf(colorAt<CHANNELS>(pixel))]++;
+				}
+
+				std::lock_guard<std::mutex> lock(mergeMutex);
+				for (int bin = 0; bin < BIN_COUNT; bin++)
+					counts[bin] += local[bin];
+			}, bandRows);
+
+			std::vector<std::array<std::uint64_t, 5>> sums;
+			for (int bin = 0; bin < BIN_COUNT; bin++) {
+				if (counts[bin] == 0U)
+					continue;
+				counts[bin] = static_cast<std::uint32_t>(sums.size());
+				sums.push_back({ 0U, 0U, 0U, 0U, static_cast<std::uint64_t>(bin) });
+			}
+			std::vector<std::uint64_t> pixelCounts(sums.size(), 0U);
+			parallelForBands(0, source.height, [&](int rowBegin, int rowEnd) {
+				std::vector<std::array<std::uint64_t, 4>> localSums(sums.size(), { 0U, 0U, 0U, 0U });
+				std::vector<std::uint64_t> localCounts(sums.size(), 0U);
+				for (int y = rowBegin; y < rowEnd; y++) {
+					const unsigned char* pixel = source.row(y);
+					for (int x = 0; x < source.width; x++, pixel += CHANNELS) {
+						const std::uint32_t color = colorAt<CHANNELS>(pixel);
+						const std::uint32_t entry = counts[binOf(color)];
+						// Fully transparent pixels count as transparent black
+						if ((color >> 24) != 0U)
+							for (int channel = 0; channel < 4; channel++)
+								localSums[entry][channel] += (color >> (8 * channel)) & 0xFFU;
+						localCounts[entry]++;
+					}
+				}
+
+				std::lock_guard<std::mutex> lock(mergeMutex);
+				for (size_t entry = 0ULL; entry < sums.size(); entry++) {
+					for (int channel = 0; channel < 4; channel++)
+						sums[entry][channel] += localSums[entry][channel];
+					pixelCounts[entry] += localCounts[entry];
+				}
+			}, bandRows);
+
+			std::vector<Entry> entries(sums.size());
+			for (size_t i = 0ULL; i < sums.size(); i++) {
+				for (int channel = 0; channel < 4; channel++)
+					entries[i].color[channel] = static_cast<float>(static_cast<double>(sums[i][channel]) / static_cast<double>(pixelCounts[i]));
+				entries[i].weight = static_cast<double>(pixelCounts[i]);
+				entries[i].bin = static_cast<int>(sums[i][4]);
+			}
+			return entries;
+		}
+
+		// Entries [begin, end) with their bounds
+		struct Box {
+			int begin{ 0 };
+			int end{ 0 };
+			double weight{ 0.0 };
+			std::array<float, 4> minimum{};
+			std::array<float, 4> maximum{};
+
+			int widestChannel() const {
+				int widest = 0;
+				for (int channel = 1; channel < 4; channel++)
+					if (maximum[channel] - minimum[channel] > maximum[widest] - minimum[widest])
+						widest = channel;
+				return widest;
+			}
+			double score() const {
+				const int channel = widestChannel();
+				return end - begin > 1 ? weight * static_cast<double>(maximum[channel] - minimum[channel]) : 0.0;
+			}
+		};
+
+		Box boxOf(const std::vector<Entry>& entries, int begin, int end) {
+			Box box{ begin, end };
+			box.minimum.fill(std::numeric_limits<float>::max());
+			box.maximum.fill(std::numeric_limits<float>::lowest());
+			for (int i = begin; i < end; i++) {
+				box.weight += entries[i].weight;
+				for (int channel = 0; channel < 4; channel++) {
+					box.minimum[channel] = std::min(box.minimum[channel], entries[i].color[channel]);
+					box.maximum[channel] = std::max(box.maximum[channel], entries[i].color[channel]);
+				}
+			}
+			return box;
+		}
+
+		std::array<float, 4> meanOf(const std::vector<Entry>& entries, const Box& box) {
+			std::array<double, 4> sums{};
+			for (int i = box.begin; i < box.end; i++)
+				for (int channel = 0; channel < 4; channel++)
+					sums[channel] += entries[i].color[channel] * entries[i].weight;
+			std::array<float, 4> mean{};
+			for (int channel = 0; channel < 4; channel++)
+				mean[channel] = static_cast<float>(sums[channel] / box.weight);
+			return mean;
+		}
+
+		std::vector<std::array<float, 4>> medianCut(std::vector<Entry>& entries, int maximumColors) {
+			std::vector<Box> boxes{ boxOf(entries, 0, static_cast<int>(entries.size())) };
+			while (static_cast<int>(boxes.size()) < maximumColors) {
+				const auto widest = std::max_element(boxes.begin(), boxes.end(), [](const Box& first, const Box& second) {
+					return first.score() < second.score();
+				});
+				if (widest->score() <= 0.0)
+					break;
+
+				// Weighted median along the widest channel, both halves keep at least one entry
+				const Box box = *widest;
+				const int channel = box.widestChannel();
+				std::sort(entries.begin() + box.begin, entries.begin() + box.end, [channel](const Entry& first, const Entry& second) {
+					return first.color[channel] < second.color[channel];
+				});
+				int split = box.begin + 1;
+				double weight = entries[box.begin].weight;
+				while (split < box.end - 1 && weight + entries[split].weight <= box.weight * 0.5) {
+					weight += entries[split].weight;
+					split++;
+				}
+
+				*widest = boxOf(entries, box.begin, split);
+				boxes.push_back(boxOf(entries, split, box.end));
+			}
+
+			std::vector<std::array<float, 4>> palette;
+			for (const Box& box : boxes)
+				palette.push_back(meanOf(entries, box));
+			return palette;
+		}
+
+		int nearest(const std::array<float, 4>& color, const std::vector<std::array<float, 4>>& palette) {
+			int best = 0;
+			float bestDistance = std::numeric_limits<float>::max();
+			for (size_t i = 0ULL; i < palette.size(); i++) {
+				float distance = 0.0f;
+				for (int channel = 0; channel < 4; channel++) {
+					const float difference = color[channel] - palette[i][channel];
+					distance += difference * difference;
+				}
+				if (distance < bestDistance) {
+					bestDistance = distance;
+					best = static_cast<int>(i);
+				}
+			}
+			return best;
+		}
+
+		// Lloyd iterations over the histogram entries, weighted by their pixel counts
+		void refine(const std::vector<Entry>& entries, std::vector<std::array<float, 4>>& palette, int iterations) {
+			std::vector<int> assignment(entries.size(), -1);
+			for (int iteration = 0; iteration < iterations; iteration++) {
+				std::vector<std::array<double, 5>> sums(palette.size(), { 0.0, 0.0, 0.0, 0.0, 0.0 });
+				bool moved = false;
+				for (size_t i = 0ULL; i < entries.size(); i++) {
+					const int cluster = nearest(entries[i].color, palette);
+					moved |= cluster != assignment[i];
+					assignment[i] = cluster;
+					for (int channel = 0; channel < 4; channel++)
+						sums[cluster][channel] += entries[i].color[channel] * entries[i].weight;
+					sums[cluster][4] += entries[i].weight;
+				}
+				if (!moved)
+					break;
+
+				for (size_t cluster = 0ULL; cluster < palette.size(); cluster++)
+					if (sums[cluster][4] > 0.0)
+						for (int channel = 0; channel < 4; channel++)
+							palette[cluster][channel] = static_cast<float>(sums[cluster][channel] / sums[cluster][4]);
+			}
+		}
+
+		template<int CHANNELS>
+		bool quantizePixels(const Pixels& source, ImageIndexed& destination, const QuantizationOptions& options) {
+			// Error check
+			if (source.data == nullptr || source.width <= 0 || source.height <= 0)
+				return false;
+			if (options.maximumColors < 1 || options.maximumColors > ImageIndexed::MAXIMUM_PALETTE_SIZE)
+				return false;
+			if ((destination.getWidth() != source.width || destination.getHeight() != source.height) && destination.allocate(source.width, source.height) == nullptr)
+				return false;
+
+			if (quantizeExactly<CHANNELS>(source, destination, options.maximumColors))
+				return true;
+
+			std::vector<Entry> entries = histogram<CHANNELS>(source);
+			std::vector<std::array<float, 4>> colors = medianCut(entries, options.maximumColors);
+			if (options.method == QuantizationMethod::K_MEANS)
+				refine(entries, colors, options.iterations);
+
+			std::vector<glm::u8vec4> palette;
+			for (const std::array<float, 4>& color : colors) {
+				glm::u8vec4 rounded;
+				for (int channel = 0; channel < 4; channel++)
+					rounded[channel] = static_cast<unsigned char>(std::clamp(color[channel] + 0.5f, 0.0f, 255.0f));
+				if (CHANNELS == 3)
+					rounded.a = 255U;
+				palette.push_back(rounded);
+			}
+			if (!destination.setPalette(palette))
+				return false;
+
+			// Every bin in use maps to the palette color nearest to its average
+			std::vector<unsigned char> binIndices(BIN_COUNT, 0U);
+			for (const Entry& entry : entries)
+				binIndices[entry.bin] = static_cast<unsigned char>(nearest(entry.color, colors));
+
+			parallelFor(0, source.height, [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd; y++) {
+					const unsigned char* pixel = source.row(y);
+					unsigned char* indices = destination.getData() + static_cast<size_t>(y) * static_cast<size_t>(source.width);
+					for (int x = 0; x < source.width; x++, pixel += CHANNELS)
+						indices[x] = binIndices[binOf(colorAt<CHANNELS>(pixel))];
+				}
+			}, std::max(1, PARALLEL_GRAIN / source.width));
+			return true;
+		}
+	}
+
+	// Functions | quantization
+	bool quantize(const ImageViewRGBA& source, ImageIndexed& destination, const QuantizationOptions& options) {
+		return quantizePixels<4>({ reinterpret_cast<const unsigned char*>(source.data), source.stride, source.width, source.height }, destination, options);
+	}
+	bool quantize(const ImageViewRGB& source, ImageIndexed& destination, const QuantizationOptions& options) {
+		return quantizePixels<3>({ reinterpret_cast<const unsigned char*>(source.data), source.stride, source.width, source.height }, destination, options);
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Enums
+	enum class QuantizationMethod {
+		MEDIAN_CUT,	// Splits the color box with the largest spread at its weighted median until the palette is full
+		K_MEANS		// Median cut, then k-means iterations over the color histogram
+	};
+
+	// Structs
+	struct QuantizationOptions {
+		// Properties
+		int maximumColors{ 256 };	// 1 to ImageIndexed::MAXIMUM_PALETTE_SIZE
+		QuantizationMethod method{ QuantizationMethod::MEDIAN_CUT };
+		int iterations{ 8 };		// K-means passes (stops early once no color moves)
+	};
+
+	// Functions | quantization
+	// Images with at most maximumColors distinct colors keep them exactly: one pass collects them in an open addressing
+	// hash table and gives up as soon as there are too many. Otherwise colors are binned at 5 bits per color channel
+	// and 4 for alpha (fully transparent pixels share one bin), the palette is built from the averaged bins and every
+	// bin is mapped to its nearest palette color once, so the pass over the pixels is a table lookup. RGB sources give
+	// opaque palettes. The destination is (re)allocated to the size of the source.
+	bool quantize(const ImageViewRGBA& source, ImageIndexed& destination, const QuantizationOptions& options = {});
+	bool quantize(const ImageViewRGB& source, ImageIndexed& destination, const QuantizationOptions& options = {});
+}
@@ -0,0 +1,663 @@
+#include "Resample.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+#include <vector>
+
+// Dependencies | core
+#include <core/Parallel.h>
+#include <core/Simd.h>
+
+namespace it {
+	namespace {
+		// Weights carry 14 fractional bits, which leaves headroom for negative lobes in 32-bit accumulators
+		constexpr int WEIGHT_BITS{ 14 };
+		constexpr int WEIGHT_ONE{ 1 << WEIGHT_BITS };
+		constexpr int WEIGHT_HALF{ 1 << (WEIGHT_BITS - 1) };
+
+		// Rows per parallel band
+		constexpr int BAND_ROWS{ 8 };
+
+		// Filters
+		double boxFilter(double x) {
+			return (x > -0.5 && x <= 0.5) ? 1.0 : 0.0;
+		}
+		double triangleFilter(double x) {
+			x = std::abs(x);
+			return x < 1.0 ? 1.0 - x : 0.0;
+		}
+		double cubicFilter(double x) {
+			// Keys cubic convolution with a = -0.5 (Catmull-Rom)
+			constexpr double A{ -0.5 };
+			x = std::abs(x);
+			if (x < 1.0)
+				return ((A + 2.0) * x - (A + 3.0)) * x * x + 1.0;
+			if (x < 2.0)
+				return (((x - 5.0) * x + 8.0) * x - 4.0) * A;
+			return 0.0;
+		}
+		double sinc(double x) {
+			if (x == 0.0)
+				return 1.0;
+			x *= std::numbers::pi;
+			return std::sin(x) / x;
+		}
+		double lanczosFilter(double x) {
+			return (x > -3.0 && x < 3.0) ? sinc(x) * sinc(x / 3.0) : 0.0;
+		}
+
+		struct Kernel {
+			double support{ 0.0 };
+			double (*evaluate)(double) { nullptr };
+		};
+		Kernel kernelOf(ResampleFilter filter) {
+			switch (filter) {
+				case ResampleFilter::BOX:
+					return { 0.5, boxFilter };
+				case ResampleFilter::BILINEAR:
+					return { 1.0, triangleFilter };
+				case ResampleFilter::LANCZOS:
+					return { 3.0, lanczosFilter };
+				case ResampleFilter::BICUBIC:
+				default:
+					return { 2.0, cubicFilter };
+			}
+		}
+
+		// Per output coordinate: index of the first source sample and `taps` fixed-point weights. Windows are shifted
+		// to stay inside the source and zero padded, so every tap can be read without bounds checks.
+		struct Weights {
+			int taps{ 0 };
+			std::vector<int> starts{};
+			std::vector<short> coefficients{};
+		};
+		// Only outputs [begin, end) are computed when given (index 0 is then output begin)
+		Weights computeWeights(int sourceSize, int destinationSize, const Kernel& kernel, int begin = 0, int end = -1) {
+			if (end < 0)
+				end = destinationSize;
+			const double scale = static_cast<double>(sourceSize) / static_cast<double>(destinationSize);
+			const double filterScale = std::max(scale, 1.0);
+			const double support = kernel.support * filterScale;
+
+			Weights weights{};
+			weights.taps = std::min(sourceSize, static_cast<int>(std::ceil(support)) * 2 + 1);
+			weights.starts.resize(static_cast<size_t>(end - begin));
+			weights.coefficients.assign(static_cast<size_t>(end - begin) * static_cast<size_t>(weights.taps), 0);
+
+			std::vector<double> buffer(static_cast<size_t>(weights.taps));
+			for (int i = begin; i < end; i++) {
+				const double center = (i + 0.5) * scale;
+				const int first = std::max(static_cast<int>(std::floor(center - support + 0.5)), 0);
+				const int last = std::min(static_cast<int>(std::floor(center + support + 0.5)), sourceSize);
+				const int count = std::clamp(last - first, 1, weights.taps);
+
+				double total{ 0.0 };
+				for (int k = 0; k < count; k++) {
+					buffer[k] = kernel.evaluate((first + k - center + 0.5) / filterScale);
+					total += buffer[k];
+				}
+				if (total == 0.0) {
+					std::fill(buffer.begin(), buffer.begin() + count, 0.0);
+					buffer[count / 2] = total = 1.0;
+				}
+
+				const int start = std::min(first, sourceSize - weights.taps);
+				short* coefficients = weights.coefficients.data() + static_cast<size_t>(i - begin) * static_cast<size_t>(weights.taps) + (first - start);
+
+				// Rounding the running sum keeps the quantized weights summing to exactly WEIGHT_ONE
+				double running{ 0.0 };
+				int quantized{ 0 };
+				for (int k = 0; k < count; k++) {
+					running += buffer[k] / total;
+					const int next = static_cast<int>(std::lround(running * WEIGHT_ONE));
+					coefficients[k] = static_cast<short>(next - quantized);
+					quantized = next;
+				}
+				weights.starts[i - begin] = start;
+			}
+
+			return weights;
+		}
+
+		template<typename T>
+		inline T clampSample(long long accumulator) {
+			constexpr long long MAXIMUM{ std::numeric_limits<T>::max() };
+			return static_cast<T>(std::clamp((accumulator + WEIGHT_HALF) >> WEIGHT_BITS, 0LL, MAXIMUM));
+		}
+
+		// Alpha is always the last channel of two and four channel formats. Those filter color * alpha and alpha * MAXIMUM
+		// in samples of twice the width, so the premultiplied colors keep their full precision through both passes and
+		// are only divided by alpha once, from the accumulators of the vertical pass.
+		template<typename T>
+		using Premultiplied = std::conditional_t<sizeof(T) == 1ULL, unsigned short, unsigned int>;
+
+		template<typename T, int CHANNELS>
+		void premultiply(const T* source, Premultiplied<T>* destination, int width) {
+			constexpr Premultiplied<T> MAXIMUM{ std::numeric_limits<T>::max() };
+			for (int x = 0; x < width; x++, source += CHANNELS, destination += CHANNELS) {
+				const Premultiplied<T> alpha = source[CHANNELS - 1];
+				for (int channel = 0; channel < CHANNELS - 1; channel++)
+					destination[channel] = static_cast<Premultiplied<T>>(source[channel] * alpha);
+				destination[CHANNELS - 1] = static_cast<Premultiplied<T>>(alpha * MAXIMUM);
+			}
+		}
+
+		// Horizontal pass over one row
+		template<typename T, int CHANNELS>
+		void horizontalRow(const T* source, T* destination, int destinationWidth, const Weights& weights) {
+			for (int x = 0; x < destinationWidth; x++) {
+				const T* pixels = source + static_cast<size_t>(weights.starts[x]) * CHANNELS;
+				const short* coefficients = weights.coefficients.data() + static_cast<size_t>(x) * static_cast<size_t>(weights.taps);
+
+				long long accumulators[CHANNELS]{};
+				for (int k = 0; k < weights.taps; k++) {
+					for (int channel = 0; channel < CHANNELS; channel++)
+						accumulators[channel] += coefficients[k] * static_cast<long long>(pixels[k * CHANNELS + channel]);
+				}
+				for (int channel = 0; channel < CHANNELS; channel++)
+					destination[static_cast<size_t>(x) * CHANNELS + channel] = clampSample<T>(accumulators[channel]);
+			}
+		}
+#if defined(IT_SIMD_SSE2)
+		// Premultiplied 8-bit samples use the whole unsigned 16-bit range, so pmaddwd reads them offset by -32768. The
+		// weights of every output sum to WEIGHT_ONE, which turns the offset into a constant 32768 << WEIGHT_BITS that
+		// the final shift and the signed saturation take out again.
+		constexpr short SAMPLE_OFFSET{ static_cast<short>(0x8000) };
+
+		inline __m128i packedWeightPair(short first, short second) {
+			return _mm_set1_epi32(static_cast<int>(static_cast<unsigned short>(first) | (static_cast<unsigned int>(static_cast<unsigned short>(second)) << 16)));
+		}
+		inline __m128i narrowOffsetSums(__m128i sums) {
+			sums = _mm_srai_epi32(sums, WEIGHT_BITS);
+			return _mm_xor_si128(_mm_packs_epi32(sums, sums), _mm_set1_epi16(SAMPLE_OFFSET));
+		}
+
+		// Two taps at a time: the pixels are interleaved channel-wise (r0 r1 g0 g1 ...) so pmaddwd applies both weights
+		template<>
+		void horizontalRow<unsigned short, 4>(const unsigned short* source, unsigned short* destination, int destinationWidth, const Weights& weights) {
+			const __m128i OFFSET = _mm_set1_epi16(SAMPLE_OFFSET);
+			const __m128i ROUNDING = _mm_set1_epi32(WEIGHT_HALF);
+			const int taps = weights.taps;
+
+			for (int x = 0; x < destinationWidth; x++) {
+				const unsigned short* pixels = source + static_cast<size_t>(weights.starts[x]) * 4ULL;
+				const short* coefficients = weights.coefficients.data() + static_cast<size_t>(x) * static_cast<size_t>(taps);
+
+				__m128i sum = ROUNDING;
+				int k = 0;
+				for (; k + 2 <= taps; k += 2) {
+					__m128i pair = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + k * 4)), OFFSET);
+					pair = _mm_unpacklo_epi16(pair, _mm_srli_si128(pair, 8));
+					sum = _mm_add_epi32(sum, _mm_madd_epi16(pair, packedWeightPair(coefficients[k], coefficients[k + 1])));
+				}
+				if (k < taps) {
+					const __m128i single = _mm_unpacklo_epi16(_mm_xor_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pixels + k * 4)), OFFSET), _mm_setzero_si128());
+					sum = _mm_add_epi32(sum, _mm_madd_epi16(single, packedWeightPair(coefficients[k], 0)));
+				}
+
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(destination + static_cast<size_t>(x) * 4ULL), narrowOffsetSums(sum));
+			}
+		}
+		// Four taps at a time, reordered to g0 g1 a0 a1 g2 g3 a2 a3; the two halves of the sums are added at the end
+		template<>
+		void horizontalRow<unsigned short, 2>(const unsigned short* source, unsigned short* destination, int destinationWidth, const Weights& weights) {
+			const __m128i OFFSET = _mm_set1_epi16(SAMPLE_OFFSET);
+			const int taps = weights.taps;
+
+			for (int x = 0; x < destinationWidth; x++) {
+				const unsigned short* pixels = source + static_cast<size_t>(weights.starts[x]) * 2ULL;
+				const short* coefficients = weights.coefficients.data() + static_cast<size_t>(x) * static_cast<size_t>(taps);
+
+				__m128i sum = _mm_setzero_si128();
+				int k = 0;
+				for (; k + 4 <= taps; k += 4) {
+					__m128i quad = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + k * 2)), OFFSET);
+					quad = _mm_shufflehi_epi16(_mm_shufflelo_epi16(quad, _MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0));
+					const __m128i packedWeights = _mm_unpacklo_epi64(packedWeightPair(coefficients[k], coefficients[k + 1]), packedWeightPair(coefficients[k + 2], coefficients[k + 3]));
+					sum = _mm_add_epi32(sum, _mm_madd_epi16(quad, packedWeights));
+				}
+				sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 8));
+				sum = _mm_add_epi32(sum, _mm_set_epi32(0, 0, WEIGHT_HALF, WEIGHT_HALF));
+				for (; k < taps; k++) {
+					const __m128i single = _mm_xor_si128(_mm_cvtsi32_si128(static_cast<int>(pixels[k * 2] | (static_cast<unsigned int>(pixels[k * 2 + 1]) << 16))), OFFSET);
+					sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_unpacklo_epi16(single, _mm_setzero_si128()), _mm_set1_epi32(static_cast<unsigned short>(coefficients[k]))));
+				}
+
+				const int result = _mm_cvtsi128_si32(narrowOffsetSums(sum));
+				std::memcpy(destination + static_cast<size_t>(x) * 2ULL, &result, 4ULL);
+			}
+		}
+#endif
+
+		// Vertical pass producing one output row; the rows are flat sample arrays so every format shares the kernel
+		template<typename T>
+		void verticalRow(const T* const* rows, const short* coefficients, int taps, T* destination, size_t sampleCount) {
+			for (size_t i = 0ULL; i < sampleCount; i++) {
+				long long accumulator{ 0 };
+				for (int k = 0; k < taps; k++)
+					accumulator += coefficients[k] * static_cast<int>(rows[k][i]);
+				destination[i] = clampSample<T>(accumulator);
+			}
+		}
+#if defined(IT_SIMD_SSE2)
+		template<>
+		void verticalRow<unsigned char>(const unsigned char* const* rows, const short* coefficients, int taps, unsigned char* destination, size_t sampleCount) {
+			const __m128i ZERO = _mm_setzero_si128();
+			const __m128i ROUNDING = _mm_set1_epi32(WEIGHT_HALF);
+
+			size_t i = 0ULL;
+			for (; i + 8ULL <= sampleCount; i += 8ULL) {
+				__m128i low = ROUNDING;
+				__m128i high = ROUNDING;
+				int k = 0;
+				for (; k < taps; k += 2) {
+					const bool hasSecond = k + 1 < taps;
+					__m128i first = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(rows[k] + i)), ZERO);
+					__m128i second = hasSecond ? _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(rows[k + 1] + i)), ZERO) : ZERO;
+					const unsigned int secondWeight = hasSecond ? static_cast<unsigned short>(coefficients[k + 1]) : 0U;
+					const __m128i packedWeights = _mm_set1_epi32(static_cast<int>(static_cast<unsigned short>(coefficients[k]) | (secondWeight << 16)));
+					low = _mm_add_epi32(low, _mm_madd_epi16(_mm_unpacklo_epi16(first, second), packedWeights));
+					high = _mm_add_epi32(high, _mm_madd_epi16(_mm_unpackhi_epi16(first, second), packedWeights));
+				}
+				__m128i packed = _mm_packs_epi32(_mm_srai_epi32(low, WEIGHT_BITS), _mm_srai_epi32(high, WEIGHT_BITS));
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(destination + i), _mm_packus_epi16(packed, packed));
+			}
+			for (; i < sampleCount; i++) {
+				int accumulator{ 0 };
+				for (int k = 0; k < taps; k++)
+					accumulator += coefficients[k] * static_cast<int>(rows[k][i]);
+				destination[i] = clampSample<unsigned char>(accumulator);
+			}
+		}
+#endif
+
+		// Takes alpha out of the vertical accumulators of one pixel. 8-bit colors divide in single precision, which is
+		// exact for flat colors and lets the SSE2 kernel below reproduce the result bit for bit.
+		template<typename T, int CHANNELS>
+		inline void unpremultiply(const long long* accumulators, T* destination) {
+			constexpr long long MAXIMUM{ std::numeric_limits<T>::max() };
+			constexpr long long ALPHA_ONE{ MAXIMUM << WEIGHT_BITS }; // Accumulated alpha per unit of output alpha
+			const long long alpha = std::max(accumulators[CHANNELS - 1], 0LL);
+			if constexpr (sizeof(T) == 1ULL) {
+				const float alphaValue = static_cast<float>(alpha);
+				for (int channel = 0; channel < CHANNELS - 1; channel++) {
+					const float color = static_cast<float>(std::max(accumulators[channel], 0LL)) * 255.0f / alphaValue;
+					destination[channel] = alpha == 0LL ? T(0) : static_cast<T>(std::lrint(std::min(color, 255.0f)));
+				}
+				destination[CHANNELS - 1] = static_cast<T>(std::lrint(std::min(alphaValue / static_cast<float>(ALPHA_ONE), 255.0f)));
+			}
+			else {
+				for (int channel = 0; channel < CHANNELS - 1; channel++)
+					destination[channel] = alpha == 0LL ? T(0) : static_cast<T>(std::clamp((accumulators[channel] * MAXIMUM + alpha / 2LL) / alpha, 0LL, MAXIMUM));
+				destination[CHANNELS - 1] = static_cast<T>(std::min((alpha + ALPHA_ONE / 2LL) / ALPHA_ONE, MAXIMUM));
+			}
+		}
+
+		// Vertical pass of premultiplied rows into one output row of width pixels
+		template<typename T, int CHANNELS>
+		void verticalPremultipliedRow(const Premultiplied<T>* const* rows, const short* coefficients, int taps, T* destination, int width) {
+			for (size_t i = 0ULL, end = static_cast<size_t>(width) * CHANNELS; i < end; i += CHANNELS) {
+				long long accumulators[CHANNELS]{};
+				for (int k = 0; k < taps; k++) {
+					for (int channel = 0; channel < CHANNELS; channel++)
+						accumulators[channel] += coefficients[k] * static_cast<long long>(rows[k][i + channel]);
+				}
+				unpremultiply<T, CHANNELS>(accumulators, destination + i);
+			}
+		}
+#if defined(IT_SIMD_SSE2)
+		// 8 samples at a time (2 RGBA or 4 gray alpha pixels). The sums are taken back from the offset samples, clamped
+		// at 0 and divided in single precision exactly like the scalar unpremultiply.
+		template<int CHANNELS>
+		void verticalPremultipliedRowSse2(const unsigned short* const* rows, const short* coefficients, int taps, unsigned char* destination, int width) {
+			const __m128i OFFSET = _mm_set1_epi16(SAMPLE_OFFSET);
+			const __m128i OFFSET_SUM = _mm_set1_epi32(32768 << WEIGHT_BITS);
+			const __m128i ALPHA_LANES = CHANNELS == 4 ? _mm_set_epi32(-1, 0, 0, 0) : _mm_set_epi32(-1, 0, -1, 0);
+			const __m128 MULTIPLIERS = CHANNELS == 4 ? _mm_set_ps(1.0f, 255.0f, 255.0f, 255.0f) : _mm_set_ps(1.0f, 255.0f, 1.0f, 255.0f);
+			const __m128 ALPHA_ONE = _mm_set1_ps(static_cast<float>(255 << WEIGHT_BITS));
+			const __m128 ZERO = _mm_setzero_ps();
+			const __m128 MAXIMUM = _mm_set1_ps(255.0f);
+
+			const auto unpremultiplySums = [&](__m128i sums) {
+				sums = _mm_add_epi32(sums, OFFSET_SUM);
+				sums = _mm_andnot_si128(_mm_srai_epi32(sums, 31), sums);
+				const __m128i alpha = CHANNELS == 4 ? _mm_shuffle_epi32(sums, _MM_SHUFFLE(3, 3, 3, 3)) : _mm_shuffle_epi32(sums, _MM_SHUFFLE(3, 3, 1, 1));
+				const __m128 divisors = _mm_or_ps(_mm_and_ps(_mm_castsi128_ps(ALPHA_LANES), ALPHA_ONE), _mm_andnot_ps(_mm_castsi128_ps(ALPHA_LANES), _mm_cvtepi32_ps(alpha)));
+				__m128 values = _mm_div_ps(_mm_mul_ps(_mm_cvtepi32_ps(sums), MULTIPLIERS), divisors);
+				values = _mm_min_ps(_mm_max_ps(values, ZERO), MAXIMUM);
+				return _mm_andnot_si128(_mm_cmpeq_epi32(alpha, _mm_setzero_si128()), _mm_cvtps_epi32(values));
+			};
+
+			const size_t sampleCount = static_cast<size_t>(width) * CHANNELS;
+			size_t i = 0ULL;
+			for (; i + 8ULL <= sampleCount; i += 8ULL) {
+				__m128i low = _mm_setzero_si128();
+				__m128i high = _mm_setzero_si128();
+				for (int k = 0; k < taps; k += 2) {
+					const bool hasSecond = k + 1 < taps;
+					const __m128i first = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[k] + i)), OFFSET);
+					const __m128i second = hasSecond ? _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[k + 1] + i)), OFFSET) : _mm_setzero_si128();
+					const __m128i packedWeights = packedWeightPair(coefficients[k], hasSecond ? coefficients[k + 1] : short(0));
+					low = _mm_add_epi32(low, _mm_madd_epi16(_mm_unpacklo_epi16(first, second), packedWeights));
+					high = _mm_add_epi32(high, _mm_madd_epi16(_mm_unpackhi_epi16(first, second), packedWeights));
+				}
+				const __m128i packed = _mm_packs_epi32(unpremultiplySums(low), unpremultiplySums(high));
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(destination + i), _mm_packus_epi16(packed, packed));
+			}
+			for (; i < sampleCount; i += CHANNELS) {
+				long long accumulators[CHANNELS]{};
+				for (int k = 0; k < taps; k++) {
+					for (int channel = 0; channel < CHANNELS; channel++)
+						accumulators[channel] += coefficients[k] * static_cast<long long>(rows[k][i + channel]);
+				}
+				unpremultiply<unsigned char, CHANNELS>(accumulators, destination + i);
+			}
+		}
+		template<>
+		void verticalPremultipliedRow<unsigned char, 2>(const unsigned short* const* rows, const short* coefficients, int taps, unsigned char* destination, int width) {
+			verticalPremultipliedRowSse2<2>(rows, coefficients, taps, destination, width);
+		}
+		template<>
+		void verticalPremultipliedRow<unsigned char, 4>(const unsigned short* const* rows, const short* coefficients, int taps, unsigned char* destination, int width) {
+			verticalPremultipliedRowSse2<4>(rows, coefficients, taps, destination, width);
+		}
+#endif
+
+		// Row y of a strided sample array
+		template<typename T>
+		T* rowAt(T* samples, int y, size_t stride) {
+			using Byte = std::conditional_t<std::is_const_v<T>, const unsigned char, unsigned char>;
+			return reinterpret_cast<T*>(reinterpret_cast<Byte*>(samples) + static_cast<size_t>(y) * stride);
+		}
+
+		// Integer downscale with a box filter: every output pixel is the (alpha weighted) mean of a factorX x factorY block
+		template<typename T, int CHANNELS>
+		void boxDownscale(const T* source, int sourceWidth, size_t sourceStride, T* destination, int destinationWidth, int destinationHeight, size_t destinationStride, int factorX, int factorY) {
+			constexpr bool HAS_ALPHA{ CHANNELS == 2 || CHANNELS == 4 };
+			const size_t sourceRowSamples = static_cast<size_t>(sourceWidth) * CHANNELS;
+			const unsigned long long blockSize = static_cast<unsigned long long>(factorX) * static_cast<unsigned long long>(factorY);
+
+			parallelForBands(0, destinationHeight, [&](int rowBegin, int rowEnd) {
+				std::vector<unsigned long long> sums(sourceRowSamples);
+				for (int y = rowBegin; y < rowEnd; y++) {
+					// Column sums over the block rows, colors pre-weighted by alpha
+					std::fill(sums.begin(), sums.end(), 0ULL);
+					for (int row = 0; row < factorY; row++) {
+						const T* pixels = rowAt(source, y * factorY + row, sourceStride);
+						for (size_t i = 0ULL; i < sourceRowSamples; i += CHANNELS) {
+							const unsigned long long alpha = HAS_ALPHA ? pixels[i + CHANNELS - 1] : 1ULL;
+							for (int channel = 0; channel < CHANNELS; channel++)
+								sums[i + channel] += (HAS_ALPHA && channel != CHANNELS - 1) ? pixels[i + channel] * alpha : pixels[i + channel];
+						}
+					}
+
+					T* output = rowAt(destination, y, destinationStride);
+					for (int x = 0; x < destinationWidth; x++) {
+						unsigned long long block[CHANNELS]{};
+						for (int column = 0; column < factorX; column++) {
+							for (int channel = 0; channel < CHANNELS; channel++)
+								block[channel] += sums[static_cast<size_t>(x * factorX + column) * CHANNELS + channel];
+						}
+
+						if constexpr (HAS_ALPHA) {
+							const unsigned long long alphaSum = block[CHANNELS - 1];
+							for (int channel = 0; channel < CHANNELS - 1; channel++)
+								output[channel] = alphaSum == 0ULL ? T(0) : static_cast<T>((block[channel] + alphaSum / 2ULL) / alphaSum);
+							output[CHANNELS - 1] = static_cast<T>((alphaSum + blockSize / 2ULL) / blockSize);
+						}
+						else {
+							for (int channel = 0; channel < CHANNELS; channel++)
+								output[channel] = static_cast<T>((block[channel] + blockSize / 2ULL) / blockSize);
+						}
+						output += CHANNELS;
+					}
+				}
+			}, BAND_ROWS);
+		}
+
+		// Computes destinationRegion of the full sourceWidth x sourceHeight -> destinationWidth x destinationHeight resample.
+		// source points at the pixel sourceRegion.position of the source and must cover every window the region reads.
+		template<typename T, int CHANNELS>
+		bool resampleRegion(const T* source, size_t sourceStride, const ui::Rect& sourceRegion, int sourceWidth, int sourceHeight, T* destination, size_t destinationStride, const ui::Rect& destinationRegion, int destinationWidth, int destinationHeight, ResampleFilter filter) {
+			constexpr bool HAS_ALPHA{ CHANNELS == 2 || CHANNELS == 4 };
+
+			const Kernel kernel = kernelOf(filter);
+			Weights horizontal = computeWeights(sourceWidth, destinationWidth, kernel, destinationRegion.left(), destinationRegion.right());
+			Weights vertical = computeWeights(sourceHeight, destinationHeight, kernel, destinationRegion.top(), destinationRegion.bottom());
+
+			// Windows relative to the source region
+			for (int& start : horizontal.starts)
+				start -= sourceRegion.x();
+			for (int& start : vertical.starts)
+				start -= sourceRegion.y();
+
+			// Error check
+			if (horizontal.starts.front() < 0 || horizontal.starts.back() + horizontal.taps > sourceRegion.width() || vertical.starts.front() < 0 || vertical.starts.back() + vertical.taps > sourceRegion.height())
+				return false;
+
+			const int regionWidth = destinationRegion.width();
+			const int regionHeight = destinationRegion.height();
+
+			// Horizontal pass into an intermediate covering only the source rows the vertical taps read, premultiplied in
+			// wide integers for formats with alpha
+			using Intermediate = std::conditional_t<HAS_ALPHA, Premultiplied<T>, T>;
+			const int firstRow = vertical.starts.front();
+			const int lastRow = vertical.starts.back() + vertical.taps;
+			const size_t sourceRowSamples = static_cast<size_t>(sourceRegion.width()) * CHANNELS;
+			const size_t intermediateRowSamples = static_cast<size_t>(regionWidth) * CHANNELS;
+			std::vector<Intermediate> intermediate(static_cast<size_t>(lastRow - firstRow) * intermediateRowSamples);
+
+			parallelForBands(firstRow, lastRow, [&](int rowBegin, int rowEnd) {
+				std::vector<Intermediate> premultiplied(HAS_ALPHA ? sourceRowSamples : 0ULL);
+				for (int y = rowBegin; y < rowEnd; y++) {
+					Intermediate* output = intermediate.data() + static_cast<size_t>(y - firstRow) * intermediateRowSamples;
+					if constexpr (HAS_ALPHA) {
+						premultiply<T, CHANNELS>(rowAt(source, y, sourceStride), premultiplied.data(), sourceRegion.width());
+						horizontalRow<Intermediate, CHANNELS>(premultiplied.data(), output, regionWidth, horizontal);
+					}
+					else {
+						horizontalRow<T, CHANNELS>(rowAt(source, y, sourceStride), output, regionWidth, horizontal);
+					}
+				}
+			}, BAND_ROWS);
+
+			// Vertical pass
+			parallelForBands(0, regionHeight, [&](int rowBegin, int rowEnd) {
+				std::vector<const Intermediate*> rows(static_cast<size_t>(vertical.taps));
+				for (int y = rowBegin; y < rowEnd; y++) {
+					for (int k = 0; k < vertical.taps; k++)
+						rows[k] = intermediate.data() + static_cast<size_t>(vertical.starts[y] - firstRow + k) * intermediateRowSamples;
+
+					T* output = rowAt(destination, y, destinationStride);
+					const short* coefficients = vertical.coefficients.data() + static_cast<size_t>(y) * static_cast<size_t>(vertical.taps);
+					if constexpr (HAS_ALPHA)
+						verticalPremultipliedRow<T, CHANNELS>(rows.data(), coefficients, vertical.taps, output, regionWidth);
+					else
+						verticalRow<T>(rows.data(), coefficients, vertical.taps, output, intermediateRowSamples);
+				}
+			}, BAND_ROWS);
+
+			return true;
+		}
+
+		template<typename T, int CHANNELS>
+		bool resample(const T* source, int sourceWidth, int sourceHeight, size_t sourceStride, T* destination, int destinationWidth, int destinationHeight, size_t destinationStride, ResampleFilter filter) {
+			// Error check
+			if (source == nullptr || destination == nullptr || sourceWidth <= 0 || sourceHeight <= 0 || destinationWidth <= 0 || destinationHeight <= 0)
+				return false;
+
+			// Fast paths
+			if (sourceWidth == destinationWidth && sourceHeight == destinationHeight) {
+				for (int y = 0; y < sourceHeight; y++)
+					std::memcpy(rowAt(destination, y, destinationStride), rowAt(source, y, sourceStride), static_cast<size_t>(sourceWidth) * CHANNELS * sizeof(T));
+				return true;
+			}
+			if (filter == ResampleFilter::BOX && sourceWidth % destinationWidth == 0 && sourceHeight % destinationHeight == 0) {
+				boxDownscale<T, CHANNELS>(source, sourceWidth, sourceStride, destination, destinationWidth, destinationHeight, destinationStride, sourceWidth / destinationWidth, sourceHeight / destinationHeight);
+				return true;
+			}
+
+			const ui::Rect sourceRegion{ { 0, 0 }, { sourceWidth, sourceHeight } };
+			const ui::Rect destinationRegion{ { 0, 0 }, { destinationWidth, destinationHeight } };
+			return resampleRegion<T, CHANNELS>(source, sourceStride, sourceRegion, sourceWidth, sourceHeight, destination, destinationStride, destinationRegion, destinationWidth, destinationHeight, filter);
+		}
+
+		template<int CHANNELS, typename Image>
+		bool resizeImage(const Image& source, Image& destination, int width, int height, ResampleFilter filter) {
+			using Sample = std::conditional_t<sizeof(*source.getData()) / CHANNELS == 2, unsigned short, unsigned char>;
+
+			// Error check
+			if (&source == &destination || !source.isAllocated() || width <= 0 || height <= 0)
+				return false;
+
+			if ((destination.getWidth() != width || destination.getHeight() != height) && destination.allocate(width, height) == nullptr)
+				return false;
+
+			return resample<Sample, CHANNELS>(
+				reinterpret_cast<const Sample*>(source.getData()), source.getWidth(), source.getHeight(), static_cast<size_t>(source.getWidth()) * sizeof(*source.getData()),
+				reinterpret_cast<Sample*>(destination.getData()), width, height, static_cast<size_t>(width) * sizeof(*destination.getData()), filter
+			);
+		}
+
+		template<int CHANNELS>
+		bool resizeViewRegion(const ImageView& source, const ui::Rect& sourceRegion, int sourceWidth, int sourceHeight, const ImageView& destination, const ui::Rect& destinationRegion, int destinationWidth, int destinationHeight, ResampleFilter filter) {
+			// Equal sizes copy (the filters would reproduce the source anyway)
+			if (sourceWidth == destinationWidth && sourceHeight == destinationHeight) {
+				const int offsetX = destinationRegion.x() - sourceRegion.x();
+				const int offsetY = destinationRegion.y() - sourceRegion.y();
+				if (offsetX < 0 || offsetY < 0 || offsetX + destinationRegion.width() > sourceRegion.width() || offsetY + destinationRegion.height() > sourceRegion.height())
+					return false;
+				for (int y = 0; y < destinationRegion.height(); y++)
+					std::memcpy(destination.row(y), source.pixelAt(offsetX, offsetY + y), static_cast<size_t>(destinationRegion.width()) * CHANNELS);
+				return true;
+			}
+
+			return resampleRegion<unsigned char, CHANNELS>(
+				source.data, source.stride, sourceRegion, sourceWidth, sourceHeight,
+				destination.data, destination.stride, destinationRegion, destinationWidth, destinationHeight, filter
+			);
+		}
+
+		template<int CHANNELS, typename View>
+		bool resizeView(const View& source, const View& destination, ResampleFilter filter) {
+			// Error check
+			if (!source.hasData() || !destination.hasData() || source.data == destination.data)
+				return false;
+
+			return resample<unsigned char, CHANNELS>(
+				reinterpret_cast<const unsigned char*>(source.data), source.width, source.height, source.stride,
+				reinterpret_cast<unsigned char*>(destination.data), destination.width, destination.height, destination.stride, filter
+			);
+		}
+	}
+
+	// Functions | resampling
+	bool resize(const ImageGray& source, ImageGray& destination, int width, int height, ResampleFilter filter) {
+		return resizeImage<1>(source, destination, width, height, filter);
+	}
+	bool resize(const ImageGrayAlpha& source, ImageGrayAlpha& destination, int width, int height, ResampleFilter filter) {
+		return resizeImage<2>(source, destination, width, height, filter);
+	}
+	bool resize(const ImageRGB& source, ImageRGB& destination, int width, int height, ResampleFilter filter) {
+		return resizeImage<3>(source, destination, width, height, filter);
+	}
+	bool resize(const ImageRGBA& source, ImageRGBA& destination, int width, int height, ResampleFilter filter) {
+		return resizeImage<4>(source, destination, width, height, filter);
+	}
+	bool resize(const ImageGray16& source, ImageGray16& destination, int width, int height, ResampleFilter filter) {
+		return resizeImage<1>(source, destination, width, height, filter);
+	}
+	bool resize(const ImageGrayAlpha16& source, ImageGrayAlpha16& destination, int width, int height, ResampleFilter filter) {
+		return resizeImage<2>(source, destination, width, height, filter);
+	}
+	bool resize(const ImageRGB16& source, ImageRGB16& destination, int width, int height, ResampleFilter filter) {
+		return resizeImage<3>(source, destination, width, height, filter);
+	}
+	bool resize(const ImageRGBA16& source, ImageRGBA16& destination, int width, int height, ResampleFilter filter) {
+		return resizeImage<4>(source, destination, width, height, filter);
+	}
+
+	// Functions | resampling into existing pixels
+	bool resize(const ImageView& source, const ImageView& destination, ResampleFilter filter) {
+		if (source.channels != destination.channels)
+			return false;
+
+		switch (source.channels) {
+			case 1:
+				return resizeView<1>(source, destination, filter);
+			case 2:
+				return resizeView<2>(source, destination, filter);
+			case 3:
+				return resizeView<3>(source, destination, filter);
+			case 4:
+				return resizeView<4>(source, destination, filter);
+			default:
+				return false;
+		}
+	}
+	bool resize(const ImageViewGray& source, const ImageViewGray& destination, ResampleFilter filter) {
+		return resizeView<1>(source, destination, filter);
+	}
+	bool resize(const ImageViewGrayAlpha& source, const ImageViewGrayAlpha& destination, ResampleFilter filter) {
+		return resizeView<2>(source, destination, filter);
+	}
+	bool resize(const ImageViewRGB& source, const ImageViewRGB& destination, ResampleFilter filter) {
+		return resizeView<3>(source, destination, filter);
+	}
+	bool resize(const ImageViewRGBA& source, const ImageViewRGBA& destination, ResampleFilter filter) {
+		return resizeView<4>(source, destination, filter);
+	}
+
+	// Functions | regions
+	ui::Rect resizeFootprint(int sourceWidth, int sourceHeight, int destinationWidth, int destinationHeight, const ui::Rect& destinationRegion, ResampleFilter filter) {
+		// Error check
+		if (sourceWidth <= 0 || sourceHeight <= 0 || destinationWidth <= 0 || destinationHeight <= 0)
+			return {};
+
+		const ui::Rect region = destinationRegion.intersected({ { 0, 0 }, { destinationWidth, destinationHeight } });
+		if (!region.isValid())
+			return {};
+		if (sourceWidth == destinationWidth && sourceHeight == destinationHeight)
+			return region;
+
+		// Windows only move forward with the output coordinate, so the first and last outputs bound the footprint
+		const Kernel kernel = kernelOf(filter);
+		const Weights left = computeWeights(sourceWidth, destinationWidth, kernel, region.left(), region.left() + 1);
+		const Weights right = computeWeights(sourceWidth, destinationWidth, kernel, region.right() - 1, region.right());
+		const Weights top = computeWeights(sourceHeight, destinationHeight, kernel, region.top(), region.top() + 1);
+		const Weights bottom = computeWeights(sourceHeight, destinationHeight, kernel, region.bottom() - 1, region.bottom());
+		return {
+			{ left.starts.front(), top.starts.front() },
+			{ right.starts.front() + right.taps - left.starts.front(), bottom.starts.front() + bottom.taps - top.starts.front() }
+		};
+	}
+	bool resizeRegion(const ImageView& source, const ui::Rect& sourceRegion, int sourceWidth, int sourceHeight, const ImageView& destination, const ui::Rect& destinationRegion, int destinationWidth, int destinationHeight, ResampleFilter filter) {
+		// Error check
+		if (!source.hasData() || !destination.hasData() || source.channels != destination.channels || source.data == destination.data)
+			return false;
+		if (sourceWidth <= 0 || sourceHeight <= 0 || destinationWidth <= 0 || destinationHeight <= 0)
+			return false;
+		if (source.width != sourceRegion.width() || source.height != sourceRegion.height() || destination.width != destinationRegion.width() || destination.height != destinationRegion.height())
+			return false;
+		if (!destinationRegion.isValid() || !ui::Rect{ { 0, 0 }, { destinationWidth, destinationHeight } }.contains(destinationRegion))
+			return false;
+
+		switch (source.channels) {
+			case 1:
+				return resizeViewRegion<1>(source, sourceRegion, sourceWidth, sourceHeight, destination, destinationRegion, destinationWidth, destinationHeight, filter);
+			case 2:
+				return resizeViewRegion<2>(source, sourceRegion, sourceWidth, sourceHeight, destination, destinationRegion, destinationWidth, destinationHeight, filter);
+			case 3:
+				return resizeViewRegion<3>(source, sourceRegion, sourceWidth, sourceHeight, destination, destinationRegion, destinationWidth, destinationHeight, filter);
+			case 4:
+				return resizeViewRegion<4>(source, sourceRegion, sourceWidth, sourceHeight, destination, destinationRegion, destinationWidth, destinationHeight, filter);
+			default:
+				return false;
+		}
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Enums
+	enum class ResampleFilter {
+		BOX,
+		BILINEAR,
+		BICUBIC,
+		LANCZOS
+	};
+
+	// Functions | resampling
+	// Separable two-pass resampler. Weights are precomputed per output row and column and accumulated in fixed point;
+	// colors are premultiplied by alpha while filtering. BOX with integer downscale factors takes a direct averaging path.
+	// The destination is (re)allocated to width x height.
+	bool resize(const ImageGray& source, ImageGray& destination, int width, int height, ResampleFilter filter = ResampleFilter::BICUBIC);
+	bool resize(const ImageGrayAlpha& source, ImageGrayAlpha& destination, int width, int height, ResampleFilter filter = ResampleFilter::BICUBIC);
+	bool resize(const ImageRGB& source, ImageRGB& destination, int width, int height, ResampleFilter filter = ResampleFilter::BICUBIC);
+	bool resize(const ImageRGBA& source, ImageRGBA& destination, int width, int height, ResampleFilter filter = ResampleFilter::BICUBIC);
+	bool resize(const ImageGray16& source, ImageGray16& destination, int width, int height, ResampleFilter filter = ResampleFilter::BICUBIC);
+	bool resize(const ImageGrayAlpha16& source, ImageGrayAlpha16& destination, int width, int height, ResampleFilter filter = ResampleFilter::BICUBIC);
+	bool resize(const ImageRGB16& source, ImageRGB16& destination, int width, int height, ResampleFilter filter = ResampleFilter::BICUBIC);
+	bool resize(const ImageRGBA16& source, ImageRGBA16& destination, int width, int height, ResampleFilter filter = ResampleFilter::BICUBIC);
+
+	// Functions | resampling into existing pixels (the destination view size is the output size)
+	bool resize(const ImageView& source, const ImageView& destination, ResampleFilter filter = ResampleFilter::BICUBIC);
+	bool resize(const ImageViewGray& source, const ImageViewGray& destination, ResampleFilter filter = ResampleFilter::BICUBIC);
+	bool resize(const ImageViewGrayAlpha& source, const ImageViewGrayAlpha& destination, ResampleFilter filter = ResampleFilter::BICUBIC);
+	bool resize(const ImageViewRGB& source, const ImageViewRGB& destination, ResampleFilter filter = ResampleFilter::BICUBIC);
+	bool resize(const ImageViewRGBA& source, const ImageViewRGBA& destination, ResampleFilter filter = ResampleFilter::BICUBIC);
+
+	// Functions | regions (tiled processing)
+	// Source pixels that destinationRegion of a sourceWidth x sourceHeight -> destinationWidth x destinationHeight resize reads
+	ui::Rect resizeFootprint(int sourceWidth, int sourceHeight, int destinationWidth, int destinationHeight, const ui::Rect& destinationRegion, ResampleFilter filter = ResampleFilter::BICUBIC);
+	// Computes only destinationRegion of that resize into destination (the size of the region). source holds the source
+	// pixels of sourceRegion, which must contain the footprint. The result matches the same region of a full resize
+	// except for BOX with integer factors, which the full resize averages directly.
+	bool resizeRegion(const ImageView& source, const ui::Rect& sourceRegion, int sourceWidth, int sourceHeight, const ImageView& destination, const ui::Rect& destinationRegion, int destinationWidth, int destinationHeight, ResampleFilter filter = ResampleFilter::BICUBIC);
+}
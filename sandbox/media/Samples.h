@@ -0,0 +1,50 @@
+#pragma once
+
+// Sample rows shared by the kernels that treat every image class alike (comparison and hashing).
+
+// Dependencies | std
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Structs
+	// Rows of 8 or 16-bit samples
+	template<typename Sample>
+	struct Samples {
+		// Properties
+		const unsigned char* data{ nullptr };
+		size_t stride{ 0 }; // Bytes
+		int width{ 0 };
+		int height{ 0 };
+		int channels{ 0 };
+
+		// Functions
+		const Sample* row(int y) const {
+			return reinterpret_cast<const Sample*>(data + static_cast<size_t>(y) * stride);
+		}
+		size_t rowBytes() const {
+			return static_cast<size_t>(width) * static_cast<size_t>(channels) * sizeof(Sample);
+		}
+		bool isValid() const {
+			return data != nullptr && width > 0 && height > 0 && channels >= 1 && channels <= 4;
+		}
+	};
+
+	// Sample type of an image class
+	template<IsImage Image>
+	using SampleOf = std::conditional_t<sizeof(*std::declval<Image>().getData()) == Image::CHANNELS, unsigned char, unsigned short>;
+
+	// Functions
+	inline Samples<unsigned char> samplesOf(const ImageView& image) {
+		return { image.data, image.stride, image.width, image.height, image.channels };
+	}
+	template<IsImage Image>
+	Samples<SampleOf<Image>> samplesOf(const Image& image) {
+		const size_t stride = static_cast<size_t>(image.getWidth()) * static_cast<size_t>(Image::CHANNELS) * sizeof(SampleOf<Image>);
+		return { reinterpret_cast<const unsigned char*>(image.getData()), stride, image.getWidth(), image.getHeight(), Image::CHANNELS };
+	}
+}
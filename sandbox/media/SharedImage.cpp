@@ -0,0 +1,448 @@
+#include "SharedImage.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+// Dependencies | core
+#include <core/Simd.h>
+
+// Dependencies | platform
+#if defined(__unix__) || defined(__APPLE__)
+	#define IT_SHARED_MEMORY 1
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace it {
+	namespace {
+		// Start of every segment. Lives in shared memory, so it only holds fixed-size fields and address-free atomics.
+		struct SegmentHeader {
+			std::atomic<std::uint32_t> magic;	// Stored last by the creator, so a set magic means a complete header
+			std::uint32_t version;
+			std::int32_t width;
+			std::int32_t height;
+			std::int32_t channels;
+			std::int32_t sampleSize;
+			std::uint64_t pixelOffset;			// Bytes from the start of the segment, a multiple of the page size
+			std::uint64_t pixelSize;
+			std::atomic<std::uint32_t> state;	// HandshakeState
+			std::atomic<std::uint64_t> sequence;	// Of the last published frame
+		};
+		static_assert(std::atomic<std::uint32_t>::is_always_lock_free && std::atomic<std::uint64_t>::is_always_lock_free, "The handshake needs lock-free atomics to work across processes");
+
+		constexpr std::uint32_t SEGMENT_MAGIC{ 0x47494D53 }; // "SMIG"
+		constexpr std::uint32_t SEGMENT_VERSION{ 1 };
+
+		enum HandshakeState : std::uint32_t {
+			EMPTY,
+			READY,
+			CONSUMED
+		};
+
+		// Waits spin this many times before yielding, then yield this many times before sleeping
+		constexpr int SPIN_COUNT{ 1024 };
+		constexpr int YIELD_COUNT{ 64 };
+		constexpr std::chrono::microseconds SLEEP_TIME{ 100 };
+
+		SegmentHeader* segmentHeader(void* header) {
+			return static_cast<SegmentHeader*>(header);
+		}
+
+		template<typename Accepted>
+		bool waitForState(const std::atomic<std::uint32_t>& state, Accepted accepted, int timeoutMilliseconds) {
+			for (int spin = 0; spin < SPIN_COUNT; spin++) {
+				if (accepted(state.load(std::memory_order_acquire)))
+					return true;
+#if defined(IT_SIMD_SSE2)
+				_mm_pause();
+#endif
+			}
+
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(0, timeoutMilliseconds));
+			for (int attempt = 0; ; attempt++) {
+				if (accepted(state.load(std::memory_order_acquire)))
+					return true;
+				if (timeoutMilliseconds >= 0 && std::chrono::steady_clock::now() >= deadline)
+					return false;
+
+				if (attempt < YIELD_COUNT)
+					std::this_thread::yield();
+				else
+					std::this_thread::sleep_for(SLEEP_TIME);
+			}
+		}
+
+		bool validFormat(int width, int height, int channels, int sampleSize) {
+			if (width <= 0 || height <= 0 || channels < 1 || channels > 4 || (sampleSize != 1 && sampleSize != 2))
+				return false;
+			return static_cast<std::uint64_t>(width) * static_cast<std::uint64_t>(height) <= std::numeric_limits<std::uint64_t>::max() / 8ULL / 2ULL;
+		}
+
+#if defined(IT_SHARED_MEMORY)
+		size_t pageSize() {
+			const long size = sysconf(_SC_PAGESIZE);
+			return size > 0 ? static_cast<size_t>(size) : 4096ULL;
+		}
+#endif
+	}
+
+	// class SharedImage
+
+	// Constructor / Destructor
+	SharedImage::SharedImage(SharedImage&& other) noexcept {
+		*this = std::move(other);
+	}
+	SharedImage::~SharedImage() {
+		close();
+	}
+
+	// Operators | assignment
+	SharedImage& SharedImage::operator=(SharedImage&& other) noexcept {
+		if (this == &other)
+			return *this;
+
+		close();
+
+		name = std::move(other.name);
+		descriptor = other.descriptor;
+		creator = other.creator;
+		writable = other.writable;
+		header = other.header;
+		headerSize = other.headerSize;
+		data = other.data;
+		pixelSize = other.pixelSize;
+		width = other.width;
+		height = other.height;
+		channels = other.channels;
+		sampleSize = other.sampleSize;
+
+		other.name.clear();
+		other.descriptor = -1;
+		other.creator = false;
+		other.writable = false;
+		other.header = nullptr;
+		other.headerSize = 0;
+		other.data = nullptr;
+		other.pixelSize = 0;
+		other.width = 0;
+		other.height = 0;
+		other.channels = 0;
+		other.sampleSize = 0;
+
+		return *this;
+	}
+
+	// Getters
+	const std::string& SharedImage::getName() const {
+		return name;
+	}
+	int SharedImage::getDescriptor() const {
+		return descriptor;
+	}
+	int SharedImage::getWidth() const {
+		return width;
+	}
+	int SharedImage::getHeight() const {
+		return height;
+	}
+	int SharedImage::getChannels() const {
+		return channels;
+	}
+	int SharedImage::getSampleSize() const {
+		return sampleSize;
+	}
+	unsigned char* SharedImage::getData() const {
+		return data;
+	}
+
+	// Functions | segments
+	bool SharedImage::create(const std::string& name, int width, int height, int channels, int sampleSize) {
+#if defined(IT_SHARED_MEMORY)
+		close();
+		if (name.empty() || !validFormat(width, height, channels, sampleSize))
+			return false;
+
+		const std::string path = name.front() == '/' ? name : "/" + name;
+		const int created = shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+		if (created < 0)
+			return false;
+
+		// From here on close() unlinks the name again if anything fails
+		this->name = path;
+		descriptor = created;
+		creator = true;
+		if (!initialize(width, height, channels, sampleSize) || !map(true)) {
+			close();
+			return false;
+		}
+		return true;
+#else
+		(void)name;
+		(void)width;
+		(void)height;
+		(void)channels;
+		(void)sampleSize;
+		return false;
+#endif
+	}
+	bool SharedImage::createAnonymous(int width, int height, int channels, int sampleSize) {
+#if defined(IT_SHARED_MEMORY) && defined(__linux__)
+		close();
+		if (!validFormat(width, height, channels, sampleSize))
+			return false;
+
+		descriptor = memfd_create("it-shared-image", MFD_CLOEXEC);
+		if (descriptor < 0)
+			return false;
+
+		creator = true;
+		if (!initialize(width, height, channels, sampleSize) || !map(true)) {
+			close();
+			return false;
+		}
+		return true;
+#else
+		(void)width;
+		(void)height;
+		(void)channels;
+		(void)sampleSize;
+		return false;
+#endif
+	}
+	bool SharedImage::open(const std::string& name, SharedAccess access) {
+#if defined(IT_SHARED_MEMORY)
+		close();
+		if (name.empty())
+			return false;
+
+		// Read-write even for read-only pixels, the handshake state lives in the same segment
+		const std::string path = name.front() == '/' ? name : "/" + name;
+		descriptor = shm_open(path.c_str(), O_RDWR, 0);
+		if (descriptor < 0)
+			return false;
+
+		this->name = path;
+		if (!map(access == SharedAccess::READ_WRITE)) {
+			close();
+			return false;
+		}
+		return true;
+#else
+		(void)name;
+		(void)access;
+		return false;
+#endif
+	}
+	bool SharedImage::openDescriptor(int descriptor, SharedAccess access) {
+#if defined(IT_SHARED_MEMORY)
+		close();
+		if (descriptor < 0)
+			return false;
+
+		this->descriptor = fcntl(descriptor, F_DUPFD_CLOEXEC, 0);
+		if (this->descriptor < 0)
+			return false;
+
+		if (!map(access == SharedAccess::READ_WRITE)) {
+			close();
+			return false;
+		}
+		return true;
+#else
+		(void)descriptor;
+		(void)access;
+		return false;
+#endif
+	}
+	void SharedImage::close() {
+#if defined(IT_SHARED_MEMORY)
+		if (data != nullptr)
+			munmap(data, pixelSize);
+		if (header != nullptr)
+			munmap(header, headerSize);
+		if (descriptor >= 0)
+			::close(descriptor);
+		if (creator && !name.empty())
+			shm_unlink(name.c_str());
+#endif
+
+		name.clear();
+		descriptor = -1;
+		creator = false;
+		writable = false;
+		header = nullptr;
+		headerSize = 0;
+		data = nullptr;
+		pixelSize = 0;
+		width = 0;
+		height = 0;
+		channels = 0;
+		sampleSize = 0;
+	}
+	bool SharedImage::isOpen() const {
+		return data != nullptr;
+	}
+	bool SharedImage::isWritable() const {
+		return writable;
+	}
+	size_t SharedImage::dataSize() const {
+		return pixelSize;
+	}
+
+	// Functions | pixels
+	ImageView SharedImage::view() const {
+		if (data == nullptr || sampleSize != 1)
+			return ImageView(nullptr, 0, 0, 0);
+		return ImageView(data, width, height, channels);
+	}
+	template<IsImage Image>
+	bool SharedImage::borrow(Image& image) const {
+		using Pixel = std::remove_pointer_t<decltype(image.getData())>;
+		if (data == nullptr || channels != Image::CHANNELS || static_cast<size_t>(sampleSize) * Image::CHANNELS != sizeof(Pixel))
+			return false;
+		return image.wrap(reinterpret_cast<Pixel*>(data), width, height, PixelOwnership::BORROW);
+	}
+
+	// Functions | handshake
+	std::uint64_t SharedImage::publish() {
+		if (header == nullptr)
+			return 0;
+
+		SegmentHeader* shared = segmentHeader(header);
+		// Only the producer writes the sequence, the release store of the state publishes it with the pixels
+		const std::uint64_t sequence = shared->sequence.load(std::memory_order_relaxed) + 1;
+		shared->sequence.store(sequence, std::memory_order_relaxed);
+		shared->state.store(READY, std::memory_order_release);
+		return sequence;
+	}
+	bool SharedImage::waitReady(std::uint64_t& sequence, int timeoutMilliseconds) const {
+		if (header == nullptr)
+			return false;
+
+		SegmentHeader* shared = segmentHeader(header);
+		if (!waitForState(shared->state, [](std::uint32_t state) { return state == READY; }, timeoutMilliseconds))
+			return false;
+		sequence = shared->sequence.load(std::memory_order_relaxed);
+		return true;
+	}
+	void SharedImage::consume() {
+		if (header == nullptr)
+			return;
+
+		// Release, so the reads of the consumer happen before the producer overwrites the pixels
+		segmentHeader(header)->state.store(CONSUMED, std::memory_order_release);
+	}
+	bool SharedImage::waitConsumed(int timeoutMilliseconds) const {
+		if (header == nullptr)
+			return false;
+		return waitForState(segmentHeader(header)->state, [](std::uint32_t state) { return state != READY; }, timeoutMilliseconds);
+	}
+
+	// Object | private
+
+	// Functions
+	bool SharedImage::initialize(int width, int height, int channels, int sampleSize) {
+#if defined(IT_SHARED_MEMORY)
+		// Pixels start on their own page, so they can be mapped with other protections than the header
+		const size_t pixelOffset = pageSize();
+		const size_t pixels = static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(channels) * static_cast<size_t>(sampleSize);
+		if (ftruncate(descriptor, static_cast<off_t>(pixelOffset + pixels)) != 0)
+			return false;
+
+		void* mapping = mmap(nullptr, pixelOffset, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+		if (mapping == MAP_FAILED)
+			return false;
+		header = mapping;
+		headerSize = pixelOffset;
+
+		// The segment starts zeroed, so nobody can see a magic before the release store below
+		SegmentHeader* shared = new (mapping) SegmentHeader{};
+		shared->version = SEGMENT_VERSION;
+		shared->width = width;
+		shared->height = height;
+		shared->channels = channels;
+		shared->sampleSize = sampleSize;
+		shared->pixelOffset = pixelOffset;
+		shared->pixelSize = pixels;
+		shared->state.store(EMPTY, std::memory_order_relaxed);
+		shared->sequence.store(0, std::memory_order_relaxed);
+		shared->magic.store(SEGMENT_MAGIC, std::memory_order_release);
+		return true;
+#else
+		(void)width;
+		(void)height;
+		(void)channels;
+		(void)sampleSize;
+		return false;
+#endif
+	}
+	bool SharedImage::map(bool writable) {
+#if defined(IT_SHARED_MEMORY)
+		struct stat status{};
+		if (fstat(descriptor, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(SegmentHeader))
+			return false;
+
+		if (header == nullptr) {
+			const size_t size = pageSize();
+			if (static_cast<size_t>(status.st_size) < size)
+				return false;
+			void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+			if (mapping == MAP_FAILED)
+				return false;
+			header = mapping;
+			headerSize = size;
+		}
+
+		// A segment still being created has no magic yet and is refused like a foreign one
+		const SegmentHeader* shared = segmentHeader(header);
+		if (shared->magic.load(std::memory_order_acquire) != SEGMENT_MAGIC || shared->version != SEGMENT_VERSION)
+			return false;
+		if (!validFormat(shared->width, shared->height, shared->channels, shared->sampleSize) || shared->pixelOffset % headerSize != 0)
+			return false;
+		const std::uint64_t pixels = static_cast<std::uint64_t>(shared->width) * static_cast<std::uint64_t>(shared->height) * static_cast<std::uint64_t>(shared->channels) * static_cast<std::uint64_t>(shared->sampleSize);
+		if (shared->pixelSize != pixels || static_cast<std::uint64_t>(status.st_size) < shared->pixelOffset + pixels)
+			return false;
+
+		const int protection = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+		void* mapping = mmap(nullptr, static_cast<size_t>(pixels), protection, MAP_SHARED, descriptor, static_cast<off_t>(shared->pixelOffset));
+		if (mapping == MAP_FAILED)
+			return false;
+
+		data = static_cast<unsigned char*>(mapping);
+		pixelSize = static_cast<size_t>(pixels);
+		width = shared->width;
+		height = shared->height;
+		channels = shared->channels;
+		sampleSize = shared->sampleSize;
+		this->writable = writable;
+		return true;
+#else
+		(void)writable;
+		return false;
+#endif
+	}
+
+#define IT_SHAREDIMAGE_INSTANTIATE(Image) \
+	template bool SharedImage::borrow<Image>(Image&) const;
+
+	IT_SHAREDIMAGE_INSTANTIATE(ImageGray)
+	IT_SHAREDIMAGE_INSTANTIATE(ImageGrayAlpha)
+	IT_SHAREDIMAGE_INSTANTIATE(ImageRGB)
+	IT_SHAREDIMAGE_INSTANTIATE(ImageRGBA)
+	IT_SHAREDIMAGE_INSTANTIATE(ImageGray16)
+	IT_SHAREDIMAGE_INSTANTIATE(ImageGrayAlpha16)
+	IT_SHAREDIMAGE_INSTANTIATE(ImageRGB16)
+	IT_SHAREDIMAGE_INSTANTIATE(ImageRGBA16)
+
+#undef IT_SHAREDIMAGE_INSTANTIATE
+}
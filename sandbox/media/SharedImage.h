@@ -0,0 +1,97 @@
+#pragma once
+
+// Dependencies | std
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Enums
+	enum class SharedAccess {
+		READ_ONLY,	// Pixels mapped read-only (the handshake state stays writable)
+		READ_WRITE
+	};
+
+	// Classes
+	// Image in POSIX shared memory, for passing frames between processes without copies. The segment holds one page of
+	// header (size, format and handshake state) followed by the pixels in tightly packed rows. One process creates it,
+	// by name (shm_open) or anonymously (memfd_create on Linux, the descriptor is then passed to the others over a UNIX
+	// socket or by fork); the others open it by name or descriptor. Segments created by name are unlinked when their
+	// creator closes them; mappings already open stay valid.
+	// The handshake serves one producer and one consumer: the producer fills the pixels and publishes them, the
+	// consumer waits until they are ready, reads them and marks them consumed, and the producer waits for that before
+	// writing the next frame. States are lock-free atomics in the header; waits spin briefly, then yield and sleep.
+	// Not available outside POSIX systems, where every function fails.
+	class SharedImage {
+		// Object
+		private:
+			// Properties
+			std::string name{};					// With its leading '/', empty for anonymous segments
+			int descriptor{ -1 };
+			bool creator{ false };
+			bool writable{ false };
+			void* header{ nullptr };				// Mapping of the header page
+			size_t headerSize{ 0 };
+			unsigned char* data{ nullptr };		// Mapping of the pixels
+			size_t pixelSize{ 0 };
+			int width{ 0 };
+			int height{ 0 };
+			int channels{ 0 };
+			int sampleSize{ 0 };
+
+			// Functions
+			bool initialize(int width, int height, int channels, int sampleSize); // Sizes the segment and writes its header
+			bool map(bool writable); // Maps the header (unless initialize did) and the pixels it describes
+
+		public:
+			// Constructor / Destructor
+			SharedImage() = default;
+			SharedImage(const SharedImage& other) = delete;
+			SharedImage(SharedImage&& other) noexcept;
+			~SharedImage();
+
+			// Operators | assignment
+			SharedImage& operator=(const SharedImage& other) = delete;
+			SharedImage& operator=(SharedImage&& other) noexcept;
+
+			// Getters
+			const std::string& getName() const;
+			int getDescriptor() const;
+			int getWidth() const;
+			int getHeight() const;
+			int getChannels() const;
+			int getSampleSize() const; // Bytes, 1 or 2
+			unsigned char* getData() const;
+
+			// Functions | segments
+			// 1 to 4 channels of 1 or 2 byte samples; the pixels start zeroed and the handshake empty. name may omit its
+			// leading '/' and must not exist yet.
+			bool create(const std::string& name, int width, int height, int channels, int sampleSize = 1);
+			bool createAnonymous(int width, int height, int channels, int sampleSize = 1); // Linux only
+			bool open(const std::string& name, SharedAccess access = SharedAccess::READ_ONLY);
+			bool openDescriptor(int descriptor, SharedAccess access = SharedAccess::READ_ONLY); // Duplicates the descriptor
+			void close();
+			bool isOpen() const;
+			bool isWritable() const;
+			size_t dataSize() const;
+
+			// Functions | pixels
+			ImageView view() const; // 8-bit samples only, empty otherwise
+			// Borrows the pixels into one of the 8 image classes matching the channel count and sample size (see
+			// PixelOwnership); writing through a read-only mapping faults
+			template<IsImage Image>
+			bool borrow(Image& image) const;
+
+			// Functions | handshake
+			// Producer: marks the pixels ready and returns their sequence number (1 for the first frame)
+			std::uint64_t publish();
+			// Consumer: waits until a frame is ready (false on timeout; a negative timeout waits forever)
+			bool waitReady(std::uint64_t& sequence, int timeoutMilliseconds = -1) const;
+			void consume();
+			// Producer: waits until the last frame was consumed (immediately true before the first one)
+			bool waitConsumed(int timeoutMilliseconds = -1) const;
+	};
+}
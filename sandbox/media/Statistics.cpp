@@ -0,0 +1,693 @@
+#include "Statistics.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+// Dependencies | core
+#include <core/Parallel.h>
+#include <core/Simd.h>
+
+// Dependencies | media
+#include <media/Lut.h>
+
+namespace it {
+	namespace {
+		// Rows per parallel band
+		constexpr int BAND_ROWS{ 32 };
+
+		using Bins = std::array<std::array<unsigned long long, 256>, 4>;
+
+		// Histogram of rows [rowBegin, rowEnd); single channel images count into four interleaved tables so runs of equal
+		// samples do not serialize on one counter
+		void countRows(const ImageView& image, const ImageViewGray* mask, int rowBegin, int rowEnd, Bins& bins) {
+			const int channels = image.channels;
+			const size_t width = static_cast<size_t>(image.width);
+			for (int y = rowBegin; y < rowEnd; y++) {
+				const unsigned char* samples = image.row(y);
+				if (mask != nullptr) {
+					const unsigned char* selected = mask->row(y);
+					for (size_t x = 0ULL; x < width; x++) {
+						if (selected[x] == 0U)
+							continue;
+						for (int channel = 0; channel < channels; channel++)
+							bins[channel][samples[x * channels + channel]]++;
+					}
+				}
+				else if (channels == 1) {
+					size_t x = 0ULL;
+					for (; x + 4ULL <= width; x += 4ULL) {
+						bins[0][samples[x]]++;
+						bins[1][samples[x + 1ULL]]++;
+						bins[2][samples[x + 2ULL]]++;
+						bins[3][samples[x + 3ULL]]++;
+					}
+					for (; x < width; x++)
+						bins[0][samples[x]]++;
+				}
+				else {
+					const size_t count = width * static_cast<size_t>(channels);
+					for (size_t i = 0ULL; i < count; i += static_cast<size_t>(channels)) {
+						for (int channel = 0; channel < channels; channel++)
+							bins[channel][samples[i + channel]]++;
+					}
+				}
+			}
+
+			if (mask == nullptr && channels == 1) {
+				for (int level = 0; level < 256; level++) {
+					bins[0][level] += bins[1][level] + bins[2][level] + bins[3][level];
+					bins[1][level] = bins[2][level] = bins[3][level] = 0ULL;
+				}
+			}
+		}
+
+		bool histogramOf(const ImageView& image, const ImageViewGray* mask, Histogram& histogram) {
+			// Error check
+			if (!image.hasData() || image.width <= 0 || image.height <= 0 || image.channels < 1 || image.channels > 4)
+				return false;
+			if (mask != nullptr && (!mask->hasData() || mask->width != image.width || mask->height != image.height))
+				return false;
+
+			histogram = Histogram{};
+			histogram.channels = image.channels;
+
+			std::mutex mergeMutex{};
+			parallelForBands(0, image.height, [&](int rowBegin, int rowEnd) {
+				Bins local{};
+				countRows(image, mask, rowBegin, rowEnd, local);
+
+				std::lock_guard<std::mutex> lock(mergeMutex);
+				for (int channel = 0; channel < image.channels; channel++) {
+					for (int level = 0; level < 256; level++)
+						histogram.bins[channel][level] += local[channel][level];
+				}
+			}, BAND_ROWS);
+
+			return true;
+		}
+
+		// Per channel min / max of a row of interleaved samples. Blocks of 48 samples hold a whole number of pixels for
+		// every channel count, so sample j of a block always belongs to channel j % channels.
+		template<typename T>
+		void minMaxRow(const T* samples, size_t count, int channels, T* minimum, T* maximum) {
+			constexpr size_t BLOCK{ 48 };
+			size_t i = 0ULL;
+#if defined(IT_SIMD_SSE2)
+			if (count >= BLOCK) {
+				constexpr int VECTORS{ static_cast<int>(BLOCK * sizeof(T) / 16ULL) };
+				constexpr size_t LANES{ 16ULL / sizeof(T) };
+
+				// Unsigned 16-bit min / max needs SSE4.1; without it the samples are biased into signed range
+				const __m128i BIAS = sizeof(T) == 2ULL ? _mm_set1_epi16(static_cast<short>(0x8000)) : _mm_setzero_si128();
+				auto minimumOf = [&BIAS](__m128i a, __m128i b) {
+					if constexpr (sizeof(T) == 1ULL)
+						return _mm_min_epu8(a, b);
+#if defined(IT_SIMD_SSE41)
+					else
+						return _mm_min_epu16(a, b);
+#else
+					else
+						return _mm_xor_si128(_mm_min_epi16(_mm_xor_si128(a, BIAS), _mm_xor_si128(b, BIAS)), BIAS);
+#endif
+				};
+				auto maximumOf = [&BIAS](__m128i a, __m128i b) {
+					if constexpr (sizeof(T) == 1ULL)
+						return _mm_max_epu8(a, b);
+#if defined(IT_SIMD_SSE41)
+					else
+						return _mm_max_epu16(a, b);
+#else
+					else
+						return _mm_xor_si128(_mm_max_epi16(_mm_xor_si128(a, BIAS), _mm_xor_si128(b, BIAS)), BIAS);
+#endif
+				};
+
+				__m128i low[VECTORS];
+				__m128i high[VECTORS];
+				for (int v = 0; v < VECTORS; v++) {
+					low[v] = _mm_set1_epi8(static_cast<char>(0xFF));
+					high[v] = _mm_setzero_si128();
+				}
+				for (; i + BLOCK <= count; i += BLOCK) {
+					for (int v = 0; v < VECTORS; v++) {
+						const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i + v * LANES));
+						low[v] = minimumOf(low[v], block);
+						high[v] = maximumOf(high[v], block);
+					}
+				}
+
+				T lows[BLOCK];
+				T highs[BLOCK];
+				for (int v = 0; v < VECTORS; v++) {
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(lows + v * LANES), low[v]);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(highs + v * LANES), high[v]);
+				}
+				for (size_t j = 0ULL; j < BLOCK; j++) {
+					const size_t channel = j % static_cast<size_t>(channels);
+					minimum[channel] = std::min(minimum[channel], lows[j]);
+					maximum[channel] = std::max(maximum[channel], highs[j]);
+				}
+			}
+#endif
+			for (; i < count; i++) {
+				const size_t channel = i % static_cast<size_t>(channels);
+				minimum[channel] = std::min(minimum[channel], samples[i]);
+				maximum[channel] = std::max(maximum[channel], samples[i]);
+			}
+		}
+
+		void statisticsOf(const Histogram& histogram, ImageStatistics& statistics) {
+			statistics = ImageStatistics{};
+			statistics.channels = histogram.channels;
+			statistics.count = histogram.count(0);
+			if (statistics.count == 0ULL)
+				return;
+
+			for (int channel = 0; channel < histogram.channels; channel++) {
+				const std::array<unsigned long long, 256>& bins = histogram.bins[channel];
+				ChannelStatistics& result = statistics.channel[channel];
+
+				double sum{ 0.0 };
+				double squares{ 0.0 };
+				result.minimum = 255;
+				result.maximum = 0;
+				for (int level = 0; level < 256; level++) {
+					if (bins[level] == 0ULL)
+						continue;
+					result.minimum = std::min(result.minimum, level);
+					result.maximum = level;
+					sum += static_cast<double>(bins[level]) * level;
+					squares += static_cast<double>(bins[level]) * level * level;
+				}
+				const double count = static_cast<double>(statistics.count);
+				result.mean = sum / count;
+				result.standardDeviation = std::sqrt(std::max(0.0, squares / count - result.mean * result.mean));
+			}
+		}
+
+		// 16-bit images have no view type; they are described by their first pixel, size and row pitch
+		struct Samples16 {
+			const unsigned short* data{ nullptr };
+			int width{ 0 };
+			int height{ 0 };
+			int channels{ 0 };
+			size_t rowSamples{ 0 };
+		};
+		template<typename Image>
+		bool samplesOf(const Image& image, const ui::Rect& region, Samples16& samples) {
+			const ui::Rect clipped = region.normalized().intersected({ { 0, 0 }, { image.getWidth(), image.getHeight() } });
+			if (!image.isAllocated() || !clipped.isValid())
+				return false;
+
+			samples.channels = image.getChannels();
+			samples.rowSamples = static_cast<size_t>(image.getWidth()) * static_cast<size_t>(samples.channels);
+			samples.data = reinterpret_cast<const unsigned short*>(image.getData()) + static_cast<size_t>(clipped.top()) * samples.rowSamples + static_cast<size_t>(clipped.left()) * static_cast<size_t>(samples.channels);
+			samples.width = clipped.width();
+			samples.height = clipped.height();
+			return true;
+		}
+		bool validMask(const Samples16& samples, const ImageViewGray* mask) {
+			return mask == nullptr || (mask->hasData() && mask->width == samples.width && mask->height == samples.height);
+		}
+
+		// Histogram of 16-bit rows [rowBegin, rowEnd), binned by the high byte of every sample
+		void countRows(const Samples16& samples, const ImageViewGray* mask, int rowBegin, int rowEnd, Bins& bins) {
+			const int channels = samples.channels;
+			const size_t width = static_cast<size_t>(samples.width);
+			for (int y = rowBegin; y < rowEnd; y++) {
+				const unsigned short* row = samples.data + static_cast<size_t>(y) * samples.rowSamples;
+				const unsigned char* selected = mask != nullptr ? mask->row(y) : nullptr;
+				for (size_t x = 0ULL; x < width; x++, row += channels) {
+					if (selected != nullptr && selected[x] == 0U)
+						continue;
+					for (int channel = 0; channel < channels; channel++)
+						bins[channel][row[channel] >> 8]++;
+				}
+			}
+		}
+		bool histogramOf(const Samples16& samples, const ImageViewGray* mask, Histogram& histogram) {
+			// Error check
+			if (!validMask(samples, mask))
+				return false;
+
+			histogram = Histogram{};
+			histogram.channels = samples.channels;
+			histogram.binShift = 8;
+
+			std::mutex mergeMutex{};
+			parallelForBands(0, samples.height, [&](int rowBegin, int rowEnd) {
+				Bins local{};
+				countRows(samples, mask, rowBegin, rowEnd, local);
+
+				std::lock_guard<std::mutex> lock(mergeMutex);
+				for (int channel = 0; channel < samples.channels; channel++) {
+					for (int level = 0; level < 256; level++)
+						histogram.bins[channel][level] += local[channel][level];
+				}
+			}, BAND_ROWS);
+
+			return true;
+		}
+
+		bool statisticsOf(const Samples16& samples, const ImageViewGray* mask, ImageStatistics& statistics) {
+			struct Partial {
+				unsigned long long count{ 0 };
+				std::array<unsigned short, 4> minimum{ 65535, 65535, 65535, 65535 };
+				std::array<unsigned short, 4> maximum{};
+				std::array<unsigned long long, 4> sum{};
+				std::array<double, 4> squares{};
+			};
+
+			// Error check
+			if (!validMask(samples, mask))
+				return false;
+
+			Partial total{};
+			std::mutex mergeMutex{};
+			parallelForBands(0, samples.height, [&](int rowBegin, int rowEnd) {
+				Partial partial{};
+				const size_t count = static_cast<size_t>(samples.width) * static_cast<size_t>(samples.channels);
+				for (int y = rowBegin; y < rowEnd; y++) {
+					const unsigned short* row = samples.data + static_cast<size_t>(y) * samples.rowSamples;
+					const unsigned char* selected = mask != nullptr ? mask->row(y) : nullptr;
+					if (selected == nullptr) {
+						minMaxRow(row, count, samples.channels, partial.minimum.data(), partial.maximum.data());
+						partial.count += static_cast<unsigned long long>(samples.width);
+					}
+
+					// Squares of a row fit in 64 bits; they are accumulated in double across rows
+					std::array<unsigned long long, 4> squares{};
+					for (size_t i = 0ULL, x = 0ULL; i < count; i += static_cast<size_t>(samples.channels), x++) {
+						if (selected != nullptr) {
+							if (selected[x] == 0U)
+								continue;
+							partial.count++;
+						}
+						for (int channel = 0; channel < samples.channels; channel++) {
+							const unsigned short value = row[i + channel];
+							if (selected != nullptr) {
+								partial.minimum[channel] = std::min(partial.minimum[channel], value);
+								partial.maximum[channel] = std::max(partial.maximum[channel], value);
+							}
+							partial.sum[channel] += value;
+							squares[channel] += static_cast<unsigned long long>(value) * value;
+						}
+					}
+					for (int channel = 0; channel < samples.channels; channel++)
+						partial.squares[channel] += static_cast<double>(squares[channel]);
+				}
+
+				std::lock_guard<std::mutex> lock(mergeMutex);
+				total.count += partial.count;
+				for (int channel = 0; channel < samples.channels; channel++) {
+					total.minimum[channel] = std::min(total.minimum[channel], partial.minimum[channel]);
+					total.maximum[channel] = std::max(total.maximum[channel], partial.maximum[channel]);
+					total.sum[channel] += partial.sum[channel];
+					total.squares[channel] += partial.squares[channel];
+				}
+			}, BAND_ROWS);
+
+			statistics = ImageStatistics{};
+			statistics.channels = samples.channels;
+			statistics.count = total.count;
+			if (statistics.count == 0ULL)
+				return true;
+
+			const double count = static_cast<double>(statistics.count);
+			for (int channel = 0; channel < samples.channels; channel++) {
+				ChannelStatistics& result = statistics.channel[channel];
+				result.minimum = total.minimum[channel];
+				result.maximum = total.maximum[channel];
+				result.mean = static_cast<double>(total.sum[channel]) / count;
+				result.standardDeviation = std::sqrt(std::max(0.0, total.squares[channel] / count - result.mean * result.mean));
+			}
+			return true;
+		}
+		template<typename Image>
+		bool histogramOf16(const Image& image, const ui::Rect& region, const ImageViewGray* mask, Histogram& histogram) {
+			Samples16 samples{};
+			if (!samplesOf(image, region, samples))
+				return false;
+			return histogramOf(samples, mask, histogram);
+		}
+		template<typename Image>
+		bool statisticsOf16(const Image& image, const ui::Rect& region, const ImageViewGray* mask, ImageStatistics& statistics) {
+			Samples16 samples{};
+			if (!samplesOf(image, region, samples))
+				return false;
+			return statisticsOf(samples, mask, statistics);
+		}
+		template<typename Image>
+		bool minMaxOf16(const Image& image, glm::u16vec4& minimum, glm::u16vec4& maximum) {
+			Samples16 samples{};
+			if (!samplesOf(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, samples))
+				return false;
+
+			std::array<unsigned short, 4> low{ 65535, 65535, 65535, 65535 };
+			std::array<unsigned short, 4> high{};
+			std::mutex mergeMutex{};
+			parallelForBands(0, samples.height, [&](int rowBegin, int rowEnd) {
+				std::array<unsigned short, 4> bandLow{ 65535, 65535, 65535, 65535 };
+				std::array<unsigned short, 4> bandHigh{};
+				const size_t count = static_cast<size_t>(samples.width) * static_cast<size_t>(samples.channels);
+				for (int y = rowBegin; y < rowEnd; y++)
+					minMaxRow(samples.data + static_cast<size_t>(y) * samples.rowSamples, count, samples.channels, bandLow.data(), bandHigh.data());
+
+				std::lock_guard<std::mutex> lock(mergeMutex);
+				for (int channel = 0; channel < samples.channels; channel++) {
+					low[channel] = std::min(low[channel], bandLow[channel]);
+					high[channel] = std::max(high[channel], bandHigh[channel]);
+				}
+			}, BAND_ROWS);
+
+			minimum = glm::u16vec4(0);
+			maximum = glm::u16vec4(0);
+			for (int channel = 0; channel < samples.channels; channel++) {
+				minimum[channel] = low[channel];
+				maximum[channel] = high[channel];
+			}
+			return true;
+		}
+
+		// Equalization table from a cumulative histogram: level -> round(255 * cdf(level) / count)
+		void equalizationTable(const std::array<unsigned long long, 256>& bins, unsigned long long base, unsigned long long count, unsigned char* table) {
+			unsigned long long cumulative{ 0ULL };
+			const unsigned long long range = count - base;
+			for (int level = 0; level < 256; level++) {
+				cumulative += bins[level];
+				const unsigned long long above = cumulative > base ? cumulative - base : 0ULL;
+				table[level] = static_cast<unsigned char>(range == 0ULL ? level : (above * 255ULL + range / 2ULL) / range);
+			}
+		}
+
+		// Interpolation between the two nearest tile centers along one axis
+		struct Blend {
+			int first{ 0 };
+			int second{ 0 };
+			float weight{ 0.0f }; // Of second
+		};
+		std::vector<Blend> blendsOf(int size, int tiles) {
+			std::vector<float> centers(static_cast<size_t>(tiles));
+			for (int tile = 0; tile < tiles; tile++) {
+				const int begin = static_cast<int>(static_cast<long long>(size) * tile / tiles);
+				const int end = static_cast<int>(static_cast<long long>(size) * (tile + 1) / tiles);
+				centers[tile] = (begin + end - 1) * 0.5f;
+			}
+
+			std::vector<Blend> blends(static_cast<size_t>(size));
+			int tile = 0;
+			for (int i = 0; i < size; i++) {
+				while (tile + 1 < tiles && centers[tile + 1] <= static_cast<float>(i))
+					tile++;
+				Blend& blend = blends[i];
+				if (static_cast<float>(i) <= centers[0] || tile + 1 >= tiles) {
+					blend.first = blend.second = static_cast<float>(i) <= centers[0] ? 0 : tiles - 1;
+					continue;
+				}
+				blend.first = tile;
+				blend.second = tile + 1;
+				blend.weight = (static_cast<float>(i) - centers[tile]) / (centers[tile + 1] - centers[tile]);
+			}
+			return blends;
+		}
+	}
+
+	// struct Histogram
+
+	// Object | public
+
+	// Functions
+	unsigned long long Histogram::count(int channel) const {
+		unsigned long long total{ 0ULL };
+		for (unsigned long long bin : bins[channel])
+			total += bin;
+		return total;
+	}
+	int Histogram::percentile(double fraction, int channel) const {
+		const unsigned long long total = count(channel);
+		if (total == 0ULL)
+			return 0;
+
+		const unsigned long long target = std::clamp(static_cast<unsigned long long>(std::ceil(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(total))), 1ULL, total);
+		unsigned long long cumulative{ 0ULL };
+		for (int level = 0; level < 256; level++) {
+			cumulative += bins[channel][level];
+			if (cumulative >= target)
+				return level;
+		}
+		return 255;
+	}
+
+	// Functions | histograms
+	bool computeHistogram(const ImageView& image, Histogram& histogram) {
+		return histogramOf(image, nullptr, histogram);
+	}
+	bool computeHistogram(const ImageView& image, const ui::Rect& region, Histogram& histogram) {
+		return histogramOf(image.subView(region), nullptr, histogram);
+	}
+	bool computeHistogram(const ImageView& image, const ImageViewGray& mask, Histogram& histogram) {
+		return histogramOf(image, &mask, histogram);
+	}
+	bool computeHistogram(const ImageGray16& image, Histogram& histogram) {
+		return histogramOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, nullptr, histogram);
+	}
+	bool computeHistogram(const ImageGray16& image, const ui::Rect& region, Histogram& histogram) {
+		return histogramOf16(image, region, nullptr, histogram);
+	}
+	bool computeHistogram(const ImageGray16& image, const ImageViewGray& mask, Histogram& histogram) {
+		return histogramOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, &mask, histogram);
+	}
+	bool computeHistogram(const ImageGrayAlpha16& image, Histogram& histogram) {
+		return histogramOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, nullptr, histogram);
+	}
+	bool computeHistogram(const ImageGrayAlpha16& image, const ui::Rect& region, Histogram& histogram) {
+		return histogramOf16(image, region, nullptr, histogram);
+	}
+	bool computeHistogram(const ImageGrayAlpha16& image, const ImageViewGray& mask, Histogram& histogram) {
+		return histogramOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, &mask, histogram);
+	}
+	bool computeHistogram(const ImageRGB16& image, Histogram& histogram) {
+		return histogramOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, nullptr, histogram);
+	}
+	bool computeHistogram(const ImageRGB16& image, const ui::Rect& region, Histogram& histogram) {
+		return histogramOf16(image, region, nullptr, histogram);
+	}
+	bool computeHistogram(const ImageRGB16& image, const ImageViewGray& mask, Histogram& histogram) {
+		return histogramOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, &mask, histogram);
+	}
+	bool computeHistogram(const ImageRGBA16& image, Histogram& histogram) {
+		return histogramOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, nullptr, histogram);
+	}
+	bool computeHistogram(const ImageRGBA16& image, const ui::Rect& region, Histogram& histogram) {
+		return histogramOf16(image, region, nullptr, histogram);
+	}
+	bool computeHistogram(const ImageRGBA16& image, const ImageViewGray& mask, Histogram& histogram) {
+		return histogramOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, &mask, histogram);
+	}
+
+	// Functions | statistics
+	bool computeStatistics(const ImageView& image, ImageStatistics& statistics) {
+		Histogram histogram{};
+		if (!computeHistogram(image, histogram))
+			return false;
+		statisticsOf(histogram, statistics);
+		return true;
+	}
+	bool computeStatistics(const ImageView& image, const ui::Rect& region, ImageStatistics& statistics) {
+		Histogram histogram{};
+		if (!computeHistogram(image, region, histogram))
+			return false;
+		statisticsOf(histogram, statistics);
+		return true;
+	}
+	bool computeStatistics(const ImageView& image, const ImageViewGray& mask, ImageStatistics& statistics) {
+		Histogram histogram{};
+		if (!computeHistogram(image, mask, histogram))
+			return false;
+		statisticsOf(histogram, statistics);
+		return true;
+	}
+	bool computeStatistics(const ImageGray16& image, ImageStatistics& statistics) {
+		return statisticsOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, nullptr, statistics);
+	}
+	bool computeStatistics(const ImageGray16& image, const ui::Rect& region, ImageStatistics& statistics) {
+		return statisticsOf16(image, region, nullptr, statistics);
+	}
+	bool computeStatistics(const ImageGray16& image, const ImageViewGray& mask, ImageStatistics& statistics) {
+		return statisticsOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, &mask, statistics);
+	}
+	bool computeStatistics(const ImageGrayAlpha16& image, ImageStatistics& statistics) {
+		return statisticsOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, nullptr, statistics);
+	}
+	bool computeStatistics(const ImageGrayAlpha16& image, const ui::Rect& region, ImageStatistics& statistics) {
+		return statisticsOf16(image, region, nullptr, statistics);
+	}
+	bool computeStatistics(const ImageGrayAlpha16& image, const ImageViewGray& mask, ImageStatistics& statistics) {
+		return statisticsOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, &mask, statistics);
+	}
+	bool computeStatistics(const ImageRGB16& image, ImageStatistics& statistics) {
+		return statisticsOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, nullptr, statistics);
+	}
+	bool computeStatistics(const ImageRGB16& image, const ui::Rect& region, ImageStatistics& statistics) {
+		return statisticsOf16(image, region, nullptr, statistics);
+	}
+	bool computeStatistics(const ImageRGB16& image, const ImageViewGray& mask, ImageStatistics& statistics) {
+		return statisticsOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, &mask, statistics);
+	}
+	bool computeStatistics(const ImageRGBA16& image, ImageStatistics& statistics) {
+		return statisticsOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, nullptr, statistics);
+	}
+	bool computeStatistics(const ImageRGBA16& image, const ui::Rect& region, ImageStatistics& statistics) {
+		return statisticsOf16(image, region, nullptr, statistics);
+	}
+	bool computeStatistics(const ImageRGBA16& image, const ImageViewGray& mask, ImageStatistics& statistics) {
+		return statisticsOf16(image, { { 0, 0 }, { image.getWidth(), image.getHeight() } }, &mask, statistics);
+	}
+
+	bool computeMinMax(const ImageView& image, glm::u8vec4& minimum, glm::u8vec4& maximum) {
+		// Error check
+		if (!image.hasData() || image.width <= 0 || image.height <= 0 || image.channels < 1 || image.channels > 4)
+			return false;
+
+		std::array<unsigned char, 4> low{ 255, 255, 255, 255 };
+		std::array<unsigned char, 4> high{};
+		std::mutex mergeMutex{};
+		parallelForBands(0, image.height, [&](int rowBegin, int rowEnd) {
+			std::array<unsigned char, 4> bandLow{ 255, 255, 255, 255 };
+			std::array<unsigned char, 4> bandHigh{};
+			const size_t count = static_cast<size_t>(image.width) * static_cast<size_t>(image.channels);
+			for (int y = rowBegin; y < rowEnd; y++)
+				minMaxRow(image.row(y), count, image.channels, bandLow.data(), bandHigh.data());
+
+			std::lock_guard<std::mutex> lock(mergeMutex);
+			for (int channel = 0; channel < image.channels; channel++) {
+				low[channel] = std::min(low[channel], bandLow[channel]);
+				high[channel] = std::max(high[channel], bandHigh[channel]);
+			}
+		}, BAND_ROWS);
+
+		minimum = glm::u8vec4(0);
+		maximum = glm::u8vec4(0);
+		for (int channel = 0; channel < image.channels; channel++) {
+			minimum[channel] = low[channel];
+			maximum[channel] = high[channel];
+		}
+		return true;
+	}
+	bool computeMinMax(const ImageGray16& image, glm::u16vec4& minimum, glm::u16vec4& maximum) {
+		return minMaxOf16(image, minimum, maximum);
+	}
+	bool computeMinMax(const ImageGrayAlpha16& image, glm::u16vec4& minimum, glm::u16vec4& maximum) {
+		return minMaxOf16(image, minimum, maximum);
+	}
+	bool computeMinMax(const ImageRGB16& image, glm::u16vec4& minimum, glm::u16vec4& maximum) {
+		return minMaxOf16(image, minimum, maximum);
+	}
+	bool computeMinMax(const ImageRGBA16& image, glm::u16vec4& minimum, glm::u16vec4& maximum) {
+		return minMaxOf16(image, minimum, maximum);
+	}
+
+	// Functions | tone
+	bool autoLevels(const ImageView& image, float clipFraction) {
+		Histogram histogram{};
+		if (!computeHistogram(image, histogram))
+			return false;
+
+		const bool hasAlpha = image.channels == 2 || image.channels == 4;
+		ChannelLuts luts{};
+		for (int channel = 0; channel < image.channels; channel++) {
+			const int low = histogram.percentile(clipFraction, channel);
+			const int high = histogram.percentile(1.0 - clipFraction, channel);
+			const bool keep = (hasAlpha && channel == image.channels - 1) || high <= low;
+			for (int level = 0; level < 256; level++)
+				luts.channels[channel].table[level] = keep ? static_cast<unsigned char>(level) : static_cast<unsigned char>(std::clamp(((level - low) * 255 + (high - low) / 2) / (high - low), 0, 255));
+		}
+		return applyLut(image, luts);
+	}
+	bool equalizeHistogram(const ImageViewGray& image) {
+		const ImageView samples(image.data, image.width, image.height, 1, image.stride);
+		Histogram histogram{};
+		if (!computeHistogram(samples, histogram))
+			return false;
+
+		// The darkest level present maps to 0
+		const std::array<unsigned long long, 256>& bins = histogram.bins[0];
+		const unsigned long long base = *std::find_if(bins.begin(), bins.end(), [](unsigned long long bin) { return bin != 0ULL; });
+		Lut lut{};
+		equalizationTable(bins, base, histogram.count(0), lut.table.data());
+		return applyLut(samples, lut);
+	}
+	bool clahe(const ImageViewGray& image, int tilesX, int tilesY, float clipLimit) {
+		// Error check
+		if (!image.hasData() || image.width <= 0 || image.height <= 0 || tilesX <= 0 || tilesY <= 0)
+			return false;
+
+		tilesX = std::min(tilesX, image.width);
+		tilesY = std::min(tilesY, image.height);
+		const ImageView samples(image.data, image.width, image.height, 1, image.stride);
+
+		// One clipped equalization table per tile
+		std::vector<std::array<unsigned char, 256>> tables(static_cast<size_t>(tilesX) * static_cast<size_t>(tilesY));
+		parallelForBands(0, tilesX * tilesY, [&](int tileBegin, int tileEnd) {
+			for (int tile = tileBegin; tile < tileEnd; tile++) {
+				const int tileX = tile % tilesX;
+				const int tileY = tile / tilesX;
+				const int left = static_cast<int>(static_cast<long long>(image.width) * tileX / tilesX);
+				const int right = static_cast<int>(static_cast<long long>(image.width) * (tileX + 1) / tilesX);
+				const int top = static_cast<int>(static_cast<long long>(image.height) * tileY / tilesY);
+				const int bottom = static_cast<int>(static_cast<long long>(image.height) * (tileY + 1) / tilesY);
+
+				Bins bins{};
+				countRows(samples.subView({ { left, top }, { right - left, bottom - top } }), nullptr, 0, bottom - top, bins);
+
+				// Clip the bins and spread the excess evenly, the remainder at a regular stride
+				const unsigned long long count = static_cast<unsigned long long>(right - left) * static_cast<unsigned long long>(bottom - top);
+				if (clipLimit > 0.0f) {
+					const unsigned long long limit = std::max(1ULL, static_cast<unsigned long long>(clipLimit * static_cast<float>(count) / 256.0f));
+					unsigned long long excess{ 0ULL };
+					for (unsigned long long& bin : bins[0]) {
+						if (bin > limit) {
+							excess += bin - limit;
+							bin = limit;
+						}
+					}
+					const unsigned long long share = excess / 256ULL;
+					const unsigned long long remainder = excess % 256ULL;
+					for (unsigned long long& bin : bins[0])
+						bin += share;
+					if (remainder != 0ULL) {
+						const unsigned long long step = std::max(256ULL / remainder, 1ULL);
+						for (unsigned long long level = 0ULL, given = 0ULL; level < 256ULL && given < remainder; level += step, given++)
+							bins[0][level]++;
+					}
+				}
+				equalizationTable(bins[0], 0ULL, count, tables[tile].data());
+			}
+		}, 1);
+
+		// Bilinear blend of the four nearest tile tables
+		const std::vector<Blend> columns = blendsOf(image.width, tilesX);
+		const std::vector<Blend> rows = blendsOf(image.height, tilesY);
+		parallelForBands(0, image.height, [&](int rowBegin, int rowEnd) {
+			for (int y = rowBegin; y < rowEnd; y++) {
+				const Blend& row = rows[y];
+				const std::array<unsigned char, 256>* upper = tables.data() + static_cast<size_t>(row.first) * static_cast<size_t>(tilesX);
+				const std::array<unsigned char, 256>* lower = tables.data() + static_cast<size_t>(row.second) * static_cast<size_t>(tilesX);
+				unsigned char* pixels = image.row(y);
+				for (int x = 0; x < image.width; x++) {
+					const Blend& column = columns[x];
+					const unsigned char level = pixels[x];
+					const float top = upper[column.first][level] + (upper[column.second][level] - upper[column.first][level]) * column.weight;
+					const float bottom = lower[column.first][level] + (lower[column.second][level] - lower[column.first][level]) * column.weight;
+					pixels[x] = static_cast<unsigned char>(top + (bottom - top) * row.weight + 0.5f);
+				}
+			}
+		}, BAND_ROWS);
+
+		return true;
+	}
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+// Dependencies | std
+#include <array>
+
+// Dependencies | glm
+#include <glm/vec4.hpp>
+
+// Dependencies | core
+#include <core/Rect.h>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Structs
+	struct Histogram {
+		// Properties
+		int channels{ 0 };
+		int binShift{ 0 }; // A bin covers 1 << binShift levels: 0 for 8-bit images, 8 for 16-bit ones
+		std::array<std::array<unsigned long long, 256>, 4> bins{};
+
+		// Functions
+		unsigned long long count(int channel = 0) const;
+		int percentile(double fraction, int channel = 0) const; // Smallest bin whose cumulative count reaches fraction
+	};
+
+	struct ChannelStatistics {
+		// Properties
+		int minimum{ 0 };
+		int maximum{ 0 };
+		double mean{ 0.0 };
+		double standardDeviation{ 0.0 };
+	};
+
+	struct ImageStatistics {
+		// Properties
+		int channels{ 0 };
+		unsigned long long count{ 0 }; // Pixels that contributed
+		std::array<ChannelStatistics, 4> channel{};
+	};
+
+	// Functions | histograms
+	// 8-bit formats go through ImageView (ImageGray, ImageGrayAlpha, ImageRGB and ImageRGBA convert implicitly); 16-bit
+	// samples are binned by their high byte. Every band of rows counts into its own histogram and the bands are merged at
+	// the end. A mask must have the size of the image; only pixels where it is non-zero are counted.
+	bool computeHistogram(const ImageView& image, Histogram& histogram);
+	bool computeHistogram(const ImageView& image, const ui::Rect& region, Histogram& histogram);
+	bool computeHistogram(const ImageView& image, const ImageViewGray& mask, Histogram& histogram);
+	bool computeHistogram(const ImageGray16& image, Histogram& histogram);
+	bool computeHistogram(const ImageGray16& image, const ui::Rect& region, Histogram& histogram);
+	bool computeHistogram(const ImageGray16& image, const ImageViewGray& mask, Histogram& histogram);
+	bool computeHistogram(const ImageGrayAlpha16& image, Histogram& histogram);
+	bool computeHistogram(const ImageGrayAlpha16& image, const ui::Rect& region, Histogram& histogram);
+	bool computeHistogram(const ImageGrayAlpha16& image, const ImageViewGray& mask, Histogram& histogram);
+	bool computeHistogram(const ImageRGB16& image, Histogram& histogram);
+	bool computeHistogram(const ImageRGB16& image, const ui::Rect& region, Histogram& histogram);
+	bool computeHistogram(const ImageRGB16& image, const ImageViewGray& mask, Histogram& histogram);
+	bool computeHistogram(const ImageRGBA16& image, Histogram& histogram);
+	bool computeHistogram(const ImageRGBA16& image, const ui::Rect& region, Histogram& histogram);
+	bool computeHistogram(const ImageRGBA16& image, const ImageViewGray& mask, Histogram& histogram);
+
+	// Functions | statistics
+	// 8-bit statistics are derived from the histogram; 16-bit ones are exact, from SIMD min / max (scalar under a mask)
+	// and 64-bit running sums
+	bool computeStatistics(const ImageView& image, ImageStatistics& statistics);
+	bool computeStatistics(const ImageView& image, const ui::Rect& region, ImageStatistics& statistics);
+	bool computeStatistics(const ImageView& image, const ImageViewGray& mask, ImageStatistics& statistics);
+	bool computeStatistics(const ImageGray16& image, ImageStatistics& statistics);
+	bool computeStatistics(const ImageGray16& image, const ui::Rect& region, ImageStatistics& statistics);
+	bool computeStatistics(const ImageGray16& image, const ImageViewGray& mask, ImageStatistics& statistics);
+	bool computeStatistics(const ImageGrayAlpha16& image, ImageStatistics& statistics);
+	bool computeStatistics(const ImageGrayAlpha16& image, const ui::Rect& region, ImageStatistics& statistics);
+	bool computeStatistics(const ImageGrayAlpha16& image, const ImageViewGray& mask, ImageStatistics& statistics);
+	bool computeStatistics(const ImageRGB16& image, ImageStatistics& statistics);
+	bool computeStatistics(const ImageRGB16& image, const ui::Rect& region, ImageStatistics& statistics);
+	bool computeStatistics(const ImageRGB16& image, const ImageViewGray& mask, ImageStatistics& statistics);
+	bool computeStatistics(const ImageRGBA16& image, ImageStatistics& statistics);
+	bool computeStatistics(const ImageRGBA16& image, const ui::Rect& region, ImageStatistics& statistics);
+	bool computeStatistics(const ImageRGBA16& image, const ImageViewGray& mask, ImageStatistics& statistics);
+
+	// Per channel minimum and maximum only (unused channels are left at 0)
+	bool computeMinMax(const ImageView& image, glm::u8vec4& minimum, glm::u8vec4& maximum);
+	bool computeMinMax(const ImageGray16& image, glm::u16vec4& minimum, glm::u16vec4& maximum);
+	bool computeMinMax(const ImageGrayAlpha16& image, glm::u16vec4& minimum, glm::u16vec4& maximum);
+	bool computeMinMax(const ImageRGB16& image, glm::u16vec4& minimum, glm::u16vec4& maximum);
+	bool computeMinMax(const ImageRGBA16& image, glm::u16vec4& minimum, glm::u16vec4& maximum);
+
+	// Functions | tone (in place)
+	// Stretches every color channel so that the clipFraction darkest and brightest pixels saturate; alpha is kept
+	bool autoLevels(const ImageView& image, float clipFraction = 0.005f);
+	bool equalizeHistogram(const ImageViewGray& image);
+	// Contrast limited adaptive equalization over a tilesX x tilesY grid; clipLimit is a multiple of the mean bin count
+	bool clahe(const ImageViewGray& image, int tilesX = 8, int tilesY = 8, float clipLimit = 2.0f);
+}
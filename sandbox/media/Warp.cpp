@@ -0,0 +1,649 @@
+#include "Warp.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+// Dependencies | core
+#include <core/Parallel.h>
+#include <core/Simd.h>
+
+namespace it {
+	namespace {
+		// Source coordinates are stepped in 32.32 fixed point, filter weights have 8 fraction bits
+		constexpr int COORDINATE_BITS{ 32 };
+		constexpr std::int64_t COORDINATE_ONE{ std::int64_t{ 1 } << COORDINATE_BITS };
+		constexpr std::int64_t COORDINATE_HALF{ COORDINATE_ONE / 2 };
+		constexpr int WEIGHT_BITS{ 8 };
+		constexpr int WEIGHT_ONE{ 1 << WEIGHT_BITS };
+		constexpr int WEIGHT_HALF{ WEIGHT_ONE / 2 };
+		constexpr int PARALLEL_GRAIN{ 16384 }; // Destination pixels per parallel range
+
+		// Row-major 3x3 matrix in double so that the stepped coordinates stay exact across large images
+		using Matrix = std::array<double, 9>;
+
+		Matrix matrixOf(const AffineTransform& transform) {
+			return { transform.a, transform.b, transform.c, transform.d, transform.e, transform.f, 0.0, 0.0, 1.0 };
+		}
+		Matrix matrixOf(const PerspectiveTransform& transform) {
+			Matrix matrix{};
+			std::copy(transform.matrix.begin(), transform.matrix.end(), matrix.begin());
+			return matrix;
+		}
+
+		// first followed by next (next * first)
+		Matrix compose(const Matrix& first, const Matrix& next) {
+			Matrix result{};
+			for (int row = 0; row < 3; row++)
+				for (int column = 0; column < 3; column++)
+					result[row * 3 + column] = next[row * 3] * first[column] + next[row * 3 + 1] * first[3 + column] + next[row * 3 + 2] * first[6 + column];
+			return result;
+		}
+
+		// All zero when the matrix is singular
+		Matrix invert(const Matrix& m) {
+			const double c0 = m[4] * m[8] - m[5] * m[7];
+			const double c1 = m[5] * m[6] - m[3] * m[8];
+			const double c2 = m[3] * m[7] - m[4] * m[6];
+			const double determinant = m[0] * c0 + m[1] * c1 + m[2] * c2;
+
+			double scale = 0.0;
+			for (const double value : m)
+				scale = std::max(scale, std::abs(value));
+			if (!std::isfinite(determinant) || std::abs(determinant) <= 1e-12 * scale * scale * scale)
+				return {};
+
+			const double inverse = 1.0 / determinant;
+			return {
+				c0 * inverse, (m[2] * m[7] - m[1] * m[8]) * inverse, (m[1] * m[5] - m[2] * m[4]) * inverse,
+				c1 * inverse, (m[0] * m[8] - m[2] * m[6]) * inverse, (m[2] * m[3] - m[0] * m[5]) * inverse,
+				c2 * inverse, (m[1] * m[6] - m[0] * m[7]) * inverse, (m[0] * m[4] - m[1] * m[3]) * inverse
+			};
+		}
+		bool isZero(const Matrix& matrix) {
+			return std::all_of(matrix.begin(), matrix.end(), [](double value) { return value == 0.0; });
+		}
+
+		ui::Rect boundsOf(int width, int height, const Matrix& m) {
+			// Error check
+			if (width <= 0 || height <= 0)
+				return {};
+
+			// Far beyond any image, keeps the conversion to int defined
+			constexpr double LIMIT{ 1 << 30 };
+			double minimumX = LIMIT, minimumY = LIMIT, maximumX = -LIMIT, maximumY = -LIMIT;
+			for (int corner = 0; corner < 4; corner++) {
+				const double x = (corner & 1) ? width : 0.0;
+				const double y = (corner & 2) ? height : 0.0;
+				const double w = m[6] * x + m[7] * y + m[8];
+				if (!(w > 1e-12))
+					return {};
+
+				const double projectedX = (m[0] * x + m[1] * y + m[2]) / w;
+				const double projectedY = (m[3] * x + m[4] * y + m[5]) / w;
+				minimumX = std::min(minimumX, projectedX);
+				minimumY = std::min(minimumY, projectedY);
+				maximumX = std::max(maximumX, projectedX);
+				maximumY = std::max(maximumY, projectedY);
+			}
+
+			const int left = static_cast<int>(std::floor(std::clamp(minimumX, -LIMIT, LIMIT)));
+			const int top = static_cast<int>(std::floor(std::clamp(minimumY, -LIMIT, LIMIT)));
+			const int right = static_cast<int>(std::ceil(std::clamp(maximumX, -LIMIT, LIMIT)));
+			const int bottom = static_cast<int>(std::ceil(std::clamp(maximumY, -LIMIT, LIMIT)));
+			return { { left, top }, { right - left, bottom - top } };
+		}
+
+		// Rows of samples of one format
+		struct Plane {
+			unsigned char* data{ nullptr };
+			int width{ 0 };
+			int height{ 0 };
+			std::ptrdiff_t stride{ 0 };
+			int channels{ 0 };
+			int sampleSize{ 0 };
+
+			template<typename Sample>
+			Sample* row(int y) const {
+				return reinterpret_cast<Sample*>(data + static_cast<std::ptrdiff_t>(y) * stride);
+			}
+		};
+
+		Plane planeOf(const ImageView& view) {
+			return { view.data, view.width, view.height, static_cast<std::ptrdiff_t>(view.stride), view.channels, 1 };
+		}
+		template<typename Image>
+		Plane planeOf(const Image& image) {
+			constexpr int PIXEL_SIZE = static_cast<int>(sizeof(*image.getData()));
+			return { reinterpret_cast<unsigned char*>(image.getData()), image.getWidth(), image.getHeight(), static_cast<std::ptrdiff_t>(image.getWidth()) * PIXEL_SIZE, Image::CHANNELS, PIXEL_SIZE / Image::CHANNELS };
+		}
+
+		// Catmull-Rom taps for x0 - 1 .. x0 + 2 per 1/256 fraction; every row sums to exactly WEIGHT_ONE
+		using CubicWeights = std::array<std::array<int, 4>, WEIGHT_ONE>;
+
+		double catmullRom(double x) {
+			constexpr double A{ -0.5 };
+			x = std::abs(x);
+			if (x <= 1.0)
+				return ((A + 2.0) * x - (A + 3.0)) * x * x + 1.0;
+			if (x < 2.0)
+				return ((A * x - 5.0 * A) * x + 8.0 * A) * x - 4.0 * A;
+			return 0.0;
+		}
+		const CubicWeights& cubicWeights() {
+			static const CubicWeights WEIGHTS = [] {
+				CubicWeights weights{};
+				for (int fraction = 0; fraction < WEIGHT_ONE; fraction++) {
+					const double t = static_cast<double>(fraction) / WEIGHT_ONE;
+					int sum = 0;
+					int largest = 0;
+					for (int tap = 0; tap < 4; tap++) {
+						weights[fraction][tap] = static_cast<int>(std::lround(catmullRom(t - (tap - 1)) * WEIGHT_ONE));
+						sum += weights[fraction][tap];
+						if (weights[fraction][tap] > weights[fraction][largest])
+							largest = tap;
+					}
+					weights[fraction][largest] += WEIGHT_ONE - sum;
+				}
+				return weights;
+			}();
+			return WEIGHTS;
+		}
+
+		// Alpha, always the last channel of gray alpha and RGBA
+		template<typename Sample>
+		constexpr int MAXIMUM = std::numeric_limits<Sample>::max();
+		template<int CHANNELS>
+		constexpr bool HAS_ALPHA = CHANNELS == 2 || CHANNELS == 4;
+
+		// Formats with alpha are filtered as color * alpha and alpha * MAXIMUM without rounding, so that colors keep
+		// their precision however transparent the pixels are; the division by alpha happens once per output pixel
+		template<typename Sample, int CHANNELS>
+		using Value = std::conditional_t<HAS_ALPHA<CHANNELS> && sizeof(Sample) != 1, long long, int>;
+		template<typename Sample>
+		constexpr long long PREMULTIPLIED_MAXIMUM = static_cast<long long>(MAXIMUM<Sample>) * MAXIMUM<Sample>;
+
+		// Clamps filtered values, takes the alpha out again and stores the pixel
+		template<typename Sample, int CHANNELS>
+		void storePixel(const Value<Sample, CHANNELS>* values, Sample* pixel) {
+			using V = Value<Sample, CHANNELS>;
+			if constexpr (!HAS_ALPHA<CHANNELS>) {
+				for (int channel = 0; channel < CHANNELS; channel++)
+					pixel[channel] = static_cast<Sample>(std::clamp(values[channel], 0, MAXIMUM<Sample>));
+			} else {
+				// One reciprocal per pixel instead of a division per color; double keeps the 16-bit products exact
+				using Real = std::conditional_t<sizeof(Sample) == 1, float, double>;
+				const V alpha = std::clamp(values[CHANNELS - 1], V{ 0 }, static_cast<V>(PREMULTIPLIED_MAXIMUM<Sample>));
+				pixel[CHANNELS - 1] = static_cast<Sample>((alpha + MAXIMUM<Sample> / 2) / MAXIMUM<Sample>);
+				const Real scale = pixel[CHANNELS - 1] == 0 ? Real{ 0 } : static_cast<Real>(MAXIMUM<Sample>) / static_cast<Real>(alpha);
+				for (int channel = 0; channel < CHANNELS - 1; channel++)
+					pixel[channel] = static_cast<Sample>(static_cast<Real>(std::clamp(values[channel], V{ 0 }, alpha)) * scale + Real{ 0.5 });
+			}
+		}
+
+		template<typename Sample, int CHANNELS>
+		void loadTap(const Sample* pixel, Value<Sample, CHANNELS>* values) {
+			for (int channel = 0; channel < CHANNELS; channel++)
+				values[channel] = pixel[channel];
+			if constexpr (HAS_ALPHA<CHANNELS>) {
+				for (int channel = 0; channel < CHANNELS - 1; channel++)
+					values[channel] *= values[CHANNELS - 1];
+				values[CHANNELS - 1] *= MAXIMUM<Sample>;
+			}
+		}
+
+		// Separable filter over TAPS x TAPS clamped source pixels: rows are summed and rounded first, then the columns.
+		// Premultiplied rows are clamped to the range of their taps, as the 16-bit lanes of the SIMD path do.
+		template<typename Sample, int CHANNELS, int TAPS>
+		void filterPixel(const Plane& source, const int* columns, const int* rows, const int* weightsX, const int* weightsY, Sample* pixel) {
+			using V = Value<Sample, CHANNELS>;
+			V sums[CHANNELS]{};
+			for (int j = 0; j < TAPS; j++) {
+				const Sample* row = source.row<Sample>(rows[j]);
+				V horizontal[CHANNELS]{};
+				for (int i = 0; i < TAPS; i++) {
+					V tap[CHANNELS];
+					loadTap<Sample, CHANNELS>(row + static_cast<std::ptrdiff_t>(columns[i]) * CHANNELS, tap);
+					for (int channel = 0; channel < CHANNELS; channel++)
+						horizontal[channel] += weightsX[i] * tap[channel];
+				}
+				for (int channel = 0; channel < CHANNELS; channel++) {
+					V rounded = (horizontal[channel] + WEIGHT_HALF) >> WEIGHT_BITS;
+					if constexpr (HAS_ALPHA<CHANNELS>)
+						rounded = std::clamp(rounded, V{ 0 }, static_cast<V>(PREMULTIPLIED_MAXIMUM<Sample>));
+					sums[channel] += weightsY[j] * rounded;
+				}
+			}
+
+			V values[CHANNELS];
+			for (int channel = 0; channel < CHANNELS; channel++)
+				values[channel] = (sums[channel] + WEIGHT_HALF) >> WEIGHT_BITS;
+			storePixel<Sample, CHANNELS>(values, pixel);
+		}
+
+#if defined(IT_SIMD_SSE2)
+		// The premultiplied samples (up to 255 * 255) fill unsigned 16-bit lanes; pmaddwd multiplies signed ones, so the
+		// lanes hold sample - 32768. Every weight set sums to WEIGHT_ONE, which turns the offset into a constant.
+		constexpr short SAMPLE_OFFSET{ static_cast<short>(0x8000) };
+		constexpr int OFFSET_SUM{ 32768 << WEIGHT_BITS };
+
+		// Premultiplies the colors of two RGBA pixels held in 16-bit lanes (alpha times 255) and offsets them
+		inline __m128i premultiplyRgba(__m128i pixels) {
+			const __m128i COLOR_LANES = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+			const __m128i ALPHA_FACTOR = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+			const __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+			const __m128i factors = _mm_or_si128(_mm_and_si128(alpha, COLOR_LANES), ALPHA_FACTOR);
+			return _mm_xor_si128(_mm_mullo_epi16(pixels, factors), _mm_set1_epi16(SAMPLE_OFFSET));
+		}
+		// Rounded offset rows of two pixels, clamped to 0 .. 255 * 255 like the scalar path: packs clamps the bottom
+		inline __m128i packRows(__m128i first, __m128i second) {
+			return _mm_min_epi16(_mm_packs_epi32(first, second), _mm_set1_epi16(static_cast<short>(255 * 255 - 32768)));
+		}
+		// first * weights.low + second * weights.high per channel of two pixels in 16-bit lanes, as 32-bit lanes
+		inline __m128i weighPair(__m128i pixels, __m128i weights) {
+			return _mm_madd_epi16(_mm_unpacklo_epi16(pixels, _mm_srli_si128(pixels, 8)), weights);
+		}
+		inline __m128i roundWeights(__m128i sums) {
+			return _mm_srai_epi32(_mm_add_epi32(sums, _mm_set1_epi32(WEIGHT_HALF)), WEIGHT_BITS);
+		}
+		inline __m128i pairWeights(int first, int second) {
+			return _mm_set1_epi32(static_cast<int>((static_cast<std::uint32_t>(second) << 16) | (static_cast<std::uint32_t>(first) & 0xFFFFU)));
+		}
+		inline __m128i loadRgbaPair(const unsigned char* pixels) {
+			return premultiplyRgba(_mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pixels)), _mm_setzero_si128()));
+		}
+		inline void storeRgba(__m128i sums, unsigned char* pixel) {
+			int values[4];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(values), sums);
+			storePixel<unsigned char, 4>(values, pixel);
+		}
+
+		// Interior pixels only: all taps inside the source
+		void bilinearRgba(const Plane& source, int x0, int y0, int fractionX, int fractionY, unsigned char* pixel) {
+			const __m128i weightsX = pairWeights(WEIGHT_ONE - fractionX, fractionX);
+			const unsigned char* top = source.row<unsigned char>(y0) + static_cast<std::ptrdiff_t>(x0) * 4;
+			const __m128i rows = packRows(roundWeights(weighPair(loadRgbaPair(top), weightsX)), roundWeights(weighPair(loadRgbaPair(top + source.stride), weightsX)));
+			storeRgba(roundWeights(_mm_add_epi32(weighPair(rows, pairWeights(WEIGHT_ONE - fractionY, fractionY)), _mm_set1_epi32(OFFSET_SUM))), pixel);
+		}
+		void bicubicRgba(const Plane& source, int x0, int y0, int fractionX, int fractionY, unsigned char* pixel) {
+			const std::array<int, 4>& tapsX = cubicWeights()[fractionX];
+			const std::array<int, 4>& tapsY = cubicWeights()[fractionY];
+			const __m128i weightsX01 = pairWeights(tapsX[0], tapsX[1]);
+			const __m128i weightsX23 = pairWeights(tapsX[2], tapsX[3]);
+
+			__m128i rows[4];
+			const unsigned char* row = source.row<unsigned char>(y0 - 1) + static_cast<std::ptrdiff_t>(x0 - 1) * 4;
+			for (int j = 0; j < 4; j++, row += source.stride)
+				rows[j] = roundWeights(_mm_add_epi32(weighPair(loadRgbaPair(row), weightsX01), weighPair(loadRgbaPair(row + 8), weightsX23)));
+
+			// Same rounding as the scalar path: rows are rounded to integers before the vertical pass
+			const __m128i sums = _mm_add_epi32(
+				weighPair(packRows(rows[0], rows[1]), pairWeights(tapsY[0], tapsY[1])),
+				weighPair(packRows(rows[2], rows[3]), pairWeights(tapsY[2], tapsY[3])));
+			storeRgba(roundWeights(_mm_add_epi32(sums, _mm_set1_epi32(OFFSET_SUM))), pixel);
+		}
+#endif
+
+		// Samples the source at the fixed point position (pixel centers at integers) into pixel
+		template<typename Sample, int CHANNELS>
+		void samplePixel(const Plane& source, std::int64_t sampleX, std::int64_t sampleY, WarpFilter filter, Sample* pixel) {
+			if (filter == WarpFilter::NEAREST) {
+				const int x = std::clamp(static_cast<int>((sampleX + COORDINATE_HALF) >> COORDINATE_BITS), 0, source.width - 1);
+				const int y = std::clamp(static_cast<int>((sampleY + COORDINATE_HALF) >> COORDINATE_BITS), 0, source.height - 1);
+				std::memcpy(pixel, source.row<Sample>(y) + static_cast<std::ptrdiff_t>(x) * CHANNELS, sizeof(Sample) * CHANNELS);
+				return;
+			}
+
+			const int x0 = static_cast<int>(sampleX >> COORDINATE_BITS);
+			const int y0 = static_cast<int>(sampleY >> COORDINATE_BITS);
+			const int fractionX = static_cast<int>((sampleX >> (COORDINATE_BITS - WEIGHT_BITS)) & (WEIGHT_ONE - 1));
+			const int fractionY = static_cast<int>((sampleY >> (COORDINATE_BITS - WEIGHT_BITS)) & (WEIGHT_ONE - 1));
+
+			if (filter == WarpFilter::BILINEAR) {
+#if defined(IT_SIMD_SSE2)
+				if constexpr (std::is_same_v<Sample, unsigned char> && CHANNELS == 4) {
+					if (x0 >= 0 && y0 >= 0 && x0 + 1 < source.width && y0 + 1 < source.height) {
+						bilinearRgba(source, x0, y0, fractionX, fractionY, pixel);
+						return;
+					}
+				}
+#endif
+				const int columns[2]{ std::clamp(x0, 0, source.width - 1), std::clamp(x0 + 1, 0, source.width - 1) };
+				const int rows[2]{ std::clamp(y0, 0, source.height - 1), std::clamp(y0 + 1, 0, source.height - 1) };
+				const int weightsX[2]{ WEIGHT_ONE - fractionX, fractionX };
+				const int weightsY[2]{ WEIGHT_ONE - fractionY, fractionY };
+				filterPixel<Sample, CHANNELS, 2>(source, columns, rows, weightsX, weightsY, pixel);
+			} else {
+#if defined(IT_SIMD_SSE2)
+				if constexpr (std::is_same_v<Sample, unsigned char> && CHANNELS == 4) {
+					if (x0 >= 1 && y0 >= 1 && x0 + 2 < source.width && y0 + 2 < source.height) {
+						bicubicRgba(source, x0, y0, fractionX, fractionY, pixel);
+						return;
+					}
+				}
+#endif
+				int columns[4], rows[4];
+				for (int tap = 0; tap < 4; tap++) {
+					columns[tap] = std::clamp(x0 + tap - 1, 0, source.width - 1);
+					rows[tap] = std::clamp(y0 + tap - 1, 0, source.height - 1);
+				}
+				filterPixel<Sample, CHANNELS, 4>(source, columns, rows, cubicWeights()[fractionX].data(), cubicWeights()[fractionY].data(), pixel);
+			}
+		}
+
+		// Narrows [begin, end) to the x where alpha * x + beta > 0 (or >= 0 for inclusive)
+		void clipSpan(double alpha, double beta, double& begin, double& end) {
+			if (alpha > 0.0)
+				begin = std::max(begin, -beta / alpha);
+			else if (alpha < 0.0)
+				end = std::min(end, -beta / alpha);
+			else if (beta < 0.0)
+				end = begin;
+		}
+
+		std::int64_t toFixed(double value) {
+			constexpr double LIMIT{ 1 << 30 };
+			return static_cast<std::int64_t>(std::llround(std::clamp(value, -LIMIT, LIMIT) * static_cast<double>(COORDINATE_ONE)));
+		}
+
+		// Destination to source mapping of one warp
+		struct Mapping {
+			Matrix inverse{};
+			bool affine{ false };
+		};
+
+		// Destination pixels of row y whose centers map inside the source, widened by a pixel on both sides; the exact
+		// test happens per pixel
+		bool rowSpan(const Plane& source, const Mapping& mapping, int y, int left, int right, int& spanBegin, int& spanEnd) {
+			const Matrix& m = mapping.inverse;
+			const double centerY = y + 0.5;
+			const double width = source.width;
+			const double height = source.height;
+
+			// Pixel centers x + 0.5 with u = nu / w, v = nv / w: w > 0, 0 <= nu < width * w, 0 <= nv < height * w
+			const double nuSlope = m[0], nuOffset = m[1] * centerY + m[2] + 0.5 * m[0];
+			const double nvSlope = m[3], nvOffset = m[4] * centerY + m[5] + 0.5 * m[3];
+			const double wSlope = m[6], wOffset = m[7] * centerY + m[8] + 0.5 * m[6];
+
+			double begin = left, end = right;
+			if (!mapping.affine)
+				clipSpan(wSlope, wOffset, begin, end);
+			clipSpan(nuSlope, nuOffset, begin, end);
+			clipSpan(width * wSlope - nuSlope, width * wOffset - nuOffset, begin, end);
+			clipSpan(nvSlope, nvOffset, begin, end);
+			clipSpan(height * wSlope - nvSlope, height * wOffset - nvOffset, begin, end);
+			if (!(begin < end))
+				return false;
+
+			spanBegin = std::max(left, static_cast<int>(std::floor(begin)) - 1);
+			spanEnd = std::min(right, static_cast<int>(std::ceil(end)) + 1);
+			return spanBegin < spanEnd;
+		}
+
+		template<typename Sample, int CHANNELS>
+		void warpRow(const Plane& source, const Plane& destination, const Mapping& mapping, int y, int begin, int end, WarpFilter filter) {
+			const Matrix& m = mapping.inverse;
+			const double centerX = begin + 0.5;
+			const double centerY = y + 0.5;
+			Sample* pixel = destination.row<Sample>(y) + static_cast<std::ptrdiff_t>(begin) * CHANNELS;
+			const std::int64_t limitX = static_cast<std::int64_t>(source.width) << COORDINATE_BITS;
+			const std::int64_t limitY = static_cast<std::int64_t>(source.height) << COORDINATE_BITS;
+
+			if (mapping.affine) {
+				// The source position moves by a constant step per destination pixel
+				std::int64_t u = toFixed(m[0] * centerX + m[1] * centerY + m[2]);
+				std::int64_t v = toFixed(m[3] * centerX + m[4] * centerY + m[5]);
+				const std::int64_t stepU = toFixed(m[0]);
+				const std::int64_t stepV = toFixed(m[3]);
+				for (int x = begin; x < end; x++, pixel += CHANNELS, u += stepU, v += stepV)
+					if (u >= 0 && u < limitX && v >= 0 && v < limitY)
+						samplePixel<Sample, CHANNELS>(source, u - COORDINATE_HALF, v - COORDINATE_HALF, filter, pixel);
+				return;
+			}
+
+			// Numerators and denominator step linearly, one division per pixel
+			double nu = m[0] * centerX + m[1] * centerY + m[2];
+			double nv = m[3] * centerX + m[4] * centerY + m[5];
+			double w = m[6] * centerX + m[7] * centerY + m[8];
+			for (int x = begin; x < end; x++, pixel += CHANNELS, nu += m[0], nv += m[3], w += m[6]) {
+				if (!(w > 0.0))
+					continue;
+				const double reciprocal = 1.0 / w;
+				const std::int64_t u = toFixed(nu * reciprocal);
+				const std::int64_t v = toFixed(nv * reciprocal);
+				if (u >= 0 && u < limitX && v >= 0 && v < limitY)
+					samplePixel<Sample, CHANNELS>(source, u - COORDINATE_HALF, v - COORDINATE_HALF, filter, pixel);
+			}
+		}
+
+		template<typename Sample, int CHANNELS>
+		void warpRows(const Plane& source, const Plane& destination, const Mapping& mapping, const ui::Rect& bounds, WarpFilter filter) {
+			const int grainRows = std::max(1, PARALLEL_GRAIN / bounds.width());
+			parallelFor(bounds.top(), bounds.bottom(), [&](int rowBegin, int rowEnd) {
+				for (int y = rowBegin; y < rowEnd; y++) {
+					int spanBegin, spanEnd;
+					if (rowSpan(source, mapping, y, bounds.left(), bounds.right(), spanBegin, spanEnd))
+						warpRow<Sample, CHANNELS>(source, destination, mapping, y, spanBegin, spanEnd, filter);
+				}
+			}, grainRows);
+		}
+
+		template<typename Sample>
+		bool warpChannels(const Plane& source, const Plane& destination, const Mapping& mapping, const ui::Rect& bounds, WarpFilter filter) {
+			switch (source.channels) {
+				case 1:
+					warpRows<Sample, 1>(source, destination, mapping, bounds, filter);
+					return true;
+				case 2:
+					warpRows<Sample, 2>(source, destination, mapping, bounds, filter);
+					return true;
+				case 3:
+					warpRows<Sample, 3>(source, destination, mapping, bounds, filter);
+					return true;
+				case 4:
+					warpRows<Sample, 4>(source, destination, mapping, bounds, filter);
+					return true;
+				default:
+					return false;
+			}
+		}
+
+		bool warp(const Plane& source, const Plane& destination, const Matrix& transform, WarpFilter filter) {
+			// Error check
+			if (!source.data || !destination.data || source.width <= 0 || source.height <= 0 || destination.width <= 0 || destination.height <= 0)
+				return false;
+			if (source.channels != destination.channels || source.sampleSize != destination.sampleSize)
+				return false;
+
+			Mapping mapping;
+			mapping.inverse = invert(transform);
+			if (isZero(mapping.inverse))
+				return false;
+			mapping.affine = mapping.inverse[6] == 0.0 && mapping.inverse[7] == 0.0;
+			if (mapping.affine) {
+				const double w = mapping.inverse[8];
+				for (double& value : mapping.inverse)
+					value /= w;
+			}
+
+			// Rows outside the transformed rectangle are never visited; without finite bounds every row is solved
+			const ui::Rect target{ { 0, 0 }, { destination.width, destination.height } };
+			ui::Rect bounds = boundsOf(source.width, source.height, transform);
+			bounds = bounds.isValid() ? bounds.intersected(target) : target;
+			if (!bounds.isValid())
+				return true;
+
+			switch (source.sampleSize) {
+				case 1:
+					return warpChannels<unsigned char>(source, destination, mapping, bounds, filter);
+				case 2:
+					return warpChannels<unsigned short>(source, destination, mapping, bounds, filter);
+				default:
+					return false;
+			}
+		}
+	}
+
+	// Structs | AffineTransform
+	AffineTransform AffineTransform::then(const AffineTransform& next) const {
+		return {
+			next.a * a + next.b * d, next.a * b + next.b * e, next.a * c + next.b * f + next.c,
+			next.d * a + next.e * d, next.d * b + next.e * e, next.d * c + next.e * f + next.f
+		};
+	}
+	AffineTransform AffineTransform::inverse() const {
+		const Matrix matrix = invert(matrixOf(*this));
+		return {
+			static_cast<float>(matrix[0]), static_cast<float>(matrix[1]), static_cast<float>(matrix[2]),
+			static_cast<float>(matrix[3]), static_cast<float>(matrix[4]), static_cast<float>(matrix[5])
+		};
+	}
+	bool AffineTransform::isInvertible() const {
+		return !isZero(invert(matrixOf(*this)));
+	}
+	glm::vec2 AffineTransform::apply(glm::vec2 point) const {
+		return { a * point.x + b * point.y + c, d * point.x + e * point.y + f };
+	}
+
+	// Structs | PerspectiveTransform
+	PerspectiveTransform::PerspectiveTransform(const AffineTransform& affine)
+		: matrix{ affine.a, affine.b, affine.c, affine.d, affine.e, affine.f, 0.0f, 0.0f, 1.0f } {}
+
+	PerspectiveTransform PerspectiveTransform::then(const PerspectiveTransform& next) const {
+		const Matrix composed = compose(matrixOf(*this), matrixOf(next));
+		PerspectiveTransform result;
+		std::transform(composed.begin(), composed.end(), result.matrix.begin(), [](double value) { return static_cast<float>(value); });
+		return result;
+	}
+	PerspectiveTransform PerspectiveTransform::inverse() const {
+		const Matrix inverted = invert(matrixOf(*this));
+		PerspectiveTransform result;
+		std::transform(inverted.begin(), inverted.end(), result.matrix.begin(), [](double value) { return static_cast<float>(value); });
+		return result;
+	}
+	bool PerspectiveTransform::isInvertible() const {
+		return !isZero(invert(matrixOf(*this)));
+	}
+	glm::vec2 PerspectiveTransform::apply(glm::vec2 point) const {
+		const float w = matrix[6] * point.x + matrix[7] * point.y + matrix[8];
+		return {
+			(matrix[0] * point.x + matrix[1] * point.y + matrix[2]) / w,
+			(matrix[3] * point.x + matrix[4] * point.y + matrix[5]) / w
+		};
+	}
+
+	// Functions | transforms
+	AffineTransform translationTransform(glm::vec2 offset) {
+		return { 1.0f, 0.0f, offset.x, 0.0f, 1.0f, offset.y };
+	}
+	AffineTransform scalingTransform(glm::vec2 factors, glm::vec2 center) {
+		return { factors.x, 0.0f, center.x - factors.x * center.x, 0.0f, factors.y, center.y - factors.y * center.y };
+	}
+	AffineTransform rotationTransform(float radians, glm::vec2 center) {
+		const float cosine = std::cos(radians);
+		const float sine = std::sin(radians);
+		return {
+			cosine, -sine, center.x - cosine * center.x + sine * center.y,
+			sine, cosine, center.y - sine * center.x - cosine * center.y
+		};
+	}
+	PerspectiveTransform quadTransform(const std::array<glm::vec2, 4>& from, const std::array<glm::vec2, 4>& to) {
+		// Two equations per corner for m0..m7 with m8 = 1, solved by Gaussian elimination with partial pivoting
+		double system[8][9]{};
+		for (int corner = 0; corner < 4; corner++) {
+			const double x = from[corner].x, y = from[corner].y;
+			const double targetX = to[corner].x, targetY = to[corner].y;
+			double* rowX = system[corner * 2];
+			double* rowY = system[corner * 2 + 1];
+			rowX[0] = x; rowX[1] = y; rowX[2] = 1.0; rowX[6] = -x * targetX; rowX[7] = -y * targetX; rowX[8] = targetX;
+			rowY[3] = x; rowY[4] = y; rowY[5] = 1.0; rowY[6] = -x * targetY; rowY[7] = -y * targetY; rowY[8] = targetY;
+		}
+
+		double scale = 0.0;
+		for (const auto& row : system)
+			for (int column = 0; column < 8; column++)
+				scale = std::max(scale, std::abs(row[column]));
+
+		for (int column = 0; column < 8; column++) {
+			int pivot = column;
+			for (int row = column + 1; row < 8; row++)
+				if (std::abs(system[row][column]) > std::abs(system[pivot][column]))
+					pivot = row;
+			if (!(std::abs(system[pivot][column]) > 1e-12 * scale)) {
+				PerspectiveTransform degenerate;
+				degenerate.matrix.fill(0.0f);
+				return degenerate;
+			}
+			std::swap(system[column], system[pivot]);
+
+			for (int row = 0; row < 8; row++) {
+				if (row == column)
+					continue;
+				const double factor = system[row][column] / system[column][column];
+				for (int index = column; index < 9; index++)
+					system[row][index] -= factor * system[column][index];
+			}
+		}
+
+		PerspectiveTransform result;
+		for (int index = 0; index < 8; index++)
+			result.matrix[index] = static_cast<float>(system[index][8] / system[index][index]);
+		result.matrix[8] = 1.0f;
+		if (!result.isInvertible())
+			result.matrix.fill(0.0f);
+		return result;
+	}
+
+	// Functions | bounds
+	ui::Rect warpedBounds(int sourceWidth, int sourceHeight, const AffineTransform& transform) {
+		return boundsOf(sourceWidth, sourceHeight, matrixOf(transform));
+	}
+	ui::Rect warpedBounds(int sourceWidth, int sourceHeight, const PerspectiveTransform& transform) {
+		return boundsOf(sourceWidth, sourceHeight, matrixOf(transform));
+	}
+
+	// Functions | warping
+	bool warpAffine(const ImageView& source, const ImageView& destination, const AffineTransform& transform, WarpFilter filter) {
+		return warp(planeOf(source), planeOf(destination), matrixOf(transform), filter);
+	}
+	bool warpPerspective(const ImageView& source, const ImageView& destination, const PerspectiveTransform& transform, WarpFilter filter) {
+		return warp(planeOf(source), planeOf(destination), matrixOf(transform), filter);
+	}
+
+	template<IsImage Image>
+	bool warpAffine(const Image& source, Image& destination, const AffineTransform& transform, WarpFilter filter) {
+		// Error check
+		if (&source == &destination)
+			return false;
+
+		return warp(planeOf(source), planeOf(destination), matrixOf(transform), filter);
+	}
+	template<IsImage Image>
+	bool warpPerspective(const Image& source, Image& destination, const PerspectiveTransform& transform, WarpFilter filter) {
+		// Error check
+		if (&source == &destination)
+			return false;
+
+		return warp(planeOf(source), planeOf(destination), matrixOf(transform), filter);
+	}
+
+#define IT_WARP_INSTANTIATE(Image) \
+	template bool warpAffine<Image>(const Image&, Image&, const AffineTransform&, WarpFilter); \
+	template bool warpPerspective<Image>(const Image&, Image&, const PerspectiveTransform&, WarpFilter);
+
+	IT_WARP_INSTANTIATE(ImageGray)
+	IT_WARP_INSTANTIATE(ImageGrayAlpha)
+	IT_WARP_INSTANTIATE(ImageRGB)
+	IT_WARP_INSTANTIATE(ImageRGBA)
+	IT_WARP_INSTANTIATE(ImageGray16)
+	IT_WARP_INSTANTIATE(ImageGrayAlpha16)
+	IT_WARP_INSTANTIATE(ImageRGB16)
+	IT_WARP_INSTANTIATE(ImageRGBA16)
+
+#undef IT_WARP_INSTANTIATE
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+// Dependencies | std
+#include <array>
+
+// Dependencies | glm
+#include <glm/vec2.hpp>
+
+// Dependencies | core
+#include <core/Rect.h>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Enums
+	enum class WarpFilter {
+		NEAREST,
+		BILINEAR,
+		BICUBIC		// Catmull-Rom, like ResampleFilter::BICUBIC
+	};
+
+	// Structs
+	// Maps source coordinates to destination coordinates: x' = a * x + b * y + c, y' = d * x + e * y + f
+	struct AffineTransform {
+		// Properties
+		float a{ 1.0f };
+		float b{ 0.0f };
+		float c{ 0.0f };
+		float d{ 0.0f };
+		float e{ 1.0f };
+		float f{ 0.0f };
+
+		// Functions
+		AffineTransform then(const AffineTransform& next) const; // This followed by next
+		AffineTransform inverse() const; // All zero when the transform is not invertible
+		bool isInvertible() const;
+		glm::vec2 apply(glm::vec2 point) const;
+	};
+
+	// Maps source coordinates to destination coordinates through a row-major homography:
+	// x' = (m0 * x + m1 * y + m2) / (m6 * x + m7 * y + m8), y' = (m3 * x + m4 * y + m5) / (m6 * x + m7 * y + m8)
+	struct PerspectiveTransform {
+		// Properties
+		std::array<float, 9> matrix{ 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+
+		// Constructors
+		PerspectiveTransform() = default;
+		PerspectiveTransform(const AffineTransform& affine);
+
+		// Functions
+		PerspectiveTransform then(const PerspectiveTransform& next) const; // This followed by next
+		PerspectiveTransform inverse() const; // All zero when the transform is not invertible
+		bool isInvertible() const;
+		glm::vec2 apply(glm::vec2 point) const;
+	};
+
+	// Functions | transforms
+	AffineTransform translationTransform(glm::vec2 offset);
+	AffineTransform scalingTransform(glm::vec2 factors, glm::vec2 center = glm::vec2(0.0f));
+	AffineTransform rotationTransform(float radians, glm::vec2 center = glm::vec2(0.0f)); // Clockwise on screen (y down)
+	// Maps the corners from onto the corners to (same order, e.g. the detected corners of a skewed document onto an
+	// upright rectangle); not invertible when either quad is degenerate
+	PerspectiveTransform quadTransform(const std::array<glm::vec2, 4>& from, const std::array<glm::vec2, 4>& to);
+
+	// Functions | bounds
+	// Pixels covered by the transformed sourceWidth x sourceHeight rectangle; empty when the perspective maps part of
+	// it behind the viewer (to infinity)
+	ui::Rect warpedBounds(int sourceWidth, int sourceHeight, const AffineTransform& transform);
+	ui::Rect warpedBounds(int sourceWidth, int sourceHeight, const PerspectiveTransform& transform);
+
+	// Functions | warping
+	// Draws source into destination at transform (source to destination coordinates). Only destination pixels whose
+	// centers fall inside the transformed source rectangle are written; their rows come from warpedBounds and the span
+	// of every row is solved from the inverse mapping, which is stepped incrementally along the row. Samples are
+	// fixed point (8-bit weights, colors premultiplied by alpha while filtering); 8-bit RGBA interpolates in SSE2.
+	// The destination must not overlap the source. Returns false for transforms that are not invertible or when the
+	// pixel formats differ.
+	bool warpAffine(const ImageView& source, const ImageView& destination, const AffineTransform& transform, WarpFilter filter = WarpFilter::BILINEAR);
+	bool warpPerspective(const ImageView& source, const ImageView& destination, const PerspectiveTransform& transform, WarpFilter filter = WarpFilter::BILINEAR);
+
+	// Image is any of the 8 image classes; destination must already be allocated
+	template<IsImage Image>
+	bool warpAffine(const Image& source, Image& destination, const AffineTransform& transform, WarpFilter filter = WarpFilter::BILINEAR);
+	template<IsImage Image>
+	bool warpPerspective(const Image& source, Image& destination, const PerspectiveTransform& transform, WarpFilter filter = WarpFilter::BILINEAR);
+}
@@ -0,0 +1,783 @@
+#include "Yuv.h"
+
+// Dependencies | std
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+// Dependencies | core
+#include <core/Simd.h>
+
+namespace it {
+	namespace {
+		// Pixels per parallel range
+		constexpr int PARALLEL_GRAIN{ 65536 };
+		// Fractional bits of the YUV to RGB and RGB to YUV weights
+		constexpr int DECODE_BITS{ 13 };
+		constexpr int ENCODE_BITS{ 14 };
+
+		int rowGrain(int width) {
+			return std::max(1, PARALLEL_GRAIN / std::max(1, width));
+		}
+		int halfOf(int size) {
+			return (size + 1) / 2;
+		}
+		unsigned char clampSample(int value) {
+			return static_cast<unsigned char>(std::clamp(value, 0, 255));
+		}
+
+		// Luma and blue difference weights of the matrix
+		void matrixWeights(YuvMatrix matrix, double& red, double& blue) {
+			if (matrix == YuvMatrix::BT709) {
+				red = 0.2126;
+				blue = 0.0722;
+			}
+			else {
+				red = 0.299;
+				blue = 0.114;
+			}
+		}
+		int fixedPoint(double value, int bits) {
+			return static_cast<int>(std::lround(value * static_cast<double>(1 << bits)));
+		}
+
+		// Structs
+		// rgb = (yGain * (Y - yOffset) + chroma weights * (U - 128, V - 128) + rounding) >> DECODE_BITS
+		struct DecodeCoefficients {
+			// Properties
+			int yOffset{ 0 };
+			int yGain{ 0 };
+			int redV{ 0 };
+			int greenU{ 0 };
+			int greenV{ 0 };
+			int blueU{ 0 };
+			std::array<unsigned char, 256> gray{}; // Luma only
+
+			// Constructors
+			explicit DecodeCoefficients(const YuvColorSpace& colorSpace) {
+				double red = 0.0;
+				double blue = 0.0;
+				matrixWeights(colorSpace.matrix, red, blue);
+				const double green = 1.0 - red - blue;
+				const bool limited = colorSpace.range == YuvRange::LIMITED;
+				const double lumaScale = limited ? 255.0 / 219.0 : 1.0;
+				const double chromaScale = limited ? 255.0 / 224.0 : 1.0;
+
+				yOffset = limited ? 16 : 0;
+				yGain = fixedPoint(lumaScale, DECODE_BITS);
+				redV = fixedPoint(2.0 * (1.0 - red) * chromaScale, DECODE_BITS);
+				greenU = fixedPoint(-2.0 * (1.0 - blue) * blue / green * chromaScale, DECODE_BITS);
+				greenV = fixedPoint(-2.0 * (1.0 - red) * red / green * chromaScale, DECODE_BITS);
+				blueU = fixedPoint(2.0 * (1.0 - blue) * chromaScale, DECODE_BITS);
+				for (int value = 0; value < 256; value++)
+					gray[value] = clampSample((yGain * (value - yOffset) + (1 << (DECODE_BITS - 1))) >> DECODE_BITS);
+			}
+
+			// Functions
+			// luma already has the offset removed, u and v are centered on 0
+			void pixel(int luma, int u, int v, unsigned char* destination) const {
+				const int base = yGain * luma + (1 << (DECODE_BITS - 1));
+				destination[0] = clampSample((base + redV * v) >> DECODE_BITS);
+				destination[1] = clampSample((base + greenU * u + greenV * v) >> DECODE_BITS);
+				destination[2] = clampSample((base + blueU * u) >> DECODE_BITS);
+			}
+		};
+
+		// Y = (luma weights * rgb + (yOffset << ENCODE_BITS) + rounding) >> ENCODE_BITS; chroma comes from sums of 4
+		// pixels and so takes 2 more bits of shift. Each set of weights is adjusted to keep its exact sum, so white
+		// stays at full luma and grays keep neutral chroma.
+		struct EncodeCoefficients {
+			// Properties
+			int lumaRed{ 0 };
+			int lumaGreen{ 0 };
+			int lumaBlue{ 0 };
+			int lumaConstant{ 0 };
+			int uRed{ 0 };
+			int uGreen{ 0 };
+			int uBlue{ 0 };
+			int vRed{ 0 };
+			int vGreen{ 0 };
+			int vBlue{ 0 };
+			int chromaConstant{ (128 << (ENCODE_BITS + 2)) + (1 << (ENCODE_BITS + 1)) };
+
+			// Constructors
+			explicit EncodeCoefficients(const YuvColorSpace& colorSpace) {
+				double red = 0.0;
+				double blue = 0.0;
+				matrixWeights(colorSpace.matrix, red, blue);
+				const bool limited = colorSpace.range == YuvRange::LIMITED;
+				const double lumaScale = limited ? 219.0 / 255.0 : 1.0;
+				const double chromaScale = limited ? 224.0 / 255.0 : 1.0;
+
+				lumaRed = fixedPoint(red * lumaScale, ENCODE_BITS);
+				lumaBlue = fixedPoint(blue * lumaScale, ENCODE_BITS);
+				lumaGreen = fixedPoint(lumaScale, ENCODE_BITS) - lumaRed - lumaBlue;
+				lumaConstant = ((limited ? 16 : 0) << ENCODE_BITS) + (1 << (ENCODE_BITS - 1));
+				uBlue = fixedPoint(0.5 * chromaScale, ENCODE_BITS);
+				uRed = fixedPoint(-0.5 * red / (1.0 - blue) * chromaScale, ENCODE_BITS);
+				uGreen = -uBlue - uRed;
+				vRed = uBlue;
+				vBlue = fixedPoint(-0.5 * blue / (1.0 - red) * chromaScale, ENCODE_BITS);
+				vGreen = -vRed - vBlue;
+			}
+
+			// Functions
+			unsigned char luma(int red, int green, int blue) const {
+				return clampSample((lumaRed * red + lumaGreen * green + lumaBlue * blue + lumaConstant) >> ENCODE_BITS);
+			}
+			// Of sums of 4 pixels
+			unsigned char u(int red, int green, int blue) const {
+				return clampSample((uRed * red + uGreen * green + uBlue * blue + chromaConstant) >> (ENCODE_BITS + 2));
+			}
+			unsigned char v(int red, int green, int blue) const {
+				return clampSample((vRed * red + vGreen * green + vBlue * blue + chromaConstant) >> (ENCODE_BITS + 2));
+			}
+		};
+
+#if defined(IT_SIMD_SSE2)
+		// Functions | SSE2
+		__m128i pairWeights(int first, int second) {
+			return _mm_set1_epi32(static_cast<int>((static_cast<unsigned int>(second) << 16) | static_cast<unsigned short>(first)));
+		}
+		// (a * weights.first + b * weights.second + constant) >> SHIFT over 8 16-bit lanes
+		template<int SHIFT>
+		__m128i weigh(__m128i a, __m128i b, __m128i weights, __m128i constant) {
+			const __m128i low = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(a, b), weights), constant);
+			const __m128i high = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(a, b), weights), constant);
+			return _mm_packs_epi32(_mm_srai_epi32(low, SHIFT), _mm_srai_epi32(high, SHIFT));
+		}
+		// Same with a third operand weighed by the first weight of thirdWeights
+		template<int SHIFT>
+		__m128i weigh(__m128i a, __m128i b, __m128i c, __m128i weights, __m128i thirdWeights, __m128i constant) {
+			const __m128i zero = _mm_setzero_si128();
+			__m128i low = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(a, b), weights), constant);
+			__m128i high = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(a, b), weights), constant);
+			low = _mm_add_epi32(low, _mm_madd_epi16(_mm_unpacklo_epi16(c, zero), thirdWeights));
+			high = _mm_add_epi32(high, _mm_madd_epi16(_mm_unpackhi_epi16(c, zero), thirdWeights));
+			return _mm_packs_epi32(_mm_srai_epi32(low, SHIFT), _mm_srai_epi32(high, SHIFT));
+		}
+		// Sums of horizontal byte pairs: 16 bytes to 8 16-bit lanes
+		__m128i pairSums(__m128i bytes) {
+			return _mm_add_epi16(_mm_and_si128(bytes, _mm_set1_epi16(0x00FF)), _mm_srli_epi16(bytes, 8));
+		}
+
+		// 16 pixels of red, green and blue bytes interleaved with opaque alpha (4 channels) or without it (3)
+		template<int CHANNELS>
+		void storePixels(__m128i red, __m128i green, __m128i blue, unsigned char* destination) {
+			const __m128i alpha = _mm_set1_epi8(static_cast<char>(0xFF));
+			const __m128i redGreenLow = _mm_unpacklo_epi8(red, green);
+			const __m128i redGreenHigh = _mm_unpackhi_epi8(red, green);
+			const __m128i blueAlphaLow = _mm_unpacklo_epi8(blue, alpha);
+			const __m128i blueAlphaHigh = _mm_unpackhi_epi8(blue, alpha);
+			const __m128i pixels[4]{
+				_mm_unpacklo_epi16(redGreenLow, blueAlphaLow),
+				_mm_unpackhi_epi16(redGreenLow, blueAlphaLow),
+				_mm_unpacklo_epi16(redGreenHigh, blueAlphaHigh),
+				_mm_unpackhi_epi16(redGreenHigh, blueAlphaHigh)
+			};
+
+			if constexpr (CHANNELS == 4) {
+				for (int index = 0; index < 4; index++)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index * 16), pixels[index]);
+			}
+			else {
+#if defined(IT_SIMD_SSSE3)
+				// 4 pixels to 12 bytes per shuffle, then the 4 pieces packed into 3 registers
+				const __m128i compact = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+				const __m128i first = _mm_shuffle_epi8(pixels[0], compact);
+				const __m128i second = _mm_shuffle_epi8(pixels[1], compact);
+				const __m128i third = _mm_shuffle_epi8(pixels[2], compact);
+				const __m128i fourth = _mm_shuffle_epi8(pixels[3], compact);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_or_si128(first, _mm_slli_si128(second, 12)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 16), _mm_or_si128(_mm_srli_si128(second, 4), _mm_slli_si128(third, 8)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 32), _mm_or_si128(_mm_srli_si128(third, 8), _mm_slli_si128(fourth, 4)));
+#else
+				alignas(16) std::array<unsigned char, 64> buffer{};
+				for (int index = 0; index < 4; index++)
+					_mm_store_si128(reinterpret_cast<__m128i*>(buffer.data() + index * 16), pixels[index]);
+				for (int pixel = 0; pixel < 16; pixel++)
+					std::memcpy(destination + pixel * 3, buffer.data() + pixel * 4, 3);
+#endif
+			}
+		}
+#endif
+
+		// Functions | YUV to images
+		// One output row of 3 or 4 channels
+		template<int CHANNELS>
+		void decodeRow(const YuvView& source, int y, bool halfSize, const DecodeCoefficients& coefficients, unsigned char* destination, int width) {
+			const unsigned char* luma = source.row(0, halfSize ? 2 * y : y);
+			const unsigned char* lumaBelow = halfSize ? source.row(0, std::min(2 * y + 1, source.height - 1)) : luma;
+			const int chromaY = halfSize ? y : y / 2;
+			const bool interleaved = source.layout == YuvLayout::NV12;
+			const unsigned char* chromaU = source.row(1, chromaY);
+			const unsigned char* chromaV = interleaved ? chromaU + 1 : source.row(2, chromaY);
+			const int chromaStep = interleaved ? 2 : 1;
+
+			int x = 0;
+#if defined(IT_SIMD_SSE2)
+			// Whole blocks of 16 pixels whose luma (2x2 blocks with halfSize) is entirely in the source
+			const int simdEnd = (halfSize ? source.width / 2 : width) & ~15;
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i lumaOffset = _mm_set1_epi16(static_cast<short>(coefficients.yOffset));
+			const __m128i chromaOffset = _mm_set1_epi16(128);
+			const __m128i lowByte = _mm_set1_epi16(0x00FF);
+			const __m128i rounding = _mm_set1_epi32(1 << (DECODE_BITS - 1));
+			const __m128i redWeights = pairWeights(coefficients.yGain, coefficients.redV);
+			const __m128i greenWeights = pairWeights(coefficients.yGain, coefficients.greenU);
+			const __m128i greenVWeights = pairWeights(coefficients.greenV, 0);
+			const __m128i blueWeights = pairWeights(coefficients.yGain, coefficients.blueU);
+
+			for (; x < simdEnd; x += 16) {
+				// Luma of 16 pixels as two halves of 8 16-bit lanes
+				__m128i lumaLow;
+				__m128i lumaHigh;
+				if (halfSize) {
+					const __m128i two = _mm_set1_epi16(2);
+					const __m128i* top = reinterpret_cast<const __m128i*>(luma + 2 * x);
+					const __m128i* bottom = reinterpret_cast<const __m128i*>(lumaBelow + 2 * x);
+					lumaLow = _mm_add_epi16(pairSums(_mm_loadu_si128(top)), pairSums(_mm_loadu_si128(bottom)));
+					lumaHigh = _mm_add_epi16(pairSums(_mm_loadu_si128(top + 1)), pairSums(_mm_loadu_si128(bottom + 1)));
+					lumaLow = _mm_srli_epi16(_mm_add_epi16(lumaLow, two), 2);
+					lumaHigh = _mm_srli_epi16(_mm_add_epi16(lumaHigh, two), 2);
+				}
+				else {
+					const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(luma + x));
+					lumaLow = _mm_unpacklo_epi8(bytes, zero);
+					lumaHigh = _mm_unpackhi_epi8(bytes, zero);
+				}
+				lumaLow = _mm_sub_epi16(lumaLow, lumaOffset);
+				lumaHigh = _mm_sub_epi16(lumaHigh, lumaOffset);
+
+				// Chroma of the same pixels: 16 samples as they are with halfSize, 8 repeated twice otherwise
+				__m128i uLow;
+				__m128i uHigh;
+				__m128i vLow;
+				__m128i vHigh;
+				if (halfSize) {
+					if (interleaved) {
+						const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chromaU + 2 * x));
+						const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chromaU + 2 * x + 16));
+						uLow = _mm_and_si128(first, lowByte);
+						vLow = _mm_srli_epi16(first, 8);
+						uHigh = _mm_and_si128(second, lowByte);
+						vHigh = _mm_srli_epi16(second, 8);
+					}
+					else {
+						const __m128i u = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chromaU + x));
+						const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chromaV + x));
+						uLow = _mm_unpacklo_epi8(u, zero);
+						uHigh = _mm_unpackhi_epi8(u, zero);
+						vLow = _mm_unpacklo_epi8(v, zero);
+						vHigh = _mm_unpackhi_epi8(v, zero);
+					}
+				}
+				else {
+					__m128i u;
+					__m128i v;
+					if (interleaved) {
+						const __m128i pairs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chromaU + x));
+						u = _mm_and_si128(pairs, lowByte);
+						v = _mm_srli_epi16(pairs, 8);
+					}
+					else {
+						u = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(chromaU + x / 2)), zero);
+						v = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(chromaV + x / 2)), zero);
+					}
+					uLow = _mm_unpacklo_epi16(u, u);
+					uHigh = _mm_unpackhi_epi16(u, u);
+					vLow = _mm_unpacklo_epi16(v, v);
+					vHigh = _mm_unpackhi_epi16(v, v);
+				}
+				uLow = _mm_sub_epi16(uLow, chromaOffset);
+				uHigh = _mm_sub_epi16(uHigh, chromaOffset);
+				vLow = _mm_sub_epi16(vLow, chromaOffset);
+				vHigh = _mm_sub_epi16(vHigh, chromaOffset);
+
+				const __m128i red = _mm_packus_epi16(
+					weigh<DECODE_BITS>(lumaLow, vLow, redWeights, rounding),
+					weigh<DECODE_BITS>(lumaHigh, vHigh, redWeights, rounding));
+				const __m128i green = _mm_packus_epi16(
+					weigh<DECODE_BITS>(lumaLow, uLow, vLow, greenWeights, greenVWeights, rounding),
+					weigh<DECODE_BITS>(lumaHigh, uHigh, vHigh, greenWeights, greenVWeights, rounding));
+				const __m128i blue = _mm_packus_epi16(
+					weigh<DECODE_BITS>(lumaLow, uLow, blueWeights, rounding),
+					weigh<DECODE_BITS>(lumaHigh, uHigh, blueWeights, rounding));
+				storePixels<CHANNELS>(red, green, blue, destination + x * CHANNELS);
+			}
+#endif
+
+			for (; x < width; x++) {
+				int value = luma[x];
+				if (halfSize) {
+					const int left = 2 * x;
+					const int right = std::min(left + 1, source.width - 1);
+					value = (luma[left] + luma[right] + lumaBelow[left] + lumaBelow[right] + 2) >> 2;
+				}
+				const int chromaX = (halfSize ? x : x / 2) * chromaStep;
+				unsigned char* pixel = destination + x * CHANNELS;
+				coefficients.pixel(value - coefficients.yOffset, chromaU[chromaX] - 128, chromaV[chromaX] - 128, pixel);
+				if constexpr (CHANNELS == 4)
+					pixel[3] = 255;
+			}
+		}
+
+		// One output row of 1 or 2 channels, from luma only
+		void decodeGrayRow(const YuvView& source, int y, bool halfSize, const DecodeCoefficients& coefficients, unsigned char* destination, int width, int channels) {
+			const unsigned char* luma = source.row(0, halfSize ? 2 * y : y);
+			const unsigned char* lumaBelow = halfSize ? source.row(0, std::min(2 * y + 1, source.height - 1)) : luma;
+
+			if (!halfSize && channels == 1 && coefficients.yOffset == 0) {
+				std::memcpy(destination, luma, static_cast<size_t>(width));
+				return;
+			}
+
+			int x = 0;
+#if defined(IT_SIMD_SSE2)
+			const int simdEnd = (halfSize ? source.width / 2 : width) & ~15;
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i two = _mm_set1_epi16(2);
+			const __m128i lumaOffset = _mm_set1_epi16(static_cast<short>(coefficients.yOffset));
+			const __m128i gain = pairWeights(coefficients.yGain, 0);
+			const __m128i rounding = _mm_set1_epi32(1 << (DECODE_BITS - 1));
+			const __m128i alpha = _mm_set1_epi8(static_cast<char>(0xFF));
+			for (; x < simdEnd; x += 16) {
+				__m128i lumaLow;
+				__m128i lumaHigh;
+				if (halfSize) {
+					const __m128i* top = reinterpret_cast<const __m128i*>(luma + 2 * x);
+					const __m128i* bottom = reinterpret_cast<const __m128i*>(lumaBelow + 2 * x);
+					lumaLow = _mm_add_epi16(pairSums(_mm_loadu_si128(top)), pairSums(_mm_loadu_si128(bottom)));
+					lumaHigh = _mm_add_epi16(pairSums(_mm_loadu_si128(top + 1)), pairSums(_mm_loadu_si128(bottom + 1)));
+					lumaLow = _mm_srli_epi16(_mm_add_epi16(lumaLow, two), 2);
+					lumaHigh = _mm_srli_epi16(_mm_add_epi16(lumaHigh, two), 2);
+				}
+				else {
+					const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(luma + x));
+					lumaLow = _mm_unpacklo_epi8(bytes, zero);
+					lumaHigh = _mm_unpackhi_epi8(bytes, zero);
+				}
+				const __m128i gray = _mm_packus_epi16(
+					weigh<DECODE_BITS>(_mm_sub_epi16(lumaLow, lumaOffset), zero, gain, rounding),
+					weigh<DECODE_BITS>(_mm_sub_epi16(lumaHigh, lumaOffset), zero, gain, rounding));
+				if (channels == 2) {
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 2 * x), _mm_unpacklo_epi8(gray, alpha));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 2 * x + 16), _mm_unpackhi_epi8(gray, alpha));
+				}
+				else
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + x), gray);
+			}
+#endif
+
+			for (; x < width; x++) {
+				int value = luma[x];
+				if (halfSize) {
+					const int left = 2 * x;
+					const int right = std::min(left + 1, source.width - 1);
+					value = (luma[left] + luma[right] + lumaBelow[left] + lumaBelow[right] + 2) >> 2;
+				}
+				destination[x * channels] = coefficients.gray[value];
+				if (channels == 2)
+					destination[x * channels + 1] = 255;
+			}
+		}
+
+		// Functions | images to YUV
+		// Red, green and blue of one row of the (possibly halved) source as 16-bit planes
+		template<int CHANNELS, bool HALF>
+		void loadRow(const ImageView& source, int y, int width, short* red, short* green, short* blue) {
+			constexpr int COLOR = CHANNELS >= 3 ? 1 : 0;
+			const unsigned char* top = source.row(HALF ? 2 * y : y);
+			const unsigned char* bottom = HALF ? source.row(std::min(2 * y + 1, source.height - 1)) : top;
+
+			for (int x = 0; x < width; x++) {
+				if constexpr (HALF) {
+					const int left = 2 * x * CHANNELS;
+					const int right = std::min(2 * x + 1, source.width - 1) * CHANNELS;
+					red[x] = static_cast<short>((top[left] + top[right] + bottom[left] + bottom[right] + 2) >> 2);
+					green[x] = static_cast<short>((top[left + COLOR] + top[right + COLOR] + bottom[left + COLOR] + bottom[right + COLOR] + 2) >> 2);
+					blue[x] = static_cast<short>((top[left + 2 * COLOR] + top[right + 2 * COLOR] + bottom[left + 2 * COLOR] + bottom[right + 2 * COLOR] + 2) >> 2);
+				}
+				else {
+					const unsigned char* pixel = top + x * CHANNELS;
+					red[x] = pixel[0];
+					green[x] = pixel[COLOR];
+					blue[x] = pixel[2 * COLOR];
+				}
+			}
+		}
+		template<bool HALF>
+		void loadRow(const ImageView& source, int y, int width, short* red, short* green, short* blue) {
+			switch (source.channels) {
+				case 1:
+					loadRow<1, HALF>(source, y, width, red, green, blue);
+					break;
+				case 2:
+					loadRow<2, HALF>(source, y, width, red, green, blue);
+					break;
+				case 3:
+					loadRow<3, HALF>(source, y, width, red, green, blue);
+					break;
+				default:
+					loadRow<4, HALF>(source, y, width, red, green, blue);
+					break;
+			}
+		}
+
+		void encodeLuma(const short* red, const short* green, const short* blue, int width, const EncodeCoefficients& coefficients, unsigned char* destination) {
+			int x = 0;
+#if defined(IT_SIMD_SSE2)
+			const __m128i redGreen = pairWeights(coefficients.lumaRed, coefficients.lumaGreen);
+			const __m128i blueWeights = pairWeights(coefficients.lumaBlue, 0);
+			const __m128i constant = _mm_set1_epi32(coefficients.lumaConstant);
+			for (; x + 16 <= width; x += 16) {
+				const __m128i* r = reinterpret_cast<const __m128i*>(red + x);
+				const __m128i* g = reinterpret_cast<const __m128i*>(green + x);
+				const __m128i* b = reinterpret_cast<const __m128i*>(blue + x);
+				const __m128i low = weigh<ENCODE_BITS>(_mm_loadu_si128(r), _mm_loadu_si128(g), _mm_loadu_si128(b), redGreen, blueWeights, constant);
+				const __m128i high = weigh<ENCODE_BITS>(_mm_loadu_si128(r + 1), _mm_loadu_si128(g + 1), _mm_loadu_si128(b + 1), redGreen, blueWeights, constant);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + x), _mm_packus_epi16(low, high));
+			}
+#endif
+			for (; x < width; x++)
+				destination[x] = coefficients.luma(red[x], green[x], blue[x]);
+		}
+
+		// Chroma from sums of 2x2 pixels
+		void encodeChroma(const short* red, const short* green, const short* blue, int width, const EncodeCoefficients& coefficients, unsigned char* u, unsigned char* v) {
+			int x = 0;
+#if defined(IT_SIMD_SSE2)
+			const __m128i uRedGreen = pairWeights(coefficients.uRed, coefficients.uGreen);
+			const __m128i uBlue = pairWeights(coefficients.uBlue, 0);
+			const __m128i vRedGreen = pairWeights(coefficients.vRed, coefficients.vGreen);
+			const __m128i vBlue = pairWeights(coefficients.vBlue, 0);
+			const __m128i constant = _mm_set1_epi32(coefficients.chromaConstant);
+			for (; x + 16 <= width; x += 16) {
+				const __m128i* r = reinterpret_cast<const __m128i*>(red + x);
+				const __m128i* g = reinterpret_cast<const __m128i*>(green + x);
+				const __m128i* b = reinterpret_cast<const __m128i*>(blue + x);
+				const __m128i redLow = _mm_loadu_si128(r);
+				const __m128i redHigh = _mm_loadu_si128(r + 1);
+				const __m128i greenLow = _mm_loadu_si128(g);
+				const __m128i greenHigh = _mm_loadu_si128(g + 1);
+				const __m128i blueLow = _mm_loadu_si128(b);
+				const __m128i blueHigh = _mm_loadu_si128(b + 1);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(u + x), _mm_packus_epi16(
+					weigh<ENCODE_BITS + 2>(redLow, greenLow, blueLow, uRedGreen, uBlue, constant),
+					weigh<ENCODE_BITS + 2>(redHigh, greenHigh, blueHigh, uRedGreen, uBlue, constant)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(v + x), _mm_packus_epi16(
+					weigh<ENCODE_BITS + 2>(redLow, greenLow, blueLow, vRedGreen, vBlue, constant),
+					weigh<ENCODE_BITS + 2>(redHigh, greenHigh, blueHigh, vRedGreen, vBlue, constant)));
+			}
+#endif
+			for (; x < width; x++) {
+				u[x] = coefficients.u(red[x], green[x], blue[x]);
+				v[x] = coefficients.v(red[x], green[x], blue[x]);
+			}
+		}
+
+		void interleaveChroma(const unsigned char* u, const unsigned char* v, int width, unsigned char* destination) {
+			int x = 0;
+#if defined(IT_SIMD_SSE2)
+			for (; x + 16 <= width; x += 16) {
+				const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u + x));
+				const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v + x));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 2 * x), _mm_unpacklo_epi8(first, second));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 2 * x + 16), _mm_unpackhi_epi8(first, second));
+			}
+#endif
+			for (; x < width; x++) {
+				destination[2 * x] = u[x];
+				destination[2 * x + 1] = v[x];
+			}
+		}
+	}
+
+	// class YuvFrame
+
+	// Constructor / Destructor
+	YuvFrame::YuvFrame(int width, int height, YuvLayout layout) {
+		allocate(width, height, layout);
+	}
+	YuvFrame::YuvFrame(const YuvFrame& other) {
+		*this = other;
+	}
+	YuvFrame::YuvFrame(YuvFrame&& other) noexcept {
+		*this = std::move(other);
+	}
+	YuvFrame::~YuvFrame() {
+		free();
+	}
+
+	// Operators | assignment
+	YuvFrame& YuvFrame::operator=(const YuvFrame& other) {
+		if (this == &other)
+			return *this;
+
+		if (other.data == nullptr) {
+			free();
+			layout = other.layout;
+			return *this;
+		}
+		if (allocate(other.width, other.height, other.layout) != nullptr)
+			std::memcpy(data, other.data, other.dataSize());
+
+		return *this;
+	}
+	YuvFrame& YuvFrame::operator=(YuvFrame&& other) noexcept {
+		if (this == &other)
+			return *this;
+
+		free();
+
+		layout = other.layout;
+		width = other.width;
+		height = other.height;
+		data = other.data;
+
+		other.width = 0;
+		other.height = 0;
+		other.data = nullptr;
+
+		return *this;
+	}
+
+	// Getters
+	YuvLayout YuvFrame::getLayout() const {
+		return layout;
+	}
+	int YuvFrame::getWidth() const {
+		return width;
+	}
+	int YuvFrame::getHeight() const {
+		return height;
+	}
+	unsigned char* YuvFrame::getData() const {
+		return data;
+	}
+
+	// Functions | allocation / deallocation
+	unsigned char* YuvFrame::allocate(int width, int height, YuvLayout layout) {
+		if (data != nullptr) {
+			std::free(data);
+			data = nullptr;
+		}
+		this->width = 0;
+		this->height = 0;
+		this->layout = layout;
+
+		if (width <= 0 || height <= 0)
+			return nullptr;
+
+		const size_t lumaSize = static_cast<size_t>(width) * static_cast<size_t>(height);
+		const size_t chromaSize = static_cast<size_t>(halfOf(width)) * static_cast<size_t>(halfOf(height));
+		data = reinterpret_cast<unsigned char*>(std::malloc(lumaSize + 2 * chromaSize));
+		if (data == nullptr)
+			return nullptr;
+		this->width = width;
+		this->height = height;
+		return data;
+	}
+	bool YuvFrame::isAllocated() const {
+		return data != nullptr;
+	}
+	size_t YuvFrame::dataSize() const {
+		return static_cast<size_t>(width) * static_cast<size_t>(height) + 2 * static_cast<size_t>(chromaWidth()) * static_cast<size_t>(chromaHeight());
+	}
+	void YuvFrame::free() {
+		width = 0;
+		height = 0;
+		if (data != nullptr) {
+			std::free(data);
+			data = nullptr;
+		}
+	}
+
+	// Functions | planes
+	int YuvFrame::planeCount() const {
+		return layout == YuvLayout::NV12 ? 2 : 3;
+	}
+	int YuvFrame::chromaWidth() const {
+		return width > 0 ? halfOf(width) : 0;
+	}
+	int YuvFrame::chromaHeight() const {
+		return height > 0 ? halfOf(height) : 0;
+	}
+	unsigned char* YuvFrame::plane(int index) const {
+		if (data == nullptr || index < 0 || index >= planeCount())
+			return nullptr;
+
+		const size_t lumaSize = static_cast<size_t>(width) * static_cast<size_t>(height);
+		const size_t chromaSize = static_cast<size_t>(chromaWidth()) * static_cast<size_t>(chromaHeight());
+		if (index == 0)
+			return data;
+		return data + lumaSize + (index == 2 ? chromaSize : 0);
+	}
+	size_t YuvFrame::planeStride(int index) const {
+		if (index < 0 || index >= planeCount())
+			return 0;
+		if (index == 0)
+			return static_cast<size_t>(width);
+		return static_cast<size_t>(chromaWidth()) * (layout == YuvLayout::NV12 ? 2 : 1);
+	}
+
+	// struct YuvView
+
+	// Constructors | external planes
+	YuvView::YuvView(YuvLayout layout, int width, int height, unsigned char* luma, size_t lumaStride, unsigned char* chroma, size_t chromaStride, unsigned char* chromaV, size_t chromaVStride) : layout(layout), width(width), height(height) {
+		const size_t packedChromaStride = static_cast<size_t>(chromaWidth()) * (layout == YuvLayout::NV12 ? 2 : 1);
+		planes = { luma, chroma, layout == YuvLayout::NV12 ? nullptr : chromaV };
+		strides[0] = lumaStride != 0 ? lumaStride : static_cast<size_t>(std::max(width, 0));
+		strides[1] = chromaStride != 0 ? chromaStride : packedChromaStride;
+		strides[2] = layout == YuvLayout::NV12 ? 0 : (chromaVStride != 0 ? chromaVStride : strides[1]);
+	}
+
+	// Constructors | copy / conversions
+	YuvView::YuvView(const YuvFrame& other) : layout(other.getLayout()), width(other.getWidth()), height(other.getHeight()) {
+		for (int index = 0; index < 3; index++) {
+			planes[index] = other.plane(index);
+			strides[index] = other.planeStride(index);
+		}
+	}
+
+	// Functions
+	int YuvView::chromaWidth() const {
+		return width > 0 ? halfOf(width) : 0;
+	}
+	int YuvView::chromaHeight() const {
+		return height > 0 ? halfOf(height) : 0;
+	}
+	bool YuvView::hasData() const {
+		return width > 0 && height > 0 && planes[0] != nullptr && planes[1] != nullptr && (layout == YuvLayout::NV12 || planes[2] != nullptr);
+	}
+	unsigned char* YuvView::row(int plane, int y) const {
+		return planes[plane] + static_cast<size_t>(y) * strides[plane];
+	}
+
+	// Functions | YUV to images
+	bool yuvToImage(const YuvView& source, const ImageView& destination, const YuvColorSpace& colorSpace, bool halfSize, ExecutionPolicy policy) {
+		// Error check
+		if (!source.hasData() || !destination.hasData() || destination.channels < 1 || destination.channels > 4)
+			return false;
+		const int width = halfSize ? halfOf(source.width) : source.width;
+		const int height = halfSize ? halfOf(source.height) : source.height;
+		if (destination.width != width || destination.height != height)
+			return false;
+
+		const DecodeCoefficients coefficients(colorSpace);
+		parallelFor(0, height, [&](int begin, int end) {
+			for (int y = begin; y < end; y++) {
+				unsigned char* row = destination.row(y);
+				switch (destination.channels) {
+					case 3:
+						decodeRow<3>(source, y, halfSize, coefficients, row, width);
+						break;
+					case 4:
+						decodeRow<4>(source, y, halfSize, coefficients, row, width);
+						break;
+					default:
+						decodeGrayRow(source, y, halfSize, coefficients, row, width, destination.channels);
+						break;
+				}
+			}
+		}, rowGrain(width), policy);
+
+		return true;
+	}
+	bool yuvToImage(const YuvView& source, ImageGray& destination, const YuvColorSpace& colorSpace, bool halfSize, ExecutionPolicy policy) {
+		// Error check
+		if (!source.hasData())
+			return false;
+
+		if (destination.allocate(halfSize ? halfOf(source.width) : source.width, halfSize ? halfOf(source.height) : source.height) == nullptr)
+			return false;
+		return yuvToImage(source, ImageView(destination), colorSpace, halfSize, policy);
+	}
+	bool yuvToImage(const YuvView& source, ImageRGB& destination, const YuvColorSpace& colorSpace, bool halfSize, ExecutionPolicy policy) {
+		// Error check
+		if (!source.hasData())
+			return false;
+
+		if (destination.allocate(halfSize ? halfOf(source.width) : source.width, halfSize ? halfOf(source.height) : source.height) == nullptr)
+			return false;
+		return yuvToImage(source, ImageView(destination), colorSpace, halfSize, policy);
+	}
+	bool yuvToImage(const YuvView& source, ImageRGBA& destination, const YuvColorSpace& colorSpace, bool halfSize, ExecutionPolicy policy) {
+		// Error check
+		if (!source.hasData())
+			return false;
+
+		if (destination.allocate(halfSize ? halfOf(source.width) : source.width, halfSize ? halfOf(source.height) : source.height) == nullptr)
+			return false;
+		return yuvToImage(source, ImageView(destination), colorSpace, halfSize, policy);
+	}
+
+	// Functions | images to YUV
+	bool imageToYuv(const ImageView& source, const YuvView& destination, const YuvColorSpace& colorSpace, bool halfSize, ExecutionPolicy policy) {
+		// Error check
+		if (!source.hasData() || !destination.hasData() || source.channels < 1 || source.channels > 4)
+			return false;
+		const int width = halfSize ? halfOf(source.width) : source.width;
+		const int height = halfSize ? halfOf(source.height) : source.height;
+		if (destination.width != width || destination.height != height)
+			return false;
+
+		const EncodeCoefficients coefficients(colorSpace);
+		const int chromaWidth = destination.chromaWidth();
+		const bool interleaved = destination.layout == YuvLayout::NV12;
+		parallelFor(0, destination.chromaHeight(), [&](int begin, int end) {
+			// Two rows of 16-bit red, green and blue, then the 2x2 sums and, for NV12, the chroma planes
+			std::vector<short> planes(static_cast<size_t>(width) * 6 + static_cast<size_t>(chromaWidth) * 3);
+			std::vector<unsigned char> chroma(interleaved ? static_cast<size_t>(chromaWidth) * 2 : 0);
+			std::array<short*, 2> red{ planes.data(), planes.data() + width };
+			std::array<short*, 2> green{ red[1] + width, red[1] + 2 * width };
+			std::array<short*, 2> blue{ green[1] + width, green[1] + 2 * width };
+			short* redSums = blue[1] + width;
+			short* greenSums = redSums + chromaWidth;
+			short* blueSums = greenSums + chromaWidth;
+
+			for (int chromaY = begin; chromaY < end; chromaY++) {
+				const int rows = std::min(2, height - 2 * chromaY);
+				for (int row = 0; row < rows; row++) {
+					const int y = 2 * chromaY + row;
+					if (halfSize)
+						loadRow<true>(source, y, width, red[row], green[row], blue[row]);
+					else
+						loadRow<false>(source, y, width, red[row], green[row], blue[row]);
+					encodeLuma(red[row], green[row], blue[row], width, coefficients, destination.row(0, y));
+				}
+
+				// The last row and column are repeated for odd sizes
+				const int below = rows - 1;
+				for (int x = 0; x < chromaWidth; x++) {
+					const int left = 2 * x;
+					const int right = std::min(left + 1, width - 1);
+					redSums[x] = static_cast<short>(red[0][left] + red[0][right] + red[below][left] + red[below][right]);
+					greenSums[x] = static_cast<short>(green[0][left] + green[0][right] + green[below][left] + green[below][right]);
+					blueSums[x] = static_cast<short>(blue[0][left] + blue[0][right] + blue[below][left] + blue[below][right]);
+				}
+				if (interleaved) {
+					encodeChroma(redSums, greenSums, blueSums, chromaWidth, coefficients, chroma.data(), chroma.data() + chromaWidth);
+					interleaveChroma(chroma.data(), chroma.data() + chromaWidth, chromaWidth, destination.row(1, chromaY));
+				}
+				else
+					encodeChroma(redSums, greenSums, blueSums, chromaWidth, coefficients, destination.row(1, chromaY), destination.row(2, chromaY));
+			}
+		}, rowGrain(2 * width), policy);
+
+		return true;
+	}
+	bool imageToYuv(const ImageView& source, YuvFrame& destination, YuvLayout layout, const YuvColorSpace& colorSpace, bool halfSize, ExecutionPolicy policy) {
+		// Error check
+		if (!source.hasData())
+			return false;
+
+		if (destination.allocate(halfSize ? halfOf(source.width) : source.width, halfSize ? halfOf(source.height) : source.height, layout) == nullptr)
+			return false;
+		return imageToYuv(source, YuvView(destination), colorSpace, halfSize, policy);
+	}
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+// Dependencies | std
+#include <array>
+#include <cstddef>
+
+// Dependencies | core
+#include <core/Parallel.h>
+
+// Dependencies | media
+#include <media/Image.h>
+
+namespace it {
+	// Enums
+	enum class YuvLayout {
+		I420,	// Three planes: Y, then U and V at half width and half height
+		NV12	// Two planes: Y, then interleaved U and V at half width and half height
+	};
+	enum class YuvMatrix {
+		BT601,	// Standard definition video and JPEG
+		BT709	// High definition video
+	};
+	enum class YuvRange {
+		LIMITED,	// Luma 16 to 235, chroma 16 to 240 (video)
+		FULL		// Every sample 0 to 255 (JPEG)
+	};
+
+	// Structs
+	struct YuvColorSpace {
+		// Properties
+		YuvMatrix matrix{ YuvMatrix::BT601 };
+		YuvRange range{ YuvRange::LIMITED };
+	};
+
+	// 8-bit 4:2:0 frame with its planes owned; odd sizes round the chroma planes up
+	class YuvFrame {
+		// Object
+		private:
+			// Properties
+			YuvLayout layout{ YuvLayout::I420 };
+			int width{ 0 };
+			int height{ 0 };
+			unsigned char* data{ nullptr }; // Every plane in a single allocation, rows tightly packed
+
+		public:
+			// Constructor / Destructor
+			YuvFrame() = default;
+			YuvFrame(int width, int height, YuvLayout layout = YuvLayout::I420);
+			YuvFrame(const YuvFrame& other);
+			YuvFrame(YuvFrame&& other) noexcept;
+			~YuvFrame();
+
+			// Operators | assignment
+			YuvFrame& operator=(const YuvFrame& other);
+			YuvFrame& operator=(YuvFrame&& other) noexcept;
+
+			// Getters
+			YuvLayout getLayout() const;
+			int getWidth() const;
+			int getHeight() const;
+			unsigned char* getData() const;
+
+			// Functions | allocation / deallocation
+			unsigned char* allocate(int width, int height, YuvLayout layout = YuvLayout::I420);
+			bool isAllocated() const;
+			size_t dataSize() const; // Of every plane
+			void free();
+
+			// Functions | planes
+			int planeCount() const; // 3 for I420, 2 for NV12
+			int chromaWidth() const; // In chroma samples
+			int chromaHeight() const;
+			unsigned char* plane(int index) const; // Y, U, V or Y, UV; nullptr past the last plane
+			size_t planeStride(int index) const; // Bytes
+	};
+
+	// Frame planes owned elsewhere, for instance by a video decoder, with any row strides
+	struct YuvView {
+		// Properties
+		YuvLayout layout{ YuvLayout::I420 };
+		int width{ 0 };
+		int height{ 0 };
+		std::array<unsigned char*, 3> planes{};	// Y, U, V or Y, UV (the third is unused)
+		std::array<size_t, 3> strides{};		// Bytes from the start of one row to the next, per plane
+
+		// Constructors | external planes (a stride of 0 means tightly packed rows)
+		YuvView(YuvLayout layout, int width, int height, unsigned char* luma, size_t lumaStride, unsigned char* chroma, size_t chromaStride, unsigned char* chromaV = nullptr, size_t chromaVStride = 0);
+
+		// Constructors | copy / conversions
+		YuvView(const YuvFrame& other);
+
+		// Functions
+		int chromaWidth() const;
+		int chromaHeight() const;
+		bool hasData() const;
+		unsigned char* row(int plane, int y) const;
+	};
+
+	// Functions | YUV to images
+	// Fixed-point conversions (13 fractional bits) with SSE2 multiply-adds over 16 pixels per step and a scalar path
+	// giving the same results. Chroma is upsampled by repeating each sample over its 2x2 pixels. With halfSize, each
+	// output pixel takes the mean of a 2x2 block of luma and the chroma sample that covers the block, so the full-size
+	// image is never built. Rows are converted in parallel.
+	// Destination has 1 (luma only), 2 (luma and opaque alpha), 3 or 4 (opaque alpha) channels and the size of the
+	// source, or half of it rounded up with halfSize
+	bool yuvToImage(const YuvView& source, const ImageView& destination, const YuvColorSpace& colorSpace = {}, bool halfSize = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	// Destination is (re)allocated
+	bool yuvToImage(const YuvView& source, ImageGray& destination, const YuvColorSpace& colorSpace = {}, bool halfSize = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	bool yuvToImage(const YuvView& source, ImageRGB& destination, const YuvColorSpace& colorSpace = {}, bool halfSize = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	bool yuvToImage(const YuvView& source, ImageRGBA& destination, const YuvColorSpace& colorSpace = {}, bool halfSize = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+
+	// Functions | images to YUV
+	// Same fixed-point scheme (14 fractional bits); each chroma sample comes from the mean color of its 2x2 pixels and
+	// alpha is ignored. With halfSize the source is averaged over 2x2 blocks on the fly before the conversion.
+	// Destination has the size of the source, or half of it rounded up with halfSize
+	bool imageToYuv(const ImageView& source, const YuvView& destination, const YuvColorSpace& colorSpace = {}, bool halfSize = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+	// Destination is (re)allocated with the given layout
+	bool imageToYuv(const ImageView& source, YuvFrame& destination, YuvLayout layout = YuvLayout::I420, const YuvColorSpace& colorSpace = {}, bool halfSize = false, ExecutionPolicy policy = ExecutionPolicy::PARALLEL);
+}